@@ -22,7 +22,7 @@ import sys
 from scripts.test.support import run_command, split_wast, node_test_glue, node_has_webassembly
 from scripts.test.shared import (
     ASM2WASM, MOZJS, NODEJS, WASM_OPT, WASM_AS, WASM_DIS,
-    WASM_CTOR_EVAL, WASM_MERGE, WASM_REDUCE, WASM2JS, WASM_METADCE,
+    WASM_CTOR_EVAL, WASM_MERGE, WASM_REDUCE, WASM2JS, WASM_METADCE, WASM_SPLIT,
     WASM_EMSCRIPTEN_FINALIZE, BINARYEN_INSTALL_DIR, BINARYEN_JS,
     files_with_pattern, has_shell_timeout, options)
 from scripts.test.wasm2js import tests, spec_tests, extra_wasm2js_tests, assert_tests, wasm2js_dir, wasm2js_blacklist
@@ -367,6 +367,11 @@ def update_wasm2js_tests():
     with open(expected_file, 'w') as o:
       o.write(out)
 
+    if os.path.exists(expected_file + '.opt'):
+      out = run_command(cmd + ['-O'])
+      with open(expected_file + '.opt', 'w') as o:
+        o.write(out)
+
   for wasm in assert_tests:
     print '..', wasm
 
@@ -403,6 +408,21 @@ def update_metadce_tests():
         o.write(stdout)
 
 
+def update_split_tests():
+  print '\n[ checking wasm-split... ]\n'
+  for t in sorted(os.listdir(os.path.join('test', 'split'))):
+    if t.endswith('.wast'):
+      print '..', t
+      t = os.path.join('test', 'split', t)
+      cmd = WASM_SPLIT + [t, '--profile=' + t + '.profile',
+                          '-o1', 'a.wast', '-o2', 'b.wast', '-S']
+      run_command(cmd)
+      with open(t + '.primary', 'w') as o:
+        o.write(open('a.wast').read())
+      with open(t + '.secondary', 'w') as o:
+        o.write(open('b.wast').read())
+
+
 def update_reduce_tests():
   if not has_shell_timeout():
     return
@@ -430,6 +450,7 @@ def main():
   update_ctor_eval_tests()
   update_wasm2js_tests()
   update_metadce_tests()
+  update_split_tests()
   update_reduce_tests()
 
   print '\n[ success! ]'
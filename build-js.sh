@@ -145,6 +145,7 @@ echo "building shared bitcode"
   $BINARYEN_SRC/support/bits.cpp \
   $BINARYEN_SRC/support/colors.cpp \
   $BINARYEN_SRC/support/file.cpp \
+  $BINARYEN_SRC/support/memory.cpp \
   $BINARYEN_SRC/support/safe_integer.cpp \
   $BINARYEN_SRC/support/threads.cpp \
   $BINARYEN_SRC/wasm/literal.cpp \
@@ -153,6 +154,7 @@ echo "building shared bitcode"
   $BINARYEN_SRC/wasm/wasm-interpreter.cpp \
   $BINARYEN_SRC/wasm/wasm-io.cpp \
   $BINARYEN_SRC/wasm/wasm-s-parser.cpp \
+  $BINARYEN_SRC/wasm/wasm-stack.cpp \
   $BINARYEN_SRC/wasm/wasm-type.cpp \
   $BINARYEN_SRC/wasm/wasm-validator.cpp \
   $BINARYEN_SRC/wasm/wasm.cpp \
@@ -14,6 +14,7 @@
 # See the License for the specific language governing permissions and
 # limitations under the License.
 
+import json
 import os
 import shutil
 import subprocess
@@ -23,7 +24,7 @@ from scripts.test.support import run_command, split_wast, node_test_glue, node_h
 from scripts.test.shared import (
     BIN_DIR, EMCC, MOZJS, NATIVECC, NATIVEXX, NODEJS, BINARYEN_JS,
     WASM_AS, WASM_CTOR_EVAL, WASM_OPT, WASM_SHELL, WASM_MERGE, WASM_METADCE,
-    WASM_DIS, WASM_REDUCE, binary_format_check, delete_from_orbit, fail, fail_with_error,
+    WASM_DIS, WASM_REDUCE, WASM_SPLIT, WASM_BENCH, binary_format_check, delete_from_orbit, fail, fail_with_error,
     fail_if_not_identical, fail_if_not_contained, has_vanilla_emcc,
     has_vanilla_llvm, minify_check, num_failures, options, tests,
     requested, warnings, has_shell_timeout, fail_if_not_identical_to_file
@@ -89,6 +90,57 @@ def run_wasm_opt_tests():
   run_command(WASM_OPT + ['a.wasm', '-o', 'b.wast', '-S'])
   assert open('b.wast', 'rb').read()[0] != '\0', 'we emit text with -S'
 
+  print '\n[ checking wasm-opt batch mode... ]\n'
+
+  delete_from_orbit('a.wasm')
+  delete_from_orbit('b.wast')
+  with open('batch.txt', 'w') as o:
+    o.write('# comment\n')
+    o.write('a.wast a.wasm -O\n')
+    o.write('a.wast b.wast --vacuum\n')
+    o.write('missing.wast c.wasm -O\n')
+    o.write('a.wast d.wasm --no-such-pass\n')
+    o.write('a.wast\n')
+  # bad lines are reported as failed jobs, and the other jobs still run
+  delete_from_orbit('d.wasm')
+  run_command(WASM_OPT + ['--batch', 'batch.txt'], expected_status=1,
+              expected_err="FAILED (manifest line 5: Unknown option '--no-such-pass')", err_contains=True)
+  assert not os.path.exists('d.wasm')
+  assert open('a.wasm', 'rb').read()[0] == '\0', 'batch jobs emit binary by default'
+  run_command(WASM_OPT + ['--batch', 'batch.txt'], expected_status=1,
+              expected_err='5 jobs, 3 failed', err_contains=True)
+  run_command(WASM_OPT + ['--batch', 'batch.txt', '-S'], expected_status=1)
+  assert open('b.wast', 'rb').read()[0] != '\0', 'batch jobs emit text with -S'
+
+  print '\n[ checking wasm-opt memory profiling... ]\n'
+
+  # each pass is reported, and the functions with the most allocations
+  cmd = WASM_OPT + [os.path.join(options.binaryen_test, 'passes', 'O4.wast'), '-O4', '--memory-profile']
+  run_command(cmd, expected_err='[memory-profile]   flatten', err_contains=True)
+  run_command(cmd, expected_err='most in precompute-propagate', err_contains=True)
+
+  print '\n[ checking wasm-opt Stack IR optimization while writing... ]\n'
+
+  # a pass after the pipeline drops the Stack IR it generated, but the Stack
+  # IR optimizations are still done when writing the binary
+  wast = os.path.join(options.binaryen_test, 'passes', 'O3_print-stack-ir.wast')
+  run_command(WASM_OPT + [wast, '-O3', '-o', 'a.wasm'])
+  run_command(WASM_OPT + [wast, '-O3', '--vacuum', '-o', 'b.wasm'])
+  assert open('a.wasm', 'rb').read() == open('b.wasm', 'rb').read()
+  # when writing a binary the pipeline leaves the Stack IR to the writer, and
+  # the result is the same as with the Stack IR the pipeline keeps for
+  # printing
+  run_command(WASM_OPT + [wast, '-O3', '--print-stack-ir', '-o', 'b.wasm'])
+  assert open('a.wasm', 'rb').read() == open('b.wasm', 'rb').read()
+  # Stack IR is also written with a source map, with the locations of the
+  # code it keeps
+  t = os.path.join(options.binaryen_test, 'debugInfo.fromasm')
+  run_command(WASM_AS + [t, '--source-map=a.map', '-o', 'a.wasm', '-g'])
+  run_command(WASM_OPT + ['a.wasm', '--input-source-map=a.map', '-O3', '-g', '-o', 'b.wasm'])
+  run_command(WASM_OPT + ['a.wasm', '--input-source-map=a.map', '-O3', '-g', '-o', 'c.wasm', '--output-source-map=c.map'])
+  assert open('b.wasm', 'rb').read() == open('c.wasm', 'rb').read()
+  assert ';;@' in run_command(WASM_DIS + ['c.wasm', '--source-map=c.map'])
+
   print '\n[ checking wasm-opt passes... ]\n'
 
   for t in sorted(os.listdir(os.path.join(options.binaryen_test, 'passes'))):
@@ -130,6 +182,21 @@ def run_wasm_opt_tests():
         with open('a.wat') as actual:
           fail_if_not_identical_to_file(actual.read(), t + '.wat')
 
+  print '\n[ checking wasm-opt --cleanup against vacuum and remove-unused-names... ]\n'
+
+  # cleanup does the work of both passes in one walk, which can get further
+  # than one round of them, but two rounds of each must agree
+  for t in sorted(os.listdir(os.path.join(options.binaryen_test, 'passes'))):
+    if t.endswith('.wast') and t != 'translate-to-fuzz.wast':
+      print '..', t
+      for module, asserts in split_wast(os.path.join(options.binaryen_test, 'passes', t)):
+        with open('split.wast', 'w') as o:
+          o.write(module)
+        cleanup = run_command(WASM_OPT + ['split.wast', '--cleanup', '--cleanup', '--print'])
+        separate = run_command(WASM_OPT + ['split.wast', '--vacuum', '--remove-unused-names',
+                                           '--vacuum', '--remove-unused-names', '--print'])
+        fail_if_not_identical(cleanup, separate)
+
   print '\n[ checking wasm-opt parsing & printing... ]\n'
 
   for t in sorted(os.listdir(os.path.join(options.binaryen_test, 'print'))):
@@ -287,6 +354,82 @@ def run_wasm_metadce_tests():
       fail_if_not_identical_to_file(stdout, expected + '.stdout')
 
 
+def run_wasm_split_tests():
+  print '\n[ checking wasm-split ]\n'
+
+  test_dir = os.path.join(options.binaryen_test, 'split')
+  for t in sorted(os.listdir(test_dir)):
+    if t.endswith('.wast'):
+      print '..', t
+      t = os.path.join(test_dir, t)
+      cmd = WASM_SPLIT + [t, '--profile=' + t + '.profile',
+                          '-o1', 'a.wast', '-o2', 'b.wast', '-S']
+      run_command(cmd)
+      with open('a.wast') as seen:
+        fail_if_not_identical_to_file(seen.read(), t + '.primary')
+      with open('b.wast') as seen:
+        fail_if_not_identical_to_file(seen.read(), t + '.secondary')
+      # the binary outputs must also be valid
+      cmd = WASM_SPLIT + [t, '--profile=' + t + '.profile',
+                          '-o1', 'a.wasm', '-o2', 'b.wasm']
+      run_command(cmd)
+      run_command(WASM_OPT + ['a.wasm'])
+      run_command(WASM_OPT + ['b.wasm'])
+
+
+def run_wasm_bench_tests():
+  print '\n[ checking wasm-bench ]\n'
+
+  # the benchmarks must run on all the shapes, and give valid JSON
+  out = run_command(WASM_BENCH + ['--size=1000', '--iterations=1'])
+  results = json.loads(out)
+  shapes = [module['module'] for module in results['modules']]
+  assert shapes == ['deep', 'wide', 'locals', 'data', 'fuzz', 'fuzz-body'], shapes
+  for module in results['modules']:
+    assert module['binary-bytes'] > 0, module
+    assert sorted(module['results'].keys()) == ['parse-text', 'print-text', 'read-binary', 'write-binary'], module
+  # and on a given module
+  out = run_command(WASM_BENCH + [os.path.join(options.binaryen_test, 'hello_world.wast'), '--iterations=1'])
+  assert len(json.loads(out)['modules']) == 1, out
+  # the complexity mode must time the passes on growing modules; it saves the
+  # largest module before timing, in case of a timeout, and removes it when
+  # the pass was fast
+  delete_from_orbit('complexity-deep-vacuum.wasm')
+  out = run_command(WASM_BENCH + ['--complexity', '--shape=deep', '--size=1000', '--steps=2', '--iterations=1', '-p', 'vacuum', '-p', 'precompute'])
+  results = json.loads(out)
+  assert len(results['shapes']) == 1, out
+  shape = results['shapes'][0]
+  assert shape['expressions'][0] < shape['expressions'][1], shape
+  assert sorted(shape['passes'].keys()) == ['precompute', 'vacuum'], shape
+  for result in shape['passes'].values():
+    assert len(result['seconds']) == 2, result
+  assert not os.path.exists('complexity-deep-vacuum.wasm')
+  # a pass that fails is reported, and the others still run
+  cmd = WASM_BENCH + ['--complexity', '--shape=deep', '--size=1000', '--steps=2', '--iterations=1', '-p', 'extract-function', '-p', 'vacuum']
+  run_command(cmd, expected_status=3, expected_err='[complexity] extract-function on deep failed', err_contains=True)
+  results = json.loads(run_command(cmd, expected_status=3, stderr=subprocess.PIPE))
+  passes = results['shapes'][0]['passes']
+  assert 'failed' in passes['extract-function'], passes
+  assert len(passes['vacuum']['seconds']) == 2, passes
+  # a pass that runs out of time is stopped, and reported as too slow, with
+  # the largest module saved
+  delete_from_orbit('complexity-deep-vacuum.wasm')
+  cmd = WASM_BENCH + ['--complexity', '--shape=deep', '--size=100000', '--steps=2', '--iterations=200', '--timeout=1', '-p', 'vacuum']
+  run_command(cmd, expected_status=2, expected_err='[complexity] vacuum on deep: took more than 1 seconds', err_contains=True)
+  assert os.path.exists('complexity-deep-vacuum.wasm')
+  delete_from_orbit('complexity-deep-vacuum.wasm')
+  passes = json.loads(run_command(cmd, expected_status=2, stderr=subprocess.PIPE))['shapes'][0]['passes']
+  assert passes['vacuum']['timeout'] == 1, passes
+  # the threads mode runs atomics, and a lock and turns built on wait and
+  # wake, on a shared memory; it fails if a counter comes out wrong
+  out = run_command(WASM_BENCH + ['--threads=2', '--size=10000', '--iterations=2'])
+  results = json.loads(out)
+  assert results['threads'] == 2, results
+  assert sorted(results['results'].keys()) == ['add', 'lock', 'turns'], results
+  for result in results['results'].values():
+    assert result['operations'] > 0, result
+
+
 def run_wasm_reduce_tests():
   print '\n[ checking wasm-reduce testcases]\n'
 
@@ -304,6 +447,22 @@ def run_wasm_reduce_tests():
       with open('a.wast') as seen:
         fail_if_not_identical_to_file(seen.read(), expected)
 
+  # in-process reduction, which runs passes in a forked child
+  print '\n[ checking wasm-reduce --in-process ]\n'
+  # the i64 lowering exits with an error on an i64 global, so that is kept
+  t = os.path.join(test_dir, 'in-process', 'i64-to-i32-lowering.wast')
+  run_command(WASM_AS + [t, '-o', 'a.wasm'])
+  run_command(WASM_REDUCE + ['a.wasm', '--in-process', '--i64-to-i32-lowering', '-t', 'b.wasm', '-w', 'c.wasm', '-b', options.binaryen_bin],
+              expected_err='[ProgramResult] code: 1 ', err_contains=True)
+  run_command(WASM_DIS + ['c.wasm', '-o', 'a.wast'])
+  with open('a.wast') as seen:
+    fail_if_not_identical_to_file(seen.read(), t + '.txt')
+  # extract-function aborts when BINARYEN_EXTRACT is not set, whatever the
+  # module, so that reduces to an empty module
+  run_command(WASM_REDUCE + ['a.wasm', '--in-process', '--extract-function', '-t', 'b.wasm', '-w', 'c.wasm', '-b', options.binaryen_bin],
+              expected_err='[ProgramResult] code: 134 ', err_contains=True) # 128 + SIGABRT
+  assert os.stat('c.wasm').st_size == 8, os.stat('c.wasm').st_size
+
   # run on a nontrivial fuzz testcase, for general coverage
   # this is very slow in ThreadSanitizer, so avoid it there
   if 'fsanitize=thread' not in str(os.environ):
@@ -658,6 +817,8 @@ def main():
   run_dylink_tests()
   run_ctor_eval_tests()
   run_wasm_metadce_tests()
+  run_wasm_split_tests()
+  run_wasm_bench_tests()
   if has_shell_timeout():
     run_wasm_reduce_tests()
 
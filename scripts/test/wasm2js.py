@@ -55,6 +55,11 @@ def test_wasm2js_output():
     out = run_command(cmd)
     fail_if_not_identical_to_file(out, expected_file)
 
+    # some tests also check the optimized output
+    if os.path.exists(expected_file + '.opt'):
+      out = run_command(cmd + ['-O'])
+      fail_if_not_identical_to_file(out, expected_file + '.opt')
+
     if not NODEJS and not MOZJS:
       print 'No JS interpreters. Skipping spec tests.'
       continue
@@ -0,0 +1,169 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A solver for gen/kill dataflow problems over the basic blocks of a
+// CFGWalker, using dense bitsets for the per-block state.
+//
+// The user fills in gen and kill for each block (indexed by the position
+// of the block in |blocks|), calls solve(), and reads the results from
+// start and end, which hold the state at the start and end of each block,
+// whichever the direction of the problem. The meet operation is union, so
+// this handles "may" problems over a small universe, like liveness, where
+// there is one bit per local.
+//
+// LocalGraph does not use it: it needs the sets of each local that reach
+// each get, and as a bitset problem that is one bit per set (plus one per
+// local for its initial value) in every block, which is too much memory on
+// large functions. LocalGraph instead walks back from each get only as far
+// as it must.
+//
+// Blocks are visited in reverse postorder for forward problems, and in
+// postorder for backward ones, which lets most values settle in a single
+// pass over acyclic regions of the CFG.
+//
+
+#ifndef cfg_bitset_dataflow_h
+#define cfg_bitset_dataflow_h
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+#include "wasm.h"
+#include "support/dense_bitset.h"
+
+namespace wasm {
+
+template<typename BasicBlock>
+struct BitsetDataflow {
+  enum Direction {
+    Forward,
+    Backward
+  };
+
+  std::vector<BasicBlock*> blocks;
+  std::vector<DenseBitset> gen, kill, start, end;
+
+  // |blocks| should contain all the blocks of interest; edges to blocks
+  // not in it are ignored.
+  BitsetDataflow(const std::vector<BasicBlock*>& blocks, Index size) : blocks(blocks) {
+    for (Index i = 0; i < blocks.size(); i++) {
+      indexes[blocks[i]] = i;
+    }
+    gen.resize(blocks.size(), DenseBitset(size));
+    kill.resize(blocks.size(), DenseBitset(size));
+    start.resize(blocks.size(), DenseBitset(size));
+    end.resize(blocks.size(), DenseBitset(size));
+  }
+
+  Index getIndex(BasicBlock* block) {
+    return indexes.at(block);
+  }
+
+  void solve(BasicBlock* entry, Direction direction) {
+    auto order = computeReversePostorder(entry);
+    if (direction == Backward) {
+      std::reverse(order.begin(), order.end());
+    }
+    // Map each block to its position in the visiting order, and note its
+    // neighbors in terms of those positions: inputs are the blocks whose
+    // state we meet, outputs the ones that must be revisited if ours
+    // changes.
+    std::vector<Index> position(blocks.size());
+    for (Index i = 0; i < order.size(); i++) {
+      position[order[i]] = i;
+    }
+    std::vector<std::vector<Index>> inputs(order.size()), outputs(order.size());
+    for (Index i = 0; i < order.size(); i++) {
+      auto* block = blocks[order[i]];
+      auto& preds = direction == Forward ? block->in : block->out;
+      for (auto* pred : preds) {
+        auto iter = indexes.find(pred);
+        if (iter == indexes.end()) continue;
+        auto p = position[iter->second];
+        inputs[i].push_back(p);
+        outputs[p].push_back(i);
+      }
+    }
+    auto& before = direction == Forward ? start : end;
+    auto& after = direction == Forward ? end : start;
+    // Sweep over the blocks in order, handling the ones marked dirty, until
+    // nothing changes. A change only forces another sweep if it dirties a
+    // block we already passed in this one.
+    std::vector<bool> dirty(order.size(), true);
+    bool again = true;
+    while (again) {
+      again = false;
+      for (Index i = 0; i < order.size(); i++) {
+        if (!dirty[i]) continue;
+        dirty[i] = false;
+        auto index = order[i];
+        for (auto p : inputs[i]) {
+          before[index].merge(after[order[p]]);
+        }
+        if (!after[index].transfer(gen[index], before[index], kill[index])) {
+          continue;
+        }
+        for (auto p : outputs[i]) {
+          dirty[p] = true;
+          if (p <= i) again = true;
+        }
+      }
+    }
+  }
+
+private:
+  std::unordered_map<BasicBlock*, Index> indexes;
+
+  // Returns block indexes in reverse postorder from the entry, followed by
+  // any blocks not reachable from it.
+  std::vector<Index> computeReversePostorder(BasicBlock* entry) {
+    std::vector<Index> order;
+    std::vector<bool> seen(blocks.size(), false);
+    // An explicit stack of (block, next successor to visit), as CFGs can
+    // be deep enough to overflow the native one.
+    std::vector<std::pair<Index, Index>> stack;
+    auto push = [&](Index index) {
+      seen[index] = true;
+      stack.emplace_back(index, 0);
+    };
+    auto iter = indexes.find(entry);
+    if (iter != indexes.end()) push(iter->second);
+    while (!stack.empty()) {
+      auto& top = stack.back();
+      auto& succs = blocks[top.first]->out;
+      if (top.second < succs.size()) {
+        auto found = indexes.find(succs[top.second++]);
+        if (found != indexes.end() && !seen[found->second]) {
+          push(found->second);
+        }
+      } else {
+        order.push_back(top.first);
+        stack.pop_back();
+      }
+    }
+    std::reverse(order.begin(), order.end());
+    for (Index i = 0; i < blocks.size(); i++) {
+      if (!seen[i]) order.push_back(i);
+    }
+    return order;
+  }
+};
+
+} // namespace wasm
+
+#endif // cfg_bitset_dataflow_h
@@ -22,10 +22,13 @@
 #define liveness_traversal_h
 
 #include "support/sorted_vector.h"
+#include "support/dense_bitset.h"
+#include "support/memory.h"
 #include "wasm.h"
 #include "wasm-builder.h"
 #include "wasm-traversal.h"
 #include "cfg-traversal.h"
+#include "bitset-dataflow.h"
 #include "ir/utils.h"
 
 namespace wasm {
@@ -158,6 +161,7 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
     numLocals = func->getNumLocals();
     copies.resize(numLocals * numLocals);
     std::fill(copies.begin(), copies.end(), 0);
+    MemoryProfile::note(MemoryProfile::Interferences, copies.size());
     totalCopies.resize(numLocals);
     std::fill(totalCopies.begin(), totalCopies.end(), 0);
     // create the CFG by walking the IR
@@ -169,7 +173,58 @@ struct LivenessWalker : public CFGWalker<SubType, VisitorType, Liveness> {
     flowLiveness();
   }
 
+  // Above this many words of bitset per block array, we flow sparse sets
+  // instead, as functions with very many locals tend to have few of them
+  // live at any point, and the dense sets would use too much memory.
+  static const size_t MaxDenseWords = 1 << 20;
+
   void flowLiveness() {
+    auto numBlocks = liveBlocks.size();
+    if (numBlocks * DenseBitset::numWords(numLocals) <= MaxDenseWords) {
+      flowLivenessDense();
+    } else {
+      flowLivenessSparse();
+    }
+  }
+
+  // Flows using bitsets, computing the gen (read before being written) and
+  // kill (written) locals of each block just once, then converts the
+  // results into LocalSets at the end.
+  void flowLivenessDense() {
+    std::vector<BasicBlock*> blocks;
+    for (auto& curr : CFGWalker<SubType, VisitorType, Liveness>::basicBlocks) {
+      if (liveBlocks.count(curr.get()) == 0) continue; // ignore dead blocks
+      blocks.push_back(curr.get());
+    }
+    BitsetDataflow<BasicBlock> flow(blocks, numLocals);
+    for (Index i = 0; i < blocks.size(); i++) {
+      auto& actions = blocks[i]->contents.actions;
+      auto& gen = flow.gen[i];
+      auto& kill = flow.kill[i];
+      for (int j = int(actions.size()) - 1; j >= 0; j--) {
+        auto& action = actions[j];
+        if (action.isGet()) {
+          gen.insert(action.index);
+          kill.erase(action.index);
+        } else if (action.isSet()) {
+          gen.erase(action.index);
+          kill.insert(action.index);
+        }
+      }
+    }
+    flow.solve(CFGWalker<SubType, VisitorType, Liveness>::entry, BitsetDataflow<BasicBlock>::Backward);
+    for (Index i = 0; i < blocks.size(); i++) {
+      auto& contents = blocks[i]->contents;
+      flow.start[i].forEach([&](Index index) {
+        contents.start.push_back(index);
+      });
+      flow.end[i].forEach([&](Index index) {
+        contents.end.push_back(index);
+      });
+    }
+  }
+
+  void flowLivenessSparse() {
     // keep working while stuff is flowing
     std::unordered_set<BasicBlock*> queue;
     for (auto& curr : CFGWalker<SubType, VisitorType, Liveness>::basicBlocks) {
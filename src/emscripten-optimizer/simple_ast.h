@@ -640,6 +640,10 @@ struct JSPrinter {
     return node->isArray() && node[0] == IF;
   }
 
+  bool isLabeledBlock(Ref node) {
+    return node->isArray() && node[0] == LABEL && isBlock(node[2]);
+  }
+
   void print(Ref node) {
     ensure();
     if (node->isString()) {
@@ -1236,14 +1240,18 @@ struct JSPrinter {
       emit('}');
     } else {
       print(node[2], "{}");
-      if (!isBlock(node[2])) emit(';');
+      // an if ends its own arms, as does a labeled block (and another ';'
+      // would end ours, leaving the else dangling)
+      if (!isBlock(node[2]) && !isIf(node[2]) && !isLabeledBlock(node[2])) {
+        emit(';');
+      }
     }
     if (hasElse) {
       space();
       emit("else");
       safeSpace();
       print(node[3], "{}");
-      if (!isBlock(node[3])) emit(';');
+      if (!isBlock(node[3]) && !isIf(node[3])) emit(';');
     }
   }
 
@@ -21,6 +21,7 @@
 #include <ir/find_all.h>
 #include <ir/local-graph.h>
 #include <cfg/cfg-traversal.h>
+#include <support/memory.h>
 
 namespace wasm {
 
@@ -208,6 +209,11 @@ struct Flower : public CFGWalker<Flower, Visitor<Flower>, Info> {
 
 // LocalGraph implementation
 
+// The approximate overhead of a node in a std::map or std::set, and in a
+// std::unordered_map or std::unordered_set, for memory profiling.
+static const size_t TreeNodeBytes = 4 * sizeof(void*);
+static const size_t HashNodeBytes = 2 * sizeof(void*);
+
 LocalGraph::LocalGraph(Function* func) {
   LocalGraphInternal::Flower flower(getSetses, locations, func);
 
@@ -223,6 +229,17 @@ LocalGraph::LocalGraph(Function* func) {
   }
   std::cout << "total locations: " << locations.size() << '\n';
 #endif
+
+  if (MemoryProfile::enabled) {
+    // Estimate what we allocated: the basic blocks (twice, as the flow
+    // converts them), an action in each for each location, and our maps.
+    size_t bytes = flower.basicBlocks.size() * 2 * sizeof(LocalGraphInternal::Flower::BasicBlock);
+    bytes += locations.size() * (TreeNodeBytes + sizeof(Locations::value_type) + 2 * sizeof(Expression*));
+    for (auto& pair : getSetses) {
+      bytes += TreeNodeBytes + sizeof(GetSetses::value_type) + pair.second.size() * (TreeNodeBytes + sizeof(SetLocal*));
+    }
+    MemoryProfile::note(MemoryProfile::LocalGraph, bytes);
+  }
 }
 
 void LocalGraph::computeInfluences() {
@@ -240,6 +257,16 @@ void LocalGraph::computeInfluences() {
       }
     }
   }
+  if (MemoryProfile::enabled) {
+    size_t bytes = 0;
+    for (auto& pair : getInfluences) {
+      bytes += HashNodeBytes + sizeof(pair) + pair.second.size() * (HashNodeBytes + sizeof(SetLocal*));
+    }
+    for (auto& pair : setInfluences) {
+      bytes += HashNodeBytes + sizeof(pair) + pair.second.size() * (HashNodeBytes + sizeof(GetLocal*));
+    }
+    MemoryProfile::note(MemoryProfile::LocalGraph, bytes);
+  }
 }
 
 } // namespace wasm
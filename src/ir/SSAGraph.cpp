@@ -0,0 +1,365 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+
+#include <support/utilities.h>
+#include <ir/ssa-graph.h>
+#include <cfg/cfg-traversal.h>
+
+namespace wasm {
+
+namespace SSAGraphInternal {
+
+// Information about a basic block.
+struct Info {
+  std::vector<Expression*> actions; // get_locals and set_locals, in order
+};
+
+// Builds the CFG and notes the gets and sets in each block.
+struct Scanner : public CFGWalker<Scanner, Visitor<Scanner>, Info> {
+  typedef CFGWalker<Scanner, Visitor<Scanner>, Info> Super;
+
+  std::unordered_map<Expression*, Expression**>& locations;
+
+  // Blocks that end in a conditional branch => the branch, and the successor
+  // reached when the condition is false.
+  std::unordered_map<BasicBlock*, std::pair<Expression**, BasicBlock*>> conditionalBranches;
+
+  Scanner(std::unordered_map<Expression*, Expression**>& locations, Function* func) : locations(locations) {
+    setFunction(func);
+    Super::doWalkFunction(func);
+    unlinkDeadBlocks(findLiveBlocks());
+  }
+
+  static void doVisitGetLocal(Scanner* self, Expression** currp) {
+    // if in unreachable code, skip
+    if (!self->currBasicBlock) return;
+    self->currBasicBlock->contents.actions.push_back(*currp);
+    self->locations[*currp] = currp;
+  }
+
+  static void doVisitSetLocal(Scanner* self, Expression** currp) {
+    // if in unreachable code, skip
+    if (!self->currBasicBlock) return;
+    self->currBasicBlock->contents.actions.push_back(*currp);
+    self->locations[*currp] = currp;
+  }
+
+  // Note conditional branches as the CFG is built.
+
+  static void doStartIfTrue(Scanner* self, Expression** currp) {
+    auto* last = self->currBasicBlock;
+    Super::doStartIfTrue(self, currp);
+    if (last) {
+      self->conditionalBranches[last].first = currp;
+    }
+  }
+
+  static void doStartIfFalse(Scanner* self, Expression** currp) {
+    Super::doStartIfFalse(self, currp);
+    auto* before = self->ifStack[self->ifStack.size() - 2];
+    if (before) {
+      self->conditionalBranches[before].second = self->currBasicBlock;
+    }
+  }
+
+  static void doEndIf(Scanner* self, Expression** currp) {
+    // Without an ifFalse, the block after the if is reached when false.
+    BasicBlock* before = nullptr;
+    if (!(*currp)->cast<If>()->ifFalse) {
+      before = self->ifStack.back();
+    }
+    Super::doEndIf(self, currp);
+    if (before) {
+      self->conditionalBranches[before].second = self->currBasicBlock;
+    }
+  }
+
+  static void doEndBreak(Scanner* self, Expression** currp) {
+    auto* last = self->currBasicBlock;
+    Super::doEndBreak(self, currp);
+    if (last && (*currp)->cast<Break>()->condition) {
+      self->conditionalBranches[last] = std::make_pair(currp, self->currBasicBlock);
+    }
+  }
+};
+
+} // namespace SSAGraphInternal
+
+SSAGraph::SSAGraph(Function* func) : func(func) {
+  initialValues.resize(func->getNumLocals());
+  // Build the CFG, and convert it into our blocks.
+  {
+    SSAGraphInternal::Scanner scanner(locations, func);
+    std::unordered_map<decltype(scanner)::BasicBlock*, Block*> blockMap;
+    for (auto& basicBlock : scanner.basicBlocks) {
+      blocks.push_back(make_unique<Block>());
+      auto* block = blocks.back().get();
+      blockMap[basicBlock.get()] = block;
+      block->actions.swap(basicBlock->contents.actions);
+    }
+    for (auto& basicBlock : scanner.basicBlocks) {
+      auto* block = blockMap[basicBlock.get()];
+      for (auto* pred : basicBlock->in) {
+        block->preds.push_back(blockMap[pred]);
+      }
+      for (auto* succ : basicBlock->out) {
+        block->succs.push_back(blockMap[succ]);
+      }
+    }
+    for (auto& pair : scanner.conditionalBranches) {
+      auto* block = blockMap[pair.first];
+      block->branch = pair.second.first;
+      block->ifFalse = blockMap[pair.second.second];
+    }
+    entry = blockMap[scanner.entry];
+  }
+  // Create the values of the sets, and note the value of each local at the
+  // end of each block where it is set.
+  for (auto& block : blocks) {
+    for (Index i = 0; i < block->actions.size(); i++) {
+      auto* action = block->actions[i];
+      positions[action] = std::make_pair(block.get(), i);
+      if (auto* set = action->dynCast<SetLocal>()) {
+        auto* value = makeValue(Value::Set, set->index);
+        value->set = set;
+        setValues[set] = value;
+        block->sets[set->index].emplace_back(i, value);
+        block->exitValues[set->index] = value;
+      }
+    }
+  }
+  // Find the value each get reads, creating phis as needed.
+  for (auto& block : blocks) {
+    std::unordered_map<Index, Value*> currValues;
+    for (auto* action : block->actions) {
+      if (auto* set = action->dynCast<SetLocal>()) {
+        currValues[set->index] = setValues[set];
+      } else {
+        auto* get = action->cast<GetLocal>();
+        Value* value;
+        auto iter = currValues.find(get->index);
+        if (iter != currValues.end()) {
+          value = iter->second;
+        } else {
+          value = getValueAtEntry(block.get(), get->index);
+        }
+        getValues[get] = value;
+        value->gets.insert(get);
+      }
+    }
+  }
+  completePhis();
+}
+
+SSAGraph::Value* SSAGraph::getValueBefore(Expression* curr, Index index) {
+  auto& position = positions.at(curr);
+  auto* block = position.first;
+  // Find the last set to the local before this point in the block.
+  auto iter = block->sets.find(index);
+  if (iter != block->sets.end()) {
+    auto& sets = iter->second;
+    auto after = std::lower_bound(sets.begin(), sets.end(), position.second,
+      [](const std::pair<Index, Value*>& set, Index i) {
+        return set.first < i;
+      });
+    if (after != sets.begin()) {
+      // If the set was removed, this finds what replaced it.
+      return resolve((after - 1)->second);
+    }
+  }
+  auto* value = getValueAtEntry(block, index);
+  completePhis();
+  return resolve(value);
+}
+
+void SSAGraph::redirectGet(GetLocal* get, Value* value) {
+  auto*& old = getValues.at(get);
+  old->gets.erase(get);
+  old = value;
+  value->gets.insert(get);
+  get->index = value->index;
+}
+
+void SSAGraph::removeGet(GetLocal* get) {
+  getValues.at(get)->gets.erase(get);
+  getValues.erase(get);
+  auto& position = positions.at(get);
+  position.first->actions[position.second] = nullptr;
+  positions.erase(get);
+  locations.erase(get);
+}
+
+void SSAGraph::removeSet(SetLocal* set) {
+  auto* value = setValues.at(set);
+  auto* before = getValueBefore(set, set->index);
+  replaceAllUses(value, before);
+  value->replacement = before;
+  setValues.erase(set);
+  auto& position = positions.at(set);
+  position.first->actions[position.second] = nullptr;
+  positions.erase(set);
+  locations.erase(set);
+}
+
+void SSAGraph::replaceAllUses(Value* value, Value* with) {
+  if (value == with) return;
+  for (auto* get : value->gets) {
+    getValues[get] = with;
+    with->gets.insert(get);
+    get->index = with->index;
+  }
+  value->gets.clear();
+  for (auto& pair : value->phiUsers) {
+    auto* user = pair.first;
+    for (auto*& operand : user->operands) {
+      if (operand == value) {
+        operand = with;
+      }
+    }
+    with->phiUsers[user] += pair.second;
+  }
+  value->phiUsers.clear();
+}
+
+SSAGraph::Value* SSAGraph::makeValue(Value::Kind kind, Index index) {
+  values.push_back(make_unique<Value>(kind, index));
+  return values.back().get();
+}
+
+SSAGraph::Value* SSAGraph::getInitialValue(Index index) {
+  auto*& value = initialValues[index];
+  if (!value) {
+    value = makeValue(func->isParam(index) ? Value::Param : Value::Zero, index);
+  }
+  return value;
+}
+
+SSAGraph::Value* SSAGraph::getValueAtEntry(Block* block, Index index) {
+  // Go back through blocks with a single predecessor, until we find a value
+  // or a merge. The value we find is the value in all the blocks along the way.
+  std::vector<Block*> chain;
+  Value* value;
+  auto* curr = block;
+  while (1) {
+    auto iter = curr->entryValues.find(index);
+    if (iter != curr->entryValues.end()) {
+      if (iter->second) {
+        value = resolve(iter->second);
+      } else {
+        // We are in a cycle that is not reachable from the entry.
+        value = getInitialValue(index);
+      }
+      break;
+    }
+    chain.push_back(curr);
+    if (curr->preds.empty()) {
+      // This is the entry, or unreachable code.
+      value = getInitialValue(index);
+      break;
+    }
+    if (curr->preds.size() == 1 && curr != entry) {
+      // Mark this block, so we notice if we are in a cycle.
+      curr->entryValues[index] = nullptr;
+      auto* pred = curr->preds[0];
+      auto exitIter = pred->exitValues.find(index);
+      if (exitIter != pred->exitValues.end()) {
+        value = resolve(exitIter->second);
+        break;
+      }
+      curr = pred;
+      continue;
+    }
+    // This is a merge. Create a phi, whose operands we fill in later; until
+    // then, it is the value here, which ends the search around loops.
+    value = makeValue(Value::Phi, index);
+    value->block = curr;
+    pendingPhis.push_back(value);
+    break;
+  }
+  for (auto* curr : chain) {
+    curr->entryValues[index] = value;
+  }
+  return value;
+}
+
+SSAGraph::Value* SSAGraph::getValueAtExit(Block* block, Index index) {
+  auto iter = block->exitValues.find(index);
+  if (iter != block->exitValues.end()) {
+    return resolve(iter->second);
+  }
+  return getValueAtEntry(block, index);
+}
+
+SSAGraph::Value* SSAGraph::resolve(Value* value) {
+  while (value->replacement) {
+    value = value->replacement;
+  }
+  return value;
+}
+
+void SSAGraph::completePhis() {
+  std::vector<Value*> phis;
+  while (!pendingPhis.empty()) {
+    auto* phi = pendingPhis.back();
+    pendingPhis.pop_back();
+    phis.push_back(phi);
+    auto addOperand = [&](Value* operand) {
+      phi->operands.push_back(operand);
+      operand->phiUsers[phi]++;
+    };
+    for (auto* pred : phi->block->preds) {
+      addOperand(getValueAtExit(pred, phi->index));
+    }
+    if (phi->block == entry) {
+      addOperand(getInitialValue(phi->index));
+    }
+  }
+  removeTrivialPhis(phis);
+}
+
+void SSAGraph::removeTrivialPhis(std::vector<Value*> work) {
+  while (!work.empty()) {
+    auto* phi = work.back();
+    work.pop_back();
+    if (phi->isRemoved()) continue;
+    // A phi is trivial if it merges a single value, besides itself.
+    Value* same = nullptr;
+    bool trivial = true;
+    for (auto* operand : phi->operands) {
+      if (operand == same || operand == phi) continue;
+      if (same) {
+        trivial = false;
+        break;
+      }
+      same = operand;
+    }
+    if (!trivial || !same) continue;
+    for (auto* operand : phi->operands) {
+      operand->phiUsers.erase(phi);
+    }
+    phi->operands.clear();
+    // Phis that used this one may now be trivial too.
+    for (auto& pair : phi->phiUsers) {
+      work.push_back(pair.first);
+    }
+    replaceAllUses(phi, same);
+    phi->replacement = same;
+  }
+}
+
+} // namespace wasm
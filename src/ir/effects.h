@@ -26,11 +26,13 @@ struct EffectAnalyzer : public PostWalker<EffectAnalyzer> {
   EffectAnalyzer(PassOptions& passOptions, Expression *ast = nullptr) {
     ignoreImplicitTraps = passOptions.ignoreImplicitTraps;
     debugInfo = passOptions.debugInfo;
+    funcEffectsMap = passOptions.funcEffectsMap.get();
     if (ast) analyze(ast);
   }
 
   bool ignoreImplicitTraps;
   bool debugInfo;
+  FuncEffectsMap* funcEffectsMap;
 
   void analyze(Expression *ast) {
     breakNames.clear();
@@ -178,6 +180,14 @@ struct EffectAnalyzer : public PostWalker<EffectAnalyzer> {
   }
 
   void visitCall(Call *curr) {
+    if (funcEffectsMap) {
+      auto iter = funcEffectsMap->find(curr->target);
+      if (iter != funcEffectsMap->end()) {
+        // we know exactly what the call may do
+        mergeIn(iter->second);
+        return;
+      }
+    }
     calls = true;
     if (debugInfo) {
       // debugInfo call imports must be preserved very strongly, do not
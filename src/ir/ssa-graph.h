@@ -0,0 +1,147 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef wasm_ir_ssa_graph_h
+#define wasm_ir_ssa_graph_h
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "wasm.h"
+
+namespace wasm {
+
+//
+// An SSA view of a function, kept on the side of the IR: every set_local
+// defines a value, every get_local reads exactly one value, and where
+// control flow merges different values of a local, a phi value merges them.
+// Unlike LocalGraph, which maps each get to the set of sets that may reach
+// it, this gives each get a single definition, and records the users of each
+// value, so sparse algorithms can propagate along def-use chains.
+//
+// The graph is built in roughly linear time, following "Simple and Efficient
+// Construction of Static Single Assignment Form" (Braun et al.), and only
+// creates phis for locals that are actually read. Trivial phis (that merge
+// a single value) are removed.
+//
+// The IR is not modified. Passes that modify the IR must tell the graph about
+// it using the editing methods below, so it stays valid.
+//
+// Gets and sets in unreachable code are not in the graph.
+//
+struct SSAGraph {
+  struct Block;
+
+  struct Value {
+    enum Kind {
+      Param, // the incoming value of a param
+      Zero,  // the initial zero value of a var
+      Set,   // the value written by a set_local or tee_local
+      Phi    // a merge of values at the start of a block
+    };
+
+    Kind kind;
+    Index index; // the local this is a value of
+    SetLocal* set = nullptr; // for a Set
+    Block* block = nullptr; // for a Phi
+    // For a Phi, the incoming value from each predecessor of the block.
+    std::vector<Value*> operands;
+
+    // The gets that read this value.
+    std::unordered_set<GetLocal*> gets;
+    // The phis that have this value as an operand, and how many times.
+    std::unordered_map<Value*, Index> phiUsers;
+
+    // If this value was removed, what replaced it.
+    Value* replacement = nullptr;
+
+    Value(Kind kind, Index index) : kind(kind), index(index) {}
+
+    bool isRemoved() { return replacement != nullptr; }
+    bool hasUses() { return !gets.empty() || !phiUsers.empty(); }
+  };
+
+  struct Block {
+    std::vector<Block*> preds, succs;
+    // The gets and sets in this block, in order. Removed sets are null.
+    std::vector<Expression*> actions;
+    // The value of each local at the start and end of the block, where known.
+    std::unordered_map<Index, Value*> entryValues, exitValues;
+    // For each local, the positions in actions of the sets to it, and
+    // their values.
+    std::unordered_map<Index, std::vector<std::pair<Index, Value*>>> sets;
+    // If the block ends in a conditional branch (an if or a br_if), where
+    // that is, and the successor reached when the condition is false. The
+    // other successors are reached when it is true.
+    Expression** branch = nullptr;
+    Block* ifFalse = nullptr;
+  };
+
+  SSAGraph(Function* func);
+
+  Function* func;
+
+  std::vector<std::unique_ptr<Block>> blocks;
+  Block* entry;
+
+  // All the values. Removed values remain here, but are not used.
+  std::vector<std::unique_ptr<Value>> values;
+
+  std::unordered_map<GetLocal*, Value*> getValues; // the value each get reads
+  std::unordered_map<SetLocal*, Value*> setValues; // the value each set writes
+  // where each get and set is (for easy replacing)
+  std::unordered_map<Expression*, Expression**> locations;
+
+  Value* getValue(GetLocal* get) { return getValues.at(get); }
+  Value* getValue(SetLocal* set) { return setValues.at(set); }
+
+  // Returns the value a local has at the point right before an expression,
+  // which must be a get or set in the graph. This may add phis.
+  Value* getValueBefore(Expression* curr, Index index);
+
+  // Editing.
+
+  // Notes that a get now reads another value, which must be the value of
+  // that local at the get, and updates the get's index to match.
+  void redirectGet(GetLocal* get, Value* value);
+  // Notes that a get was removed from the IR.
+  void removeGet(GetLocal* get);
+  // Notes that a set was removed from the IR. Any users of its value now use
+  // the value the local had before it.
+  void removeSet(SetLocal* set);
+  // Makes all users of a value use another one instead.
+  void replaceAllUses(Value* value, Value* with);
+
+private:
+  std::vector<Value*> initialValues;
+  std::unordered_map<Expression*, std::pair<Block*, Index>> positions;
+  // Phis whose operands are not yet known.
+  std::vector<Value*> pendingPhis;
+
+  Value* makeValue(Value::Kind kind, Index index);
+  Value* getInitialValue(Index index);
+  Value* getValueAtEntry(Block* block, Index index);
+  Value* getValueAtExit(Block* block, Index index);
+  Value* resolve(Value* value);
+  void completePhis();
+  void removeTrivialPhis(std::vector<Value*> phis);
+};
+
+} // namespace wasm
+
+#endif // wasm_ir_ssa_graph_h
@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <cassert>
+#include <cstdint>
 #include <cstdlib>
 #include <memory>
 #include <mutex>
@@ -26,6 +27,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "support/memory.h"
+
 //
 // Arena allocation for mixed-type data.
 //
@@ -116,6 +119,7 @@ struct MixedArena {
       if (allocated) delete allocated;
       return curr->allocSpace(size, align);
     }
+    wasm::MemoryProfile::note(wasm::MemoryProfile::Arena, size);
     // First, move the current index in the last chunk to an aligned position.
     index = (index + align - 1) & (-align);
     if (index + size > CHUNK_SIZE || chunks.size() == 0) {
@@ -162,8 +166,10 @@ template<typename SubType, typename T>
 class ArenaVectorBase {
 protected:
   T* data = nullptr;
-  size_t usedElements = 0,
-         allocatedElements = 0;
+  // these vectors hold the children of expressions, so 32 bits are plenty,
+  // and keep the expressions that contain them smaller
+  uint32_t usedElements = 0,
+           allocatedElements = 0;
 
   void reallocate(size_t size) {
     T* old = data;
@@ -18,6 +18,7 @@
 #define wasm_pass_h
 
 #include <functional>
+#include <memory>
 
 #include "wasm.h"
 #include "wasm-traversal.h"
@@ -27,6 +28,11 @@
 namespace wasm {
 
 class Pass;
+struct EffectAnalyzer;
+
+// Summaries of the side effects of calling each function, see
+// GenerateFunctionEffects.
+typedef std::unordered_map<Name, EffectAnalyzer> FuncEffectsMap;
 
 //
 // Global registry of all passes in /passes/
@@ -64,6 +70,22 @@ struct PassOptions {
   bool ignoreImplicitTraps = false; // optimize assuming things like div by 0, bad load/store, will not trap
   bool debugInfo = false; // whether to try to preserve debug info through, which are special calls
   FeatureSet features = Feature::MVP; // Which wasm features to accept, and be allowed to use
+  // Whether the binary writer will do the Stack IR optimizations (see
+  // WasmBinaryWriter::setOptimizeStackIR), so the default pipeline need not
+  // generate and keep Stack IR for every function until then.
+  bool optimizeStackIRInWriter = false;
+  // Effects of calling each function, if they were computed. When present,
+  // EffectAnalyzer uses them instead of assuming a call may do anything.
+  // The PassRunner discards them before running a pass that does not declare
+  // that it preserves them (see Pass::preservesFunctionEffects).
+  std::shared_ptr<FuncEffectsMap> funcEffectsMap;
+  // Budgets for expensive passes (see Pass::isExpensive) on each function,
+  // beyond which they are skipped or downgraded on that function: a number
+  // of expressions, and the seconds this runner has spent on the function so
+  // far. 0 means no limit. Note that a time limit makes the output depend on
+  // the speed of the machine.
+  Index expensivePassSizeLimit = 0;
+  double expensivePassTimeLimit = 0;
 
   void setDefaultOptimizationOptions() {
     // -Os is our default
@@ -185,7 +207,12 @@ private:
   void doAdd(Pass* pass);
 
   void runPass(Pass* pass);
-  void runPassOnFunction(Pass* pass, Function* func);
+  // Runs a function-parallel pass on a function, given the seconds spent
+  // running passes on it so far, which this updates.
+  void runPassOnFunction(Pass* pass, Function* func, double& seconds);
+  // Returns why a function is over the budgets for expensive passes, or an
+  // empty string if it is not.
+  std::string getBudgetExcess(Function* func, double seconds);
 
   // After running a pass, handle any changes due to
   // how the pass is defined, such as clearing away any
@@ -194,6 +221,10 @@ private:
   // If a function is passed, we operate just on that function;
   // otherwise, the whole module.
   void handleAfterEffects(Pass* pass, Function* func=nullptr);
+
+  // Before running a pass, discard anything it may invalidate, like function
+  // effects summaries.
+  void handleBeforeEffects(Pass* pass);
 };
 
 //
@@ -250,6 +281,23 @@ public:
   // out any Stack IR - it would need to be regenerated and optimized.
   virtual bool modifiesBinaryenIR() { return true; }
 
+  // Whether this pass never adds effects to existing functions, so that the
+  // summaries in PassOptions::funcEffectsMap stay valid (if it only removes
+  // or moves code, say). If not, the PassRunner discards them before running
+  // the pass. Instrumentation and lowering passes add calls and global
+  // accesses, for example.
+  virtual bool preservesFunctionEffects() { return !modifiesBinaryenIR(); }
+
+  // Whether this function-parallel pass may take much more than linear time
+  // on a large function. The PassRunner does not run such passes in full on
+  // functions over the budgets in PassOptions.
+  virtual bool isExpensive() { return false; }
+
+  // For an expensive pass, creates a cheaper pass that does part of its work,
+  // to run on functions over the budgets instead. If there is none, the pass
+  // is skipped on them.
+  virtual Pass* createDowngraded() { return nullptr; }
+
   std::string name;
 
 protected:
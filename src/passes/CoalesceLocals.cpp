@@ -32,6 +32,7 @@
 #include "cfg/liveness-traversal.h"
 #include "wasm-builder.h"
 #include "support/learning.h"
+#include "support/memory.h"
 #include "support/permutations.h"
 #ifdef CFG_PROFILE
 #include "support/timing.h"
@@ -41,9 +42,13 @@ namespace wasm {
 
 struct CoalesceLocals : public WalkerPass<LivenessWalker<CoalesceLocals, Visitor<CoalesceLocals>>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new CoalesceLocals; }
 
+  // Interference is quadratic in the number of locals.
+  bool isExpensive() override { return true; }
+
   // main entry point
 
   void doWalkFunction(Function* func);
@@ -118,6 +123,7 @@ void CoalesceLocals::increaseBackEdgePriorities() {
 void CoalesceLocals::calculateInterferences() {
   interferences.resize(numLocals * numLocals);
   std::fill(interferences.begin(), interferences.end(), false);
+  MemoryProfile::note(MemoryProfile::Interferences, interferences.size() / 8);
   for (auto& curr : basicBlocks) {
     if (liveBlocks.count(curr.get()) == 0) continue; // ignore dead blocks
     // everything coming in might interfere, as it might come from a different block
@@ -259,6 +265,7 @@ void CoalesceLocals::pickIndicesFromOrder(std::vector<Index>& order, std::vector
       newCopies[found * numLocals + j] += getCopies(actual, j);
     }
   }
+  MemoryProfile::note(MemoryProfile::Interferences, newInterferences.size() / 8 + newCopies.size());
 }
 
 // given a baseline order, adjust it based on an important order of priorities (higher values
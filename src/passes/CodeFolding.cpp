@@ -83,9 +83,13 @@ struct ExpressionMarker : public PostWalker<ExpressionMarker, UnifiedExpressionV
 
 struct CodeFolding : public WalkerPass<ControlFlowWalker<CodeFolding>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new CodeFolding; }
 
+  // Comparing tails can be quadratic in the number of them.
+  bool isExpensive() override { return true; }
+
   // information about a "tail" - code that reaches a point that we can
   // merge (e.g., a branch and some code leading up to it)
   struct Tail {
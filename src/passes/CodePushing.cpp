@@ -218,6 +218,7 @@ private:
 
 struct CodePushing : public WalkerPass<PostWalker<CodePushing>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new CodePushing; }
 
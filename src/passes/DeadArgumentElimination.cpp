@@ -27,12 +27,20 @@
 //    If so, we can avoid even sending and receiving it. (Note how if
 //    the previous point was true for an argument, then the second
 //    must as well.)
+//  * Find functions whose result is dropped at every call site. If so,
+//    we can stop returning it.
+//  * Find functions that always return the same constant. If so, we
+//    can apply that constant in the callers, and stop returning it.
+//
+// As each of those can open up more opportunities, in particular when
+// we optimize the changed functions, we iterate until nothing changes.
 //
 // This pass does not depend on flattening, but it may be more effective,
 // as then call arguments never have side effects (which we need to
 // watch for here).
 //
 
+#include <algorithm>
 #include <unordered_map>
 #include <unordered_set>
 
@@ -41,7 +49,10 @@
 #include "wasm-builder.h"
 #include "cfg/cfg-traversal.h"
 #include "ir/effects.h"
+#include "ir/find_all.h"
 #include "ir/module-utils.h"
+#include "ir/properties.h"
+#include "ir/utils.h"
 #include "passes/opt-utils.h"
 #include "support/sorted_vector.h"
 
@@ -53,6 +64,10 @@ struct DAEFunctionInfo {
   SortedVector unusedParams;
   // Maps a function name to the calls going to it.
   std::unordered_map<Name, std::vector<Call*>> calls;
+  // Maps each call to where it is.
+  std::unordered_map<Call*, Expression**> callLocations;
+  // Maps calls whose result is dropped to where the drop is.
+  std::unordered_map<Call*, Expression**> droppedCalls;
   // Whether the function can be called from places that
   // affect what we can do. For now, any call we don't
   // see inhibits our optimizations, but TODO: an export
@@ -113,6 +128,13 @@ struct DAEScanner : public WalkerPass<CFGWalker<DAEScanner, Visitor<DAEScanner>,
   void visitCall(Call* curr) {
     if (!getModule()->getFunction(curr->target)->imported()) {
       info->calls[curr->target].push_back(curr);
+      info->callLocations[curr] = getCurrentPointer();
+    }
+  }
+
+  void visitDrop(Drop* curr) {
+    if (auto* call = curr->value->dynCast<Call>()) {
+      info->droppedCalls[call] = getCurrentPointer();
     }
   }
 
@@ -194,9 +216,16 @@ struct DAEScanner : public WalkerPass<CFGWalker<DAEScanner, Visitor<DAEScanner>,
 };
 
 struct DAE : public Pass {
+  bool preservesFunctionEffects() override { return true; }
   bool optimize = false;
 
   void run(PassRunner* runner, Module* module) override {
+    while (iteration(runner, module)) {}
+  }
+
+  // Returns whether we changed anything that may open up more
+  // opportunities.
+  bool iteration(PassRunner* runner, Module* module) {
     DAEFunctionInfoMap infoMap;
     // Ensure they all exist so the parallel threads don't modify the data structure.
     ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
@@ -222,14 +251,23 @@ struct DAE : public Pass {
     }
     // Combine all the info.
     std::unordered_map<Name, std::vector<Call*>> allCalls;
+    std::unordered_map<Call*, Expression**> allCallLocations;
+    std::unordered_map<Call*, Expression**> allDroppedCalls;
+    std::unordered_map<Call*, Name> callers;
     for (auto& pair : infoMap) {
+      auto caller = pair.first;
       auto& info = pair.second;
       for (auto& pair : info.calls) {
         auto name = pair.first;
         auto& calls = pair.second;
         auto& allCallsToName = allCalls[name];
         allCallsToName.insert(allCallsToName.end(), calls.begin(), calls.end());
+        for (auto* call : calls) {
+          callers[call] = caller;
+        }
       }
+      allCallLocations.insert(info.callLocations.begin(), info.callLocations.end());
+      allDroppedCalls.insert(info.droppedCalls.begin(), info.droppedCalls.end());
     }
     // We now have a mapping of all call sites for each function. Check which
     // are always passed the same constant for a particular argument.
@@ -242,6 +280,9 @@ struct DAE : public Pass {
       auto* func = module->getFunction(name);
       auto numParams = func->getNumParams();
       for (Index i = 0; i < numParams; i++) {
+        // If we already applied a constant, or it is unused anyhow, there
+        // is nothing to do.
+        if (infoMap[name].unusedParams.has(i)) continue;
         Literal value;
         for (auto* call : calls) {
           assert(call->target == name);
@@ -278,6 +319,43 @@ struct DAE : public Pass {
     }
     // Track which functions we changed, and optimize them later if necessary.
     std::unordered_set<Function*> changed;
+    // See which results we can remove. We first update all the call sites,
+    // while the locations we noted are still valid, and only then the
+    // functions themselves. This must happen before we remove parameters,
+    // as removing operands moves the other operands of the calls.
+    std::vector<Function*> removeResults;
+    Builder builder(*module);
+    for (auto& pair : allCalls) {
+      auto name = pair.first;
+      auto& calls = pair.second;
+      if (infoMap[name].hasUnseenCalls) continue;
+      auto* func = module->getFunction(name);
+      if (func->result == none) continue;
+      bool allDropped = std::all_of(calls.begin(), calls.end(), [&](Call* call) {
+        return allDroppedCalls.count(call) > 0;
+      });
+      if (allDropped) {
+        // Nothing uses the result, so the calls no longer need to be dropped.
+        for (auto* call : calls) {
+          *allDroppedCalls[call] = call;
+        }
+      } else {
+        auto value = getReturnedConstant(func);
+        if (value.type == none) continue;
+        // Apply the constant in the callers, after the call.
+        for (auto* call : calls) {
+          // If the call is unreachable, there is no value to apply.
+          if (call->type == unreachable) continue;
+          *allCallLocations[call] = builder.makeSequence(call, builder.makeConst(value));
+          changed.insert(module->getFunction(callers[call]));
+        }
+      }
+      removeResults.push_back(func);
+    }
+    for (auto* func : removeResults) {
+      removeResult(func, allCalls[func->name], module);
+      changed.insert(func);
+    }
     // We now know which parameters are unused, and can potentially remove them.
     for (auto& pair : allCalls) {
       auto name = pair.first;
@@ -314,6 +392,11 @@ struct DAE : public Pass {
     if (optimize && changed.size() > 0) {
       OptUtils::optimizeAfterInlining(changed, module, runner);
     }
+    // Removing parameters does not open up new opportunities by itself,
+    // but optimizing after it may. Removing results may allow removing
+    // more results, as calls to other functions in return position are
+    // now dropped.
+    return !removeResults.empty() || (optimize && changed.size() > 0);
   }
 
 private:
@@ -354,6 +437,50 @@ private:
       call->operands.erase(call->operands.begin() + i);
     }
   }
+
+  // If the function always returns the same constant, returns it;
+  // otherwise, returns a literal of type none.
+  Literal getReturnedConstant(Function* func) {
+    Literal value;
+    bool failed = false;
+    auto note = [&](Expression* curr) {
+      auto* c = Properties::getFallthrough(curr)->dynCast<Const>();
+      if (!c || (value.type != none && value != c->value)) {
+        failed = true;
+      } else {
+        value = c->value;
+      }
+    };
+    for (auto* ret : FindAll<Return>(func->body).list) {
+      note(ret->value);
+    }
+    if (func->body->type != unreachable) {
+      note(func->body);
+    }
+    if (failed) return Literal();
+    return value;
+  }
+
+  void removeResult(Function* func, std::vector<Call*>& calls, Module* module) {
+    // Clear the type, which is no longer accurate.
+    func->type = Name();
+    func->result = none;
+    // Returns become plain exits, keeping any side effects of their values.
+    Builder builder(*module);
+    for (auto** currp : FindAllPointers<Return>(func->body).list) {
+      auto* ret = (*currp)->cast<Return>();
+      *currp = builder.makeSequence(builder.makeDrop(ret->value), ret);
+      ret->value = nullptr;
+    }
+    if (isConcreteType(func->body->type)) {
+      func->body = builder.makeDrop(func->body);
+    }
+    ReFinalize().walkFunctionInModule(func, module);
+    for (auto* call : calls) {
+      call->type = none;
+      call->finalize();
+    }
+  }
 };
 
 Pass *createDAEPass() {
@@ -40,6 +40,7 @@ namespace wasm {
 
 struct DeadCodeElimination : public WalkerPass<PostWalker<DeadCodeElimination>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new DeadCodeElimination; }
 
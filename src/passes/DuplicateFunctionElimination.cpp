@@ -50,6 +50,7 @@ private:
 };
 
 struct DuplicateFunctionElimination : public Pass {
+  bool preservesFunctionEffects() override { return true; }
   void run(PassRunner* runner, Module* module) override {
     // Multiple iterations may be necessary: A and B may be identical only after we
     // see the functions C1 and C2 that they call are in fact identical. Rarely, such
@@ -76,6 +76,7 @@ namespace wasm {
 // placeholder. We will never reach that (unreachable) anyhow
 struct Flatten : public WalkerPass<ExpressionStackWalker<Flatten, UnifiedExpressionVisitor<Flatten>>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new Flatten; }
 
@@ -26,12 +26,24 @@
 //
 // This should work even with dynamic linking, however, the number of
 // params must be identical, i.e., the "ABI" must match.
+//
+// When the table is not imported or exported and has constant segment
+// offsets, we know its full contents, and can avoid the emulated ABI where
+// the signature provably matches: an indirect call to a constant index
+// becomes a direct call to the function there (or to its thunk, if the
+// signatures differ), and if every table entry and every indirect call has
+// the same signature, no cast can happen, and nothing needs to be emulated.
+// With --debug, the number of indirect calls that stay on such a fast path
+// is reported.
+
+#include <atomic>
 
 #include <wasm.h>
 #include <wasm-builder.h>
 #include <asm_v_wasm.h>
 #include <pass.h>
 #include <wasm-emscripten.h>
+#include <ir/find_all.h>
 #include <ir/literal-utils.h>
 
 namespace wasm {
@@ -122,18 +134,49 @@ static Expression* fromABI(Expression* value, Type type, Module* module) {
   return value;
 }
 
+// The known contents of the table, if nothing outside of the module can see
+// or modify it.
+struct TableContents {
+  bool known = false;
+  // The function at each index, or a null name if there is none.
+  std::vector<Name> slots;
+};
+
+// Shared state for the parallel part of the pass.
+struct EmulationInfo {
+  // the name of a type for a call with the right params and return
+  Name ABIType;
+  TableContents table;
+  // the thunk for each function in the table
+  std::unordered_map<Name, Name> funcThunks;
+  std::atomic<Index> numFastCalls;
+};
+
 struct ParallelFuncCastEmulation : public WalkerPass<PostWalker<ParallelFuncCastEmulation>> {
   bool isFunctionParallel() override { return true; }
 
-  Pass* create() override { return new ParallelFuncCastEmulation(ABIType); }
+  Pass* create() override { return new ParallelFuncCastEmulation(info); }
 
-  ParallelFuncCastEmulation(Name ABIType) : ABIType(ABIType) {}
+  ParallelFuncCastEmulation(EmulationInfo* info) : info(info) {}
 
   void visitCallIndirect(CallIndirect* curr) {
     if (curr->operands.size() > NUM_PARAMS) {
       Fatal() << "FuncCastEmulation::NUM_PARAMS needs to be at least " <<
                  curr->operands.size();
     }
+    Builder builder(*getModule());
+    // If we know which function is called, call it directly.
+    Name target = getKnownTarget(curr);
+    if (target.is()) {
+      auto* func = getModule()->getFunction(target);
+      if (getSig(func) == getSig(getModule()->getFunctionType(curr->fullType))) {
+        auto* call = builder.makeCall(target, curr->operands, curr->type);
+        call->finalize();
+        replaceCurrent(call);
+        info->numFastCalls++;
+        return;
+      }
+    }
     for (Expression*& operand : curr->operands) {
       operand = toABI(operand, getModule());
     }
@@ -141,33 +184,66 @@ struct ParallelFuncCastEmulation : public WalkerPass<PostWalker<ParallelFuncCast
     while (curr->operands.size() < NUM_PARAMS) {
       curr->operands.push_back(LiteralUtils::makeZero(i64, *getModule()));
     }
-    // Set the new types
-    curr->fullType = ABIType;
     auto oldType = curr->type;
-    curr->type = i64;
-    curr->finalize(); // may be unreachable
+    Expression* call;
+    if (target.is()) {
+      // The signature doesn't match, but we can still call the thunk directly.
+      auto* direct = builder.makeCall(info->funcThunks.at(target), curr->operands, i64);
+      direct->finalize();
+      call = direct;
+    } else {
+      // Set the new types
+      curr->fullType = info->ABIType;
+      curr->type = i64;
+      curr->finalize(); // may be unreachable
+      call = curr;
+    }
     // Fix up return value
-    replaceCurrent(fromABI(curr, oldType, getModule()));
+    replaceCurrent(fromABI(call, oldType, getModule()));
   }
 
 private:
-  // the name of a type for a call with the right params and return
-  Name ABIType;
+  EmulationInfo* info;
+
+  Name getKnownTarget(CallIndirect* curr) {
+    auto& table = info->table;
+    if (!table.known) return Name();
+    auto* c = curr->target->dynCast<Const>();
+    if (!c) return Name();
+    auto index = c->value.geti32();
+    if (index < 0 || size_t(index) >= table.slots.size()) return Name();
+    return table.slots[index];
+  }
 };
 
 struct FuncCastEmulation : public Pass {
   void run(PassRunner* runner, Module* module) override {
-    // we just need the one ABI function type for all indirect calls
-    std::string sig = "j";
-    for (Index i = 0; i < NUM_PARAMS; i++) {
-      sig += 'j';
+    auto table = getTableContents(module);
+    // If no call can have a mismatched signature, there is nothing to do.
+    bool needed = !table.known || hasMismatch(module, table);
+    if (needed) {
+      // we just need the one ABI function type for all indirect calls
+      std::string sig = "j";
+      for (Index i = 0; i < NUM_PARAMS; i++) {
+        sig += 'j';
+      }
+      ABIType = ensureFunctionType(sig, module)->name;
     }
-    ABIType = ensureFunctionType(sig, module)->name;
     // Add a way for JS to call into the table (as our i64 ABI means an i64
     // is returned when there is a return value, which JS engines will fail on),
     // using dynCalls
     EmscriptenGlueGenerator generator(*module);
     generator.generateDynCallThunks();
+    Index numCalls = 0;
+    for (auto& func : module->functions) {
+      if (!func->imported()) {
+        numCalls += FindAll<CallIndirect>(func->body).list.size();
+      }
+    }
+    if (!needed) {
+      report(runner, numCalls, numCalls);
+      return;
+    }
     // Add a thunk for each function in the table, and do the call through it.
     std::unordered_map<Name, Name> funcThunks;
     for (auto& segment : module->table.segments) {
@@ -183,16 +259,72 @@ struct FuncCastEmulation : public Pass {
       }
     }
     // update call_indirects
+    EmulationInfo info;
+    info.ABIType = ABIType;
+    info.table = std::move(table);
+    info.funcThunks = std::move(funcThunks);
+    info.numFastCalls = 0;
     PassRunner subRunner(module, runner->options);
     subRunner.setIsNested(true);
-    subRunner.add<ParallelFuncCastEmulation>(ABIType);
+    subRunner.add<ParallelFuncCastEmulation>(&info);
     subRunner.run();
+    report(runner, info.numFastCalls, numCalls);
   }
 
 private:
   // the name of a type for a call with the right params and return
   Name ABIType;
 
+  static TableContents getTableContents(Module* module) {
+    TableContents contents;
+    if (!module->table.exists || module->table.imported()) return contents;
+    for (auto& curr : module->exports) {
+      if (curr->kind == ExternalKind::Table) return contents;
+    }
+    for (auto& segment : module->table.segments) {
+      auto* offset = segment.offset->dynCast<Const>();
+      if (!offset) return contents;
+      // A segment out of the bounds of the table fails to instantiate, so
+      // do not assume anything about it.
+      auto value = offset->value.geti32();
+      if (value < 0 || uint64_t(value) + segment.data.size() > module->table.initial) {
+        return contents;
+      }
+      size_t start = value;
+      if (start + segment.data.size() > contents.slots.size()) {
+        contents.slots.resize(start + segment.data.size());
+      }
+      for (Index i = 0; i < segment.data.size(); i++) {
+        contents.slots[start + i] = segment.data[i];
+      }
+    }
+    contents.known = true;
+    return contents;
+  }
+
+  // Checks if an indirect call may reach a function with another signature.
+  static bool hasMismatch(Module* module, const TableContents& table) {
+    std::set<std::string> sigs;
+    for (auto& name : table.slots) {
+      if (name.is()) {
+        sigs.insert(getSig(module->getFunction(name)));
+      }
+    }
+    for (auto& func : module->functions) {
+      if (func->imported()) continue;
+      for (auto* call : FindAll<CallIndirect>(func->body).list) {
+        sigs.insert(getSig(module->getFunctionType(call->fullType)));
+      }
+    }
+    return sigs.size() > 1;
+  }
+
+  static void report(PassRunner* runner, Index numFastCalls, Index numCalls) {
+    if (!runner->options.debug) return;
+    std::cerr << "[fpcast-emu] " << numFastCalls << " of " << numCalls
+              << " indirect calls stayed on the fast path\n";
+  }
+
   // Creates a thunk for a function, casting args and return value as needed.
   Name makeThunk(Name name, Module* module) {
     Name thunk = std::string("byn$fpcast-emu$") + name.str;
@@ -0,0 +1,229 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Computes a summary of the side effects of calling each function, and
+// stores them in the pass options, where EffectAnalyzer will find them.
+// Without them a call is assumed to do anything at all, which stops
+// code motion and CSE at every call, even to a small getter.
+//
+// The summaries are computed in parallel for each function body, and then
+// combined bottom-up over the strongly connected components of the call
+// graph, so that each function includes the effects of everything it may
+// call. Recursion is considered a branch, as the call may never return.
+//
+// The summaries stay valid through passes that declare that they do not add
+// effects to existing functions (Pass::preservesFunctionEffects), which the
+// normal optimization passes do. The PassRunner discards them before any
+// other pass, like instrumentation or lowering, which may add calls to
+// imports or accesses to globals. discard-function-effects discards them
+// explicitly.
+//
+
+#include <memory>
+
+#include <wasm.h>
+#include <pass.h>
+#include <ir/effects.h>
+
+namespace wasm {
+
+struct FunctionInfo {
+  // effects of the function body itself, not including local state, and
+  // not including calls to other defined functions
+  std::unique_ptr<EffectAnalyzer> effects;
+  // defined functions that may be called directly
+  std::set<Name> callees;
+};
+
+typedef std::map<Name, FunctionInfo> FunctionInfoMap;
+
+struct FunctionEffectsScanner : public WalkerPass<PostWalker<FunctionEffectsScanner>> {
+  bool isFunctionParallel() override { return true; }
+
+  FunctionEffectsScanner(FunctionInfoMap* infos) : infos(infos) {}
+
+  FunctionEffectsScanner* create() override {
+    return new FunctionEffectsScanner(infos);
+  }
+
+  void doWalkFunction(Function* func) {
+    info = &infos->at(func->name);
+    info->effects.reset(new EffectAnalyzer(getPassOptions(), func->body));
+    auto& effects = *info->effects;
+    // locals are not noticeable by the caller, and neither are returns
+    effects.localsRead.clear();
+    effects.localsWritten.clear();
+    effects.branches = false;
+    // we note below the things that do matter to the caller
+    effects.calls = false;
+    walk(func->body);
+  }
+
+  void visitCall(Call* curr) {
+    if (getModule()->getFunction(curr->target)->imported()) {
+      info->effects->calls = true;
+      if (getPassOptions().debugInfo) {
+        info->effects->branches = true;
+      }
+    } else {
+      info->callees.insert(curr->target);
+    }
+  }
+  void visitCallIndirect(CallIndirect* curr) {
+    info->effects->calls = true;
+  }
+  void visitHost(Host* curr) {
+    info->effects->calls = true;
+  }
+  void visitUnreachable(Unreachable* curr) {
+    info->effects->branches = true;
+  }
+  void visitLoop(Loop* curr) {
+    // a loop may not terminate, so the call may never return
+    info->effects->branches = true;
+  }
+
+private:
+  FunctionInfoMap* infos;
+  FunctionInfo* info;
+};
+
+struct GenerateFunctionEffects : public Pass {
+  bool preservesFunctionEffects() override { return true; }
+  void run(PassRunner* runner, Module* module) override {
+    // scan without any previous summaries, so nothing stale is used
+    PassOptions options = runner->options;
+    options.funcEffectsMap.reset();
+    FunctionInfoMap infos;
+    std::vector<Function*> funcs;
+    std::map<Name, Index> indexes;
+    for (auto& func : module->functions) {
+      if (func->imported()) continue;
+      // fill in info, as we operate on it in parallel (each function to its own entry)
+      infos[func->name];
+      indexes[func->name] = funcs.size();
+      funcs.push_back(func.get());
+    }
+    {
+      PassRunner runner(module, options);
+      runner.setIsNested(true);
+      runner.add<FunctionEffectsScanner>(&infos);
+      runner.run();
+    }
+    std::vector<std::vector<Index>> callees(funcs.size());
+    for (Index i = 0; i < funcs.size(); i++) {
+      for (auto callee : infos[funcs[i]->name].callees) {
+        callees[i].push_back(indexes[callee]);
+      }
+    }
+    auto summaries = std::make_shared<FuncEffectsMap>();
+    // Find the strongly connected components with Tarjan's algorithm, which
+    // completes each one after all the ones it calls into, so we can
+    // summarize it right away. This uses an explicit stack, as call chains
+    // can be very deep.
+    const Index Unvisited = Index(-1);
+    std::vector<Index> order(funcs.size(), Unvisited), low(funcs.size());
+    std::vector<bool> onStack(funcs.size(), false);
+    std::vector<Index> componentStack;
+    std::vector<std::pair<Index, Index>> work; // function, next callee to visit
+    Index counter = 0;
+    auto push = [&](Index i) {
+      order[i] = low[i] = counter++;
+      componentStack.push_back(i);
+      onStack[i] = true;
+      work.emplace_back(i, 0);
+    };
+    for (Index root = 0; root < funcs.size(); root++) {
+      if (order[root] != Unvisited) continue;
+      push(root);
+      while (!work.empty()) {
+        auto curr = work.back().first;
+        auto& next = work.back().second;
+        if (next < callees[curr].size()) {
+          auto callee = callees[curr][next++];
+          if (order[callee] == Unvisited) {
+            push(callee);
+          } else if (onStack[callee]) {
+            low[curr] = std::min(low[curr], order[callee]);
+          }
+          continue;
+        }
+        work.pop_back();
+        if (!work.empty()) {
+          auto parent = work.back().first;
+          low[parent] = std::min(low[parent], low[curr]);
+        }
+        if (low[curr] != order[curr]) continue;
+        // curr is the root of a component; pop it off and summarize it
+        std::vector<Index> component;
+        Index member;
+        do {
+          member = componentStack.back();
+          componentStack.pop_back();
+          onStack[member] = false;
+          component.push_back(member);
+        } while (member != curr);
+        summarize(component, funcs, callees, infos, options, *summaries);
+      }
+    }
+    runner->options.funcEffectsMap = summaries;
+  }
+
+  void summarize(std::vector<Index>& component, std::vector<Function*>& funcs,
+                 std::vector<std::vector<Index>>& callees, FunctionInfoMap& infos,
+                 PassOptions& options, FuncEffectsMap& summaries) {
+    EffectAnalyzer effects(options);
+    bool recursive = component.size() > 1;
+    for (auto i : component) {
+      effects.mergeIn(*infos[funcs[i]->name].effects);
+      for (auto callee : callees[i]) {
+        if (callee == i) {
+          recursive = true;
+        } else {
+          // a callee in another component was already summarized, and one
+          // in ours has its effects merged in by this loop
+          auto iter = summaries.find(funcs[callee]->name);
+          if (iter != summaries.end()) {
+            effects.mergeIn(iter->second);
+          }
+        }
+      }
+    }
+    if (recursive) {
+      effects.branches = true;
+    }
+    for (auto i : component) {
+      summaries.emplace(funcs[i]->name, effects);
+    }
+  }
+};
+
+struct DiscardFunctionEffects : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    runner->options.funcEffectsMap.reset();
+  }
+};
+
+Pass* createGenerateFunctionEffectsPass() {
+  return new GenerateFunctionEffects();
+}
+
+Pass* createDiscardFunctionEffectsPass() {
+  return new DiscardFunctionEffects();
+}
+
+} // namespace wasm
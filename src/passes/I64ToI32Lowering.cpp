@@ -20,6 +20,10 @@
 // returning the low half and storing the high half into a
 // global.
 //
+// Each lowered expression returns its low half, and leaves its high half
+// in a temp local. This works on nested code, and does not need flatten
+// to be run first.
+//
 
 #include <algorithm>
 #include "wasm.h"
@@ -143,6 +147,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     indexMap.clear();
     highBitVars.clear();
     labelHighBitVars.clear();
+    reservedTemps.clear();
     freeTemps.clear();
     Module temp;
     auto* oldFunc = ModuleUtils::copyFunction(func, temp);
@@ -174,6 +179,42 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     PostWalker<I64ToI32Lowering>::doWalkFunction(func);
   }
 
+  // Temps are reused once freed, which is safe as long as the code writing a
+  // temp runs after the code that used it before. That is not the case for
+  // a temp that a lowered operation writes before some of its operands run,
+  // like the low half of the left side of a binary, which is saved while the
+  // right side runs: we only create the operation once the right side has
+  // been lowered, and by then the temps that code uses may be free. So such
+  // temps are reserved before the operands are visited.
+  static void scan(I64ToI32Lowering* self, Expression** currp) {
+    PostWalker<I64ToI32Lowering>::scan(self, currp);
+    auto* curr = *currp;
+    if (curr->is<Binary>() || curr->is<Store>() || curr->is<Break>() ||
+        curr->is<Select>()) {
+      self->pushTask(doReserveTemps, currp);
+    }
+  }
+
+  static void doReserveTemps(I64ToI32Lowering* self, Expression** currp) {
+    auto* curr = *currp;
+    Index num = 0;
+    if (auto* binary = curr->dynCast<Binary>()) {
+      if (self->binaryNeedsLowering(binary->op)) num = 1;
+    } else if (auto* store = curr->dynCast<Store>()) {
+      if (store->valueType == i64 && store->bytes == 8) num = 1;
+    } else if (auto* br = curr->dynCast<Break>()) {
+      if (br->value && br->condition && br->value->type == i64) num = 2;
+    } else if (curr->cast<Select>()->type == i64) {
+      num = 2;
+    }
+    if (num == 0) return;
+    auto& temps = self->reservedTemps[curr];
+    temps.reserve(num);
+    for (Index i = 0; i < num; i++) {
+      temps.push_back(self->getTemp());
+    }
+  }
+
   void visitFunction(Function* func) {
     if (func->imported()) {
       return;
@@ -205,11 +246,16 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
 
   void visitBlock(Block* curr) {
     if (curr->list.size() == 0) return;
-    if (curr->type == i64) curr->type = i32;
+    bool isI64 = curr->type == i64;
+    if (isI64) curr->type = i32;
     auto highBitsIt = labelHighBitVars.find(curr->name);
     if (!hasOutParam(curr->list.back())) {
       if (highBitsIt != labelHighBitVars.end()) {
         setOutParam(curr, std::move(highBitsIt->second));
+        labelHighBitVars.erase(highBitsIt);
+      } else if (isI64) {
+        // The block has a type, but no value flows out of it.
+        setOutParam(curr, getTemp());
       }
       return;
     }
@@ -235,15 +281,32 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     setOutParam(curr, std::move(highBits));
   }
 
-  // If and Select have identical code
-  template<typename T>
-  void visitBranching(T* curr) {
-    if (!hasOutParam(curr->ifTrue)) return;
-    assert(curr->ifFalse != nullptr && "Nullable ifFalse found");
+  void visitIf(If* curr) {
+    if (curr->type != i64) {
+      // The if is unreachable, and an arm may have been lowered anyhow.
+      if (hasOutParam(curr->ifTrue)) fetchOutParam(curr->ifTrue);
+      if (curr->ifFalse && hasOutParam(curr->ifFalse)) {
+        fetchOutParam(curr->ifFalse);
+      }
+      return;
+    }
+    curr->type = i32;
+    // If an arm does not return, the other one provides the high bits.
+    if (!hasOutParam(curr->ifTrue) && !hasOutParam(curr->ifFalse)) {
+      setOutParam(curr, getTemp());
+      return;
+    }
+    if (!hasOutParam(curr->ifTrue)) {
+      setOutParam(curr, fetchOutParam(curr->ifFalse));
+      return;
+    }
+    if (!hasOutParam(curr->ifFalse)) {
+      setOutParam(curr, fetchOutParam(curr->ifTrue));
+      return;
+    }
     TempVar highBits = fetchOutParam(curr->ifTrue);
     TempVar falseBits = fetchOutParam(curr->ifFalse);
     TempVar tmp = getTemp();
-    curr->type = i32;
     curr->ifFalse = builder->blockify(
       builder->makeSetLocal(tmp, curr->ifFalse),
       builder->makeSetLocal(
@@ -255,14 +318,15 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     setOutParam(curr, std::move(highBits));
   }
 
-  void visitIf(If* curr) {
-    visitBranching<If>(curr);
-  }
-
   void visitLoop(Loop* curr) {
     assert(labelHighBitVars.find(curr->name) == labelHighBitVars.end());
     if (curr->type != i64) return;
     curr->type = i32;
+    if (!hasOutParam(curr->body)) {
+      // The loop has a type, but no value flows out of it.
+      setOutParam(curr, getTemp());
+      return;
+    }
     setOutParam(curr, fetchOutParam(curr->body));
   }
 
@@ -271,21 +335,39 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     assert(curr->value != nullptr);
     TempVar valHighBits = fetchOutParam(curr->value);
     auto blockHighBitsIt = labelHighBitVars.find(curr->name);
-    if (blockHighBitsIt == labelHighBitVars.end()) {
-      labelHighBitVars.emplace(curr->name, std::move(valHighBits));
-      curr->type = i32;
+    if (!curr->condition) {
+      if (blockHighBitsIt == labelHighBitVars.end()) {
+        labelHighBitVars.emplace(curr->name, std::move(valHighBits));
+        return;
+      }
+      TempVar tmp = getTemp();
+      SetLocal* setLow = builder->makeSetLocal(tmp, curr->value);
+      SetLocal* setHigh = builder->makeSetLocal(
+        blockHighBitsIt->second,
+        builder->makeGetLocal(valHighBits, i32)
+      );
+      curr->value = builder->makeGetLocal(tmp, i32);
+      replaceCurrent(builder->blockify(setLow, setHigh, curr));
       return;
     }
-    TempVar blockHighBits = std::move(blockHighBitsIt->second);
-    TempVar tmp = getTemp();
+    // A br_if sets the high bits for the target before the condition runs,
+    // and when the branch is not taken, returns the value as well.
+    auto reserved = fetchReservedTemps(curr);
+    if (blockHighBitsIt == labelHighBitVars.end()) {
+      labelHighBitVars.emplace(curr->name, std::move(reserved[1]));
+      blockHighBitsIt = labelHighBitVars.find(curr->name);
+    }
+    TempVar tmp = std::move(reserved[0]);
     SetLocal* setLow = builder->makeSetLocal(tmp, curr->value);
     SetLocal* setHigh = builder->makeSetLocal(
-      blockHighBits,
+      blockHighBitsIt->second,
       builder->makeGetLocal(valHighBits, i32)
     );
     curr->value = builder->makeGetLocal(tmp, i32);
     curr->type = i32;
-    replaceCurrent(builder->blockify(setLow, setHigh, curr));
+    Block* result = builder->blockify(setLow, setHigh, curr);
+    replaceCurrent(result);
+    setOutParam(result, std::move(valHighBits));
   }
 
   void visitSwitch(Switch* curr) {
@@ -326,6 +408,25 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   template<typename T>
   using BuilderFunc = std::function<T*(std::vector<Expression*>&, Type)>;
 
+  // A call with an operand that does not return is never reached, and its
+  // operands would not match the lowered params, so keep just the operands.
+  void lowerUnreachableCall(ExpressionList& operands, Expression* target) {
+    std::vector<Expression*> children;
+    for (auto* e : operands) {
+      if (hasOutParam(e)) {
+        // free temp var
+        fetchOutParam(e);
+      }
+      children.push_back(
+        isConcreteType(e->type) ? builder->makeDrop(e) : e
+      );
+    }
+    if (target) {
+      children.push_back(target);
+    }
+    replaceCurrent(builder->makeBlock(children));
+  }
+
   template<typename T>
   void visitGenericCall(T* curr, BuilderFunc<T> callBuilder) {
     std::vector<Expression*> args;
@@ -356,6 +457,10 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     replaceCurrent(result);
   }
   void visitCall(Call* curr) {
+    if (curr->type == unreachable) {
+      lowerUnreachableCall(curr->operands, nullptr);
+      return;
+    }
     visitGenericCall<Call>(
       curr,
       [&](std::vector<Expression*>& args, Type ty) {
@@ -365,6 +470,12 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitCallIndirect(CallIndirect* curr) {
+    for (auto* e : curr->operands) {
+      if (e->type == unreachable) {
+        lowerUnreachableCall(curr->operands, curr->target);
+        return;
+      }
+    }
     visitGenericCall<CallIndirect>(
       curr,
       [&](std::vector<Expression*>& args, Type ty) {
@@ -496,6 +607,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitStore(Store* curr) {
+    auto reserved = fetchReservedTemps(curr);
     if (!hasOutParam(curr->value)) return;
     assert(curr->offset + 4 > curr->offset);
     assert(!curr->isAtomic && "atomic store not implemented");
@@ -505,7 +617,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
     curr->align = std::min(uint32_t(curr->align), uint32_t(4));
     curr->valueType = i32;
     if (bytes == 8) {
-      TempVar ptrTemp = getTemp();
+      TempVar ptrTemp = std::move(reserved[0]);
       SetLocal* setPtr = builder->makeSetLocal(ptrTemp, curr->ptr);
       curr->ptr = builder->makeGetLocal(ptrTemp, i32);
       Store* storeHigh = builder->makeStore(
@@ -561,10 +673,14 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void lowerExtendUInt32(Unary* curr) {
+    // The high bits are set after the value runs, as it may use the same
+    // temp.
     TempVar highBits = getTemp();
+    TempVar lowBits = getTemp();
     Block* result = builder->blockify(
+      builder->makeSetLocal(lowBits, curr->value),
       builder->makeSetLocal(highBits, builder->makeConst(Literal(int32_t(0)))),
-      curr->value
+      builder->makeGetLocal(lowBits, i32)
     );
     setOutParam(result, std::move(highBits));
     replaceCurrent(result);
@@ -1417,6 +1533,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
 
   void visitBinary(Binary* curr) {
     if (!binaryNeedsLowering(curr->op)) return;
+    auto reserved = fetchReservedTemps(curr);
     if (!hasOutParam(curr->left)) {
       // left unreachable, replace self with left
       replaceCurrent(curr->left);
@@ -1436,7 +1553,7 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
       return;
     }
     // left and right reachable, lower normally
-    TempVar leftLow = getTemp();
+    TempVar leftLow = std::move(reserved[0]);
     TempVar leftHigh = fetchOutParam(curr->left);
     TempVar rightLow = getTemp();
     TempVar rightHigh = fetchOutParam(curr->right);
@@ -1526,7 +1643,39 @@ struct I64ToI32Lowering : public WalkerPass<PostWalker<I64ToI32Lowering>> {
   }
 
   void visitSelect(Select* curr) {
-    visitBranching<Select>(curr);
+    auto reserved = fetchReservedTemps(curr);
+    if (curr->type != i64) {
+      // The select is unreachable, and an arm may have been lowered anyhow.
+      if (hasOutParam(curr->ifTrue)) fetchOutParam(curr->ifTrue);
+      if (hasOutParam(curr->ifFalse)) fetchOutParam(curr->ifFalse);
+      return;
+    }
+    // Both arms run before the condition, and we select each half.
+    TempVar highBits = fetchOutParam(curr->ifTrue);
+    TempVar falseBits = fetchOutParam(curr->ifFalse);
+    TempVar trueLow = std::move(reserved[0]);
+    TempVar falseLow = std::move(reserved[1]);
+    TempVar cond = getTemp();
+    Block* result = builder->blockify(
+      builder->makeSetLocal(trueLow, curr->ifTrue),
+      builder->makeSetLocal(falseLow, curr->ifFalse),
+      builder->makeSetLocal(cond, curr->condition),
+      builder->makeSetLocal(
+        highBits,
+        builder->makeSelect(
+          builder->makeGetLocal(cond, i32),
+          builder->makeGetLocal(highBits, i32),
+          builder->makeGetLocal(falseBits, i32)
+        )
+      )
+    );
+    curr->ifTrue = builder->makeGetLocal(trueLow, i32);
+    curr->ifFalse = builder->makeGetLocal(falseLow, i32);
+    curr->condition = builder->makeGetLocal(cond, i32);
+    curr->type = i32;
+    result = builder->blockify(result, curr);
+    setOutParam(result, std::move(highBits));
+    replaceCurrent(result);
   }
 
   void visitDrop(Drop* curr) {
@@ -1555,6 +1704,7 @@ private:
   std::unordered_map<int, std::vector<Index>> freeTemps;
   std::unordered_map<Expression*, TempVar> highBitVars;
   std::unordered_map<Name, TempVar> labelHighBitVars;
+  std::unordered_map<Expression*, std::vector<TempVar>> reservedTemps;
   std::unordered_map<Index, Type> tempTypes;
   Index nextTemp;
 
@@ -1572,6 +1722,16 @@ private:
     return TempVar(ret, ty, *this);
   }
 
+  std::vector<TempVar> fetchReservedTemps(Expression* e) {
+    std::vector<TempVar> ret;
+    auto iter = reservedTemps.find(e);
+    if (iter != reservedTemps.end()) {
+      ret.swap(iter->second);
+      reservedTemps.erase(iter);
+    }
+    return ret;
+  }
+
   bool hasOutParam(Expression* e) {
     return highBitVars.find(e) != highBitVars.end();
   }
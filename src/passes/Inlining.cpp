@@ -228,6 +228,7 @@ static Expression* doInlining(Module* module, Function* into, InliningAction& ac
 }
 
 struct Inlining : public Pass {
+  bool preservesFunctionEffects() override { return true; }
   // whether to optimize where we inline
   bool optimize = false;
 
@@ -370,6 +370,7 @@ void BreakValueDropper::visitBlock(Block* curr) {
 
 struct MergeBlocks : public WalkerPass<PostWalker<MergeBlocks>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new MergeBlocks; }
 
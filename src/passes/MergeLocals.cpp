@@ -55,9 +55,13 @@ namespace wasm {
 
 struct MergeLocals : public WalkerPass<PostWalker<MergeLocals, UnifiedExpressionVisitor<MergeLocals>>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new MergeLocals(); }
 
+  // This computes and then recomputes local graphs for the whole function.
+  bool isExpensive() override { return true; }
+
   void doWalkFunction(Function* func) {
     // first, instrument the graph by modifying each copy
     //   (set_local $x
@@ -20,6 +20,7 @@
 #include <support/colors.h>
 #include <wasm.h>
 #include <wasm-binary.h>
+#include <wasm-encoded-size.h>
 #include <ir/module-utils.h>
 
 using namespace std;
@@ -85,17 +86,15 @@ struct Metrics : public WalkerPass<PostWalker<Metrics, UnifiedExpressionVisitor<
     if (byFunction) {
       // print global
       printCounts("global");
-      // compute binary info, so we know function sizes
-      BufferWithRandomAccess buffer;
-      WasmBinaryWriter writer(module, buffer);
-      writer.write();
+      // measure all the functions (in parallel), so we know their sizes
+      EncodedSizeOracle oracle(*module);
+      oracle.getCodeSectionSize();
       // print for each function
-      Index binaryIndex = 0;
       ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
         counts.clear();
         walkFunction(func);
         counts["[vars]"] = func->getNumVars();
-        counts["[binary-bytes]"] = writer.tableOfContents.functionBodies[binaryIndex++].size;
+        counts["[binary-bytes]"] = oracle.getBodySize(func);
         printCounts(std::string("func: ") + func->name.str);
       });
       // print for each export how much code size is due to it, i.e.,
@@ -105,10 +104,7 @@ struct Metrics : public WalkerPass<PostWalker<Metrics, UnifiedExpressionVisitor<
         runner.setIsNested(true);
         runner.addDefaultGlobalOptimizationPostPasses(); // remove stuff
         runner.run();
-        BufferWithRandomAccess buffer;
-        WasmBinaryWriter writer(module, buffer);
-        writer.write();
-        return buffer.size();
+        return EncodedSizeOracle(*module).getModuleSize();
       };
       size_t baseline;
       {
@@ -31,107 +31,26 @@
 #include <ir/literal-utils.h>
 #include <ir/local-graph.h>
 #include <ir/manipulation.h>
+#include "passes/precomputing.h"
 
 namespace wasm {
 
-static const Name NOTPRECOMPUTABLE_FLOW("Binaryen|notprecomputable");
-
-typedef std::unordered_map<GetLocal*, Literal> GetValues;
-
-// Precomputes an expression. Errors if we hit anything that can't be precomputed.
-class PrecomputingExpressionRunner : public ExpressionRunner<PrecomputingExpressionRunner> {
-  Module* module;
-
-  // map gets to constant values, if they are known to be constant
-  GetValues& getValues;
-
-  // Whether we are trying to precompute down to an expression (which we can do on
-  // say 5 + 6) or to a value (which we can't do on a tee_local that flows a 7
-  // through it). When we want to replace the expression, we can only do so
-  // when it has no side effects. When we don't care about replacing the expression,
-  // we just want to know if it will contain a known constant.
-  bool replaceExpression;
-
-public:
-  PrecomputingExpressionRunner(Module* module, GetValues& getValues, bool replaceExpression) : module(module), getValues(getValues), replaceExpression(replaceExpression) {}
-
-  struct NonstandaloneException {}; // TODO: use a flow with a special name, as this is likely very slow
-
-  Flow visitLoop(Loop* curr) {
-    // loops might be infinite, so must be careful
-    // but we can't tell if non-infinite, since we don't have state, so loops are just impossible to optimize for now
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-
-  Flow visitCall(Call* curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitCallIndirect(CallIndirect* curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitGetLocal(GetLocal *curr) {
-    auto iter = getValues.find(curr);
-    if (iter != getValues.end()) {
-      auto value = iter->second;
-      if (value.isConcrete()) {
-        return Flow(value);
-      }
-    }
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitSetLocal(SetLocal *curr) {
-    // If we don't need to replace the whole expression, see if there
-    // is a value flowing through a tee.
-    if (!replaceExpression) {
-      if (isConcreteType(curr->type)) {
-        assert(curr->isTee());
-        return visit(curr->value);
-      }
-    }
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitGetGlobal(GetGlobal *curr) {
-    auto* global = module->getGlobal(curr->name);
-    if (!global->imported() && !global->mutable_) {
-      return visit(global->init);
-    }
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitSetGlobal(SetGlobal *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitLoad(Load *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitStore(Store *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitAtomicRMW(AtomicRMW *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitAtomicCmpxchg(AtomicCmpxchg *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitAtomicWait(AtomicWait *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitAtomicWake(AtomicWake *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-  Flow visitHost(Host *curr) {
-    return Flow(NOTPRECOMPUTABLE_FLOW);
-  }
-
-  void trap(const char* why) override {
-    throw NonstandaloneException();
-  }
-};
-
 struct Precompute : public WalkerPass<PostWalker<Precompute, UnifiedExpressionVisitor<Precompute>>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new Precompute(propagate); }
 
+  // Propagating can take quadratic time, as it computes the values of
+  // locals through all the sets that reach each get.
+  bool isExpensive() override { return propagate; }
+
+  Pass* createDowngraded() override {
+    auto* ret = new Precompute(false);
+    ret->name = "precompute";
+    return ret;
+  }
+
   bool propagate = false;
 
   Precompute(bool propagate) : propagate(propagate) {}
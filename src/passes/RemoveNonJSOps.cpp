@@ -22,9 +22,9 @@
 // themselves.
 //
 // You'll find a large wast blob in `wasm-intrinsics.wast` next to this file
-// which contains all of the injected intrinsics. We manually copy over any
-// needed intrinsics from this module into the module that we're optimizing
-// after walking the current module.
+// which contains all of the injected intrinsics. It is parsed and lowered once
+// per process, and we manually copy over any needed intrinsics from it into
+// the module that we're optimizing after walking the current module.
 //
 
 #include <wasm.h>
@@ -57,49 +57,61 @@ struct RemoveNonJSOpsPass : public WalkerPass<PostWalker<RemoveNonJSOpsPass>> {
       return;
     }
 
-    // Parse the wast blob we have at the end of this file.
-    //
-    // TODO: only do this once per invocation of wasm2asm
-    Module intrinsicsModule;
+    // Link in everything that wasn't already linked in. The shared intrinsics
+    // are already lowered, and each one knows the full set of functions it
+    // depends on, so this is a plain copy.
+    auto& intrinsics = getIntrinsics();
+    std::set<Name> neededFunctions;
+    for (auto &name : neededIntrinsics) {
+      auto& closure = intrinsics.closures.at(name);
+      neededFunctions.insert(closure.begin(), closure.end());
+    }
+    neededIntrinsics.clear();
+    for (auto &name : neededFunctions) {
+      if (!module->getFunctionOrNull(name)) {
+        ModuleUtils::copyFunction(intrinsics.module.getFunction(name), *module);
+      }
+    }
+  }
+
+  // The intrinsics, parsed from the wast blob and lowered. This is built
+  // once per process and is immutable afterwards, so it can be shared by
+  // all instances of this pass.
+  struct Intrinsics {
+    Module module;
+    // For each intrinsic, all the functions it needs, including itself.
+    std::map<Name, std::set<Name>> closures;
+  };
+
+  static Intrinsics& getIntrinsics() {
+    static std::unique_ptr<Intrinsics> intrinsics = buildIntrinsics();
+    return *intrinsics;
+  }
+
+  static std::unique_ptr<Intrinsics> buildIntrinsics() {
+    auto intrinsics = make_unique<Intrinsics>();
+    auto& module = intrinsics->module;
     std::string input(IntrinsicsModuleWast);
     SExpressionParser parser(const_cast<char*>(input.c_str()));
     Element& root = *parser.root;
-    SExpressionWasmBuilder builder(intrinsicsModule, *root[0]);
-
-    std::set<Name> neededFunctions;
+    SExpressionWasmBuilder builder(module, *root[0]);
+
+    // Intrinsics often use one another. For example the 64-bit division
+    // intrinsic ends up using the 32-bit ctz intrinsic, but does so via a
+    // native instruction. Lower them all here, so that the calls they need
+    // are explicit and they never contain non-js ops when injected.
+    RemoveNonJSOpsPass lowering;
+    for (auto& func : module.functions) {
+      lowering.walkFunctionInModule(func.get(), &module);
+    }
 
-    // Iteratively link intrinsics from `intrinsicsModule` into our destination
-    // module, as needed.
-    //
-    // Note that intrinsics often use one another. For example the 64-bit
-    // division intrinsic ends up using the 32-bit ctz intrinsic, but does so
-    // via a native instruction. The loop here is used to continuously reprocess
-    // injected intrinsics to ensure that they never contain non-js ops when
-    // we're done.
-    while (neededIntrinsics.size() > 0) {
-      // Recursively probe all needed intrinsics for transitively used
-      // functions. This is building up a set of functions we'll link into our
-      // module.
-      for (auto &name : neededIntrinsics) {
-        addNeededFunctions(intrinsicsModule, name, neededFunctions);
-      }
-      neededIntrinsics.clear();
-
-      // Link in everything that wasn't already linked in. After we've done the
-      // copy we then walk the function to rewrite any non-js operations it has
-      // as well.
-      for (auto &name : neededFunctions) {
-        auto* func = module->getFunctionOrNull(name);
-        if (!func) {
-          func = ModuleUtils::copyFunction(intrinsicsModule.getFunction(name), *module);
-        }
-        doWalkFunction(func);
-      }
-      neededFunctions.clear();
+    for (auto& func : module.functions) {
+      addNeededFunctions(module, func->name, intrinsics->closures[func->name]);
     }
+    return intrinsics;
   }
 
-  void addNeededFunctions(Module &m, Name name, std::set<Name> &needed) {
+  static void addNeededFunctions(Module &m, Name name, std::set<Name> &needed) {
     if (needed.count(name)) {
       return;
     }
@@ -108,7 +120,7 @@ struct RemoveNonJSOpsPass : public WalkerPass<PostWalker<RemoveNonJSOpsPass>> {
     auto function = m.getFunction(name);
     FindAll<Call> calls(function->body);
     for (auto &call : calls.list) {
-      this->addNeededFunctions(m, call->target, needed);
+      addNeededFunctions(m, call->target, needed);
     }
   }
 
@@ -42,6 +42,7 @@ static bool canTurnIfIntoBrIf(Expression* ifCondition, Expression* brValue, Pass
 
 struct RemoveUnusedBrs : public WalkerPass<PostWalker<RemoveUnusedBrs>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new RemoveUnusedBrs; }
 
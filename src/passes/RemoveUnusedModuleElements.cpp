@@ -147,6 +147,7 @@ struct FunctionTypeAnalyzer : public PostWalker<FunctionTypeAnalyzer> {
 };
 
 struct RemoveUnusedModuleElements : public Pass {
+  bool preservesFunctionEffects() override { return true; }
   bool rootAllFunctions;
 
   RemoveUnusedModuleElements(bool rootAllFunctions) : rootAllFunctions(rootAllFunctions) {}
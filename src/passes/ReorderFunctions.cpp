@@ -23,15 +23,29 @@
 // increase gzip size. This might be because the new order has the functions in
 // a less beneficial position for compression, that is, mutually-compressible
 // functions are no longer together (when they were before, in the original order,
-// the has some natural tendency one way or the other). TODO: investigate
-// similarity ordering here.
+// the has some natural tendency one way or the other).
+//
+// ReorderFunctionsBySimilarity optimizes for compression instead: it places
+// functions with similar binary encodings next to each other, so that a
+// compressor like gzip finds more matches between them within its window.
+// Similarity is estimated from sketches of the hashed shingles (short
+// substrings) of each function's encoded body, and the order is built
+// greedily, always appending the most similar remaining function to the last
+// one placed. With --debug, the estimated compressed sizes before and after
+// are reported.
 //
 
 
+#include <array>
+#include <cstring>
 #include <memory>
 
 #include <wasm.h>
+#include <wasm-binary.h>
 #include <pass.h>
+#include <ir/module-utils.h>
+#include <support/compression.h>
+#include <support/hash.h>
 
 namespace wasm {
 
@@ -97,4 +111,189 @@ Pass *createReorderFunctionsPass() {
   return new ReorderFunctions();
 }
 
+struct ReorderFunctionsBySimilarity : public Pass {
+  // The length of a shingle, in bytes.
+  static const size_t ShingleSize = 4;
+  // The number of bins in a sketch.
+  static const size_t BinBits = 5;
+  static const size_t NumBins = 1 << BinBits;
+  // The number of bins that form a band. Functions that are identical in
+  // some band are candidates to be placed next to each other.
+  static const size_t BandSize = 4;
+  static const size_t NumBands = NumBins / BandSize;
+  // How many unplaced functions to consider in each band.
+  static const size_t MaxCandidatesPerBand = 32;
+
+  static const uint32_t EmptyBin = uint32_t(-1);
+
+  // A one-permutation MinHash sketch: each shingle's hash picks a bin, and
+  // the bin keeps the smallest hash it saw.
+  typedef std::array<uint32_t, NumBins> Sketch;
+
+  void run(PassRunner* runner, Module* module) override {
+    std::vector<Function*> functions;
+    ModuleUtils::iterDefinedFunctions(*module, [&](Function* func) {
+      functions.push_back(func);
+    });
+    if (functions.size() <= 1) return;
+
+    // Encode the module to find the bytes of each function body.
+    BufferWithRandomAccess buffer;
+    WasmBinaryWriter writer(module, buffer);
+    writer.setNamesSection(false);
+    writer.write();
+    auto& bodies = writer.tableOfContents.functionBodies;
+    assert(bodies.size() == functions.size());
+    auto* data = reinterpret_cast<const char*>(&buffer[0]);
+
+    std::vector<Sketch> sketches;
+    for (auto& body : bodies) {
+      sketches.push_back(computeSketch(data + body.offset, body.size));
+    }
+
+    auto order = computeOrder(sketches);
+
+    if (runner->options.debug) {
+      // Report the change in estimated compressed size of the function
+      // bodies, ignoring the effect of the new order on the encoding of calls.
+      auto getEstimatedSize = [&](const std::vector<Index>& order) {
+        std::vector<char> code;
+        for (auto i : order) {
+          auto& body = bodies[i];
+          code.insert(code.end(), data + body.offset, data + body.offset + body.size);
+        }
+        return estimateCompressedSize(code.data(), code.size());
+      };
+      std::vector<Index> originalOrder;
+      for (Index i = 0; i < functions.size(); i++) {
+        originalOrder.push_back(i);
+      }
+      std::cerr << "[reorder-functions-by-similarity] estimated compressed code size: "
+                << getEstimatedSize(originalOrder) << " => "
+                << getEstimatedSize(order) << '\n';
+    }
+
+    // Imported functions stay first, in their original order.
+    std::unordered_map<Function*, std::unique_ptr<Function>> owned;
+    std::vector<std::unique_ptr<Function>> newFunctions;
+    for (auto& func : module->functions) {
+      if (func->imported()) {
+        newFunctions.push_back(std::move(func));
+      } else {
+        auto* ptr = func.get();
+        owned[ptr] = std::move(func);
+      }
+    }
+    for (auto i : order) {
+      newFunctions.push_back(std::move(owned[functions[i]]));
+    }
+    module->functions.swap(newFunctions);
+  }
+
+  static Sketch computeSketch(const char* data, size_t size) {
+    Sketch sketch;
+    sketch.fill(EmptyBin);
+    for (size_t i = 0; i + ShingleSize <= size; i++) {
+      uint32_t shingle;
+      memcpy(&shingle, data + i, ShingleSize);
+      // Mix the bits well, as in MurmurHash3's finalizer.
+      uint32_t hash = shingle;
+      hash ^= hash >> 16;
+      hash *= 0x85ebca6b;
+      hash ^= hash >> 13;
+      hash *= 0xc2b2ae35;
+      hash ^= hash >> 16;
+      // Use the high bits to pick the bin, and the rest as the value.
+      auto& bin = sketch[hash >> (32 - BinBits)];
+      auto value = hash & ((uint32_t(1) << (32 - BinBits)) - 1);
+      bin = std::min(bin, value);
+    }
+    return sketch;
+  }
+
+  // Estimates the Jaccard similarity of the shingle sets of two functions.
+  static double getSimilarity(const Sketch& a, const Sketch& b) {
+    size_t used = 0, same = 0;
+    for (size_t i = 0; i < NumBins; i++) {
+      if (a[i] == EmptyBin && b[i] == EmptyBin) continue;
+      used++;
+      if (a[i] == b[i]) same++;
+    }
+    return used ? double(same) / used : 1;
+  }
+
+  // The functions whose sketches are identical in a band. Functions before
+  // |start| have been placed, so they are not scanned again.
+  struct Bucket {
+    std::vector<Index> items;
+    size_t start = 0;
+  };
+
+  std::vector<Index> computeOrder(const std::vector<Sketch>& sketches) {
+    auto num = sketches.size();
+    // Bucket the functions by their bands, locality-sensitive hashing style.
+    std::vector<std::unordered_map<HashType, Bucket>> buckets(NumBands);
+    auto getBandHash = [&](Index i, size_t band) {
+      HashType hash = band;
+      for (size_t j = band * BandSize; j < (band + 1) * BandSize; j++) {
+        hash = rehash(hash, sketches[i][j]);
+      }
+      return hash;
+    };
+    for (Index i = 0; i < num; i++) {
+      for (size_t band = 0; band < NumBands; band++) {
+        buckets[band][getBandHash(i, band)].items.push_back(i);
+      }
+    }
+    std::vector<bool> placed(num);
+    std::vector<Index> order;
+    Index nextUnplaced = 0;
+    Index curr = 0;
+    while (1) {
+      placed[curr] = true;
+      order.push_back(curr);
+      if (order.size() == num) break;
+      // Find the most similar unplaced function that shares a band, preferring
+      // earlier functions on ties to keep the order stable.
+      Index best = num;
+      double bestSimilarity = 0;
+      for (size_t band = 0; band < NumBands; band++) {
+        auto& bucket = buckets[band][getBandHash(curr, band)];
+        auto& items = bucket.items;
+        // Scan only up to a fixed number of unplaced functions, so that a
+        // huge bucket (of many tiny functions with the same sketch, say)
+        // does not make this quadratic. Placed functions that we see are
+        // moved to the front and never scanned again, so the total work is
+        // linear in the number of functions.
+        size_t seen = 0;
+        for (size_t k = bucket.start; k < items.size() && seen < MaxCandidatesPerBand; k++) {
+          auto other = items[k];
+          if (placed[other]) {
+            std::swap(items[bucket.start++], items[k]);
+            continue;
+          }
+          seen++;
+          auto similarity = getSimilarity(sketches[curr], sketches[other]);
+          if (similarity > bestSimilarity ||
+              (similarity == bestSimilarity && other < best)) {
+            best = other;
+            bestSimilarity = similarity;
+          }
+        }
+      }
+      if (best == num) {
+        // Nothing is similar; continue in the original order.
+        while (placed[nextUnplaced]) nextUnplaced++;
+        best = nextUnplaced;
+      }
+      curr = best;
+    }
+    return order;
+  }
+};
+
+Pass *createReorderFunctionsBySimilarityPass() {
+  return new ReorderFunctionsBySimilarity();
+}
+
 } // namespace wasm
@@ -0,0 +1,465 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Sparse conditional constant propagation (Wegman and Zadeck), on the SSA
+// view of a function (see ir/ssa-graph.h).
+//
+// Each value starts out undefined, and is lowered to a constant or to
+// overdefined as we learn about it. At the same time we track which CFG
+// edges may be executed: a branch on a constant condition only makes the
+// edges it takes executable, and phis only merge the values coming from
+// executable edges. That lets us find constants that precompute-propagate
+// can't, for example when a loop keeps a local constant, or when the only
+// other value reaching a merge comes from an arm that is never taken:
+//
+//    (set_local $x (i32.const 1))
+//    (if (i32.eqz (get_local $x))
+//      (set_local $x (i32.const 2))
+//    )
+//    (get_local $x) ;; this is 1
+//
+// Everything is found in a single run over the def-use chains, after which
+// we replace constant gets with constants, and ifs and br_ifs whose
+// conditions are constant with the code they run. That leaves work for
+// precompute and vacuum, which run after us in the default pipeline.
+//
+
+#include <atomic>
+#include <set>
+
+#include "wasm.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "ir/effects.h"
+#include "ir/find_all.h"
+#include "ir/literal-utils.h"
+#include "ir/ssa-graph.h"
+#include "ir/utils.h"
+#include "passes/precomputing.h"
+
+namespace wasm {
+
+namespace {
+
+struct SCCPStats {
+  std::atomic<Index> constants, branches;
+
+  SCCPStats() : constants(0), branches(0) {}
+};
+
+struct LatticeValue {
+  enum Kind {
+    Undefined,  // nothing is known yet
+    Constant,   // always the same constant
+    Overdefined // may have more than one value
+  };
+
+  Kind kind = Undefined;
+  Literal constant;
+
+  LatticeValue() {}
+  LatticeValue(Kind kind) : kind(kind) {}
+  LatticeValue(Literal constant) : kind(Constant), constant(constant) {}
+
+  bool operator==(const LatticeValue& other) const {
+    return kind == other.kind && (kind != Constant || constant == other.constant);
+  }
+  bool operator!=(const LatticeValue& other) const {
+    return !(*this == other);
+  }
+
+  LatticeValue meet(const LatticeValue& other) const {
+    if (kind == Undefined) return other;
+    if (other.kind == Undefined) return *this;
+    if (*this == other) return *this;
+    return LatticeValue(Overdefined);
+  }
+};
+
+typedef SSAGraph::Value Value;
+typedef SSAGraph::Block Block;
+
+struct FunctionSCCP : public WalkerPass<PostWalker<FunctionSCCP>> {
+  bool isFunctionParallel() override { return true; }
+
+  Pass* create() override { return new FunctionSCCP(stats); }
+
+  SCCPStats* stats;
+
+  FunctionSCCP(SCCPStats* stats) : stats(stats) {}
+
+  void doWalkFunction(Function* func) {
+    SSAGraph graph(func);
+    Analysis analysis(graph, getModule());
+    Builder builder(*getModule());
+    Index numConstants = 0, numBranches = 0;
+    // Note the branches before we modify anything, so we can tell if they
+    // are still where we found them.
+    std::vector<std::pair<Block*, Expression*>> branches;
+    for (auto& block : graph.blocks) {
+      if (block->branch && analysis.isExecutable(block.get())) {
+        branches.emplace_back(block.get(), *block->branch);
+      }
+    }
+    // Replace gets of constants with the constants. The locations of gets
+    // and sets are valid as nothing else has changed yet.
+    for (auto& pair : graph.getValues) {
+      auto* get = pair.first;
+      auto& value = analysis.get(pair.second);
+      if (value.kind == LatticeValue::Constant &&
+          analysis.isExecutable(analysis.blocks[get])) {
+        *graph.locations[get] = builder.makeConst(value.constant);
+        numConstants++;
+      }
+    }
+    // Replace the values of sets that we found are constant.
+    for (auto& pair : graph.setValues) {
+      auto* set = pair.first;
+      auto& value = analysis.get(pair.second);
+      if (value.kind == LatticeValue::Constant &&
+          !set->value->is<Const>() &&
+          analysis.isExecutable(analysis.blocks[set]) &&
+          !EffectAnalyzer(getPassOptions(), set->value).hasSideEffects()) {
+        set->value = builder.makeConst(value.constant);
+        numConstants++;
+      }
+    }
+    // Replace branches on constant conditions with the code they run. Blocks
+    // are in the order they were created, so going backwards handles inner
+    // branches before the ones around them.
+    for (auto iter = branches.rbegin(); iter != branches.rend(); ++iter) {
+      auto* block = iter->first;
+      if (*block->branch != iter->second) continue;
+      auto condition = analysis.getCondition(block);
+      if (condition.kind != LatticeValue::Constant) continue;
+      if (foldBranch(block->branch, condition.constant.geti32() != 0)) {
+        numBranches++;
+      }
+    }
+    if (numConstants || numBranches) {
+      ReFinalize().walkFunctionInModule(func, getModule());
+      stats->constants += numConstants;
+      stats->branches += numBranches;
+    }
+  }
+
+private:
+  // Finds the lattice values and the executable blocks.
+  struct Analysis {
+    SSAGraph& graph;
+    Module* module;
+
+    // The block of each get and set.
+    std::unordered_map<Expression*, Block*> blocks;
+
+    Analysis(SSAGraph& graph, Module* module) : graph(graph), module(module) {
+      // Note where everything is, and who uses what.
+      for (auto& block : graph.blocks) {
+        for (auto* action : block->actions) {
+          blocks[action] = block.get();
+          if (auto* set = action->dynCast<SetLocal>()) {
+            auto& gets = setGets[set];
+            gets = FindAll<GetLocal>(set->value).list;
+            for (auto* get : gets) {
+              auto iter = graph.getValues.find(get);
+              if (iter != graph.getValues.end()) {
+                setUsers[iter->second].push_back(set);
+              }
+            }
+          }
+        }
+        if (block->branch) {
+          auto& gets = conditionGets[block.get()];
+          gets = FindAll<GetLocal>(getConditionExpression(block.get())).list;
+          for (auto* get : gets) {
+            auto iter = graph.getValues.find(get);
+            if (iter != graph.getValues.end()) {
+              branchUsers[iter->second].push_back(block.get());
+            }
+          }
+        }
+      }
+      for (auto& value : graph.values) {
+        if (value->isRemoved()) continue;
+        switch (value->kind) {
+          case Value::Param: {
+            lattice[value.get()] = LatticeValue(LatticeValue::Overdefined);
+            break;
+          }
+          case Value::Zero: {
+            auto type = graph.func->getLocalType(value->index);
+            lattice[value.get()] = LatticeValue(LiteralUtils::makeLiteralZero(type));
+            break;
+          }
+          case Value::Phi: {
+            phis[value->block].push_back(value.get());
+            break;
+          }
+          default: {}
+        }
+      }
+      // Flow until nothing changes.
+      markExecutable(graph.entry);
+      while (!blockWork.empty() || !valueWork.empty()) {
+        while (!blockWork.empty()) {
+          auto* block = blockWork.back();
+          blockWork.pop_back();
+          for (auto* phi : phis[block]) {
+            visitPhi(phi);
+          }
+          for (auto* action : block->actions) {
+            if (auto* set = action->dynCast<SetLocal>()) {
+              visitSet(set);
+            }
+          }
+          visitBranch(block);
+        }
+        while (!valueWork.empty()) {
+          auto* value = valueWork.back();
+          valueWork.pop_back();
+          for (auto* set : setUsers[value]) {
+            if (isExecutable(blocks[set])) {
+              visitSet(set);
+            }
+          }
+          for (auto* block : branchUsers[value]) {
+            if (isExecutable(block)) {
+              visitBranch(block);
+            }
+          }
+          for (auto& pair : value->phiUsers) {
+            if (isExecutable(pair.first->block)) {
+              visitPhi(pair.first);
+            }
+          }
+        }
+      }
+    }
+
+    LatticeValue& get(Value* value) {
+      return lattice[value];
+    }
+
+    bool isExecutable(Block* block) {
+      return executable.count(block) > 0;
+    }
+
+    LatticeValue getCondition(Block* block) {
+      return evaluate(getConditionExpression(block), conditionGets[block]);
+    }
+
+  private:
+    std::unordered_map<Value*, LatticeValue> lattice;
+    std::unordered_set<Block*> executable;
+    std::set<std::pair<Block*, Block*>> executableEdges;
+    // Branches we know may go anywhere.
+    std::unordered_set<Block*> overdefinedBranches;
+    std::vector<Block*> blockWork;
+    std::vector<Value*> valueWork;
+
+    // The gets in the value of each set, and in the condition of each branch.
+    std::unordered_map<SetLocal*, std::vector<GetLocal*>> setGets;
+    std::unordered_map<Block*, std::vector<GetLocal*>> conditionGets;
+    // The sets and branches whose gets read a value.
+    std::unordered_map<Value*, std::vector<SetLocal*>> setUsers;
+    std::unordered_map<Value*, std::vector<Block*>> branchUsers;
+    // The phis in each block.
+    std::unordered_map<Block*, std::vector<Value*>> phis;
+    // For expressions we could not evaluate, a get whose value is undefined.
+    std::unordered_map<Expression*, GetLocal*> waitingOns;
+
+    Expression* getConditionExpression(Block* block) {
+      if (auto* iff = (*block->branch)->dynCast<If>()) {
+        return iff->condition;
+      }
+      return (*block->branch)->cast<Break>()->condition;
+    }
+
+    // Evaluates an expression given what we know about the gets in it.
+    LatticeValue evaluate(Expression* curr, std::vector<GetLocal*>& gets) {
+      // If we are still waiting on the same get as last time, there is no
+      // need to look at the others. This avoids quadratic work on large
+      // expressions, which are reevaluated as each of their gets changes.
+      auto*& waitingOn = waitingOns[curr];
+      if (waitingOn && isUndefined(waitingOn)) {
+        return LatticeValue();
+      }
+      GetValues getValues;
+      for (auto* get : gets) {
+        // Gets in code that is not executable (yet) do not matter. If the
+        // runner does reach one, it is not precomputable.
+        auto iter = graph.getValues.find(get);
+        if (iter == graph.getValues.end() || !isExecutable(blocks[get])) {
+          continue;
+        }
+        auto& value = lattice[iter->second];
+        if (value.kind == LatticeValue::Undefined) {
+          waitingOn = get;
+          return value;
+        }
+        if (value.kind == LatticeValue::Constant) {
+          getValues[get] = value.constant;
+        }
+      }
+      Flow flow;
+      try {
+        flow = PrecomputingExpressionRunner(module, getValues, false).visit(curr);
+      } catch (PrecomputingExpressionRunner::NonstandaloneException&) {
+        return LatticeValue(LatticeValue::Overdefined);
+      }
+      if (flow.breaking() || !flow.value.isConcrete()) {
+        return LatticeValue(LatticeValue::Overdefined);
+      }
+      return LatticeValue(flow.value);
+    }
+
+    bool isUndefined(GetLocal* get) {
+      return isExecutable(blocks[get]) &&
+             lattice[graph.getValue(get)].kind == LatticeValue::Undefined;
+    }
+
+    void update(Value* value, const LatticeValue& update) {
+      auto& curr = lattice[value];
+      auto merged = curr.meet(update);
+      if (merged != curr) {
+        curr = merged;
+        valueWork.push_back(value);
+      }
+    }
+
+    void visitSet(SetLocal* set) {
+      auto* value = graph.getValue(set);
+      // Nothing can change once we know nothing.
+      if (lattice[value].kind == LatticeValue::Overdefined) return;
+      update(value, evaluate(set->value, setGets[set]));
+    }
+
+    void visitPhi(Value* phi) {
+      if (lattice[phi].kind == LatticeValue::Overdefined) return;
+      auto* block = phi->block;
+      LatticeValue merged;
+      for (Index i = 0; i < phi->operands.size(); i++) {
+        // The entry's phis have an extra operand, for the function entry.
+        if (i >= block->preds.size() ||
+            executableEdges.count(std::make_pair(block->preds[i], block))) {
+          merged = merged.meet(lattice[phi->operands[i]]);
+        }
+      }
+      update(phi, merged);
+    }
+
+    void visitBranch(Block* block) {
+      if (!block->branch) {
+        for (auto* succ : block->succs) {
+          markEdge(block, succ);
+        }
+        return;
+      }
+      if (overdefinedBranches.count(block)) return;
+      auto condition = getCondition(block);
+      if (condition.kind == LatticeValue::Undefined) return;
+      bool overdefined = condition.kind == LatticeValue::Overdefined;
+      if (overdefined) {
+        overdefinedBranches.insert(block);
+      }
+      bool taken = !overdefined && condition.constant.geti32() != 0;
+      for (auto* succ : block->succs) {
+        if (overdefined || taken == (succ != block->ifFalse)) {
+          markEdge(block, succ);
+        }
+      }
+    }
+
+    void markEdge(Block* from, Block* to) {
+      if (!executableEdges.insert(std::make_pair(from, to)).second) return;
+      if (!isExecutable(to)) {
+        markExecutable(to);
+      } else {
+        // A new value may reach the phis here.
+        for (auto* phi : phis[to]) {
+          visitPhi(phi);
+        }
+      }
+    }
+
+    void markExecutable(Block* block) {
+      executable.insert(block);
+      blockWork.push_back(block);
+    }
+  };
+
+  // Replaces an if or br_if whose condition is known with what it does.
+  // Returns whether we did so.
+  bool foldBranch(Expression** branch, bool taken) {
+    Builder builder(*getModule());
+    if (auto* iff = (*branch)->dynCast<If>()) {
+      auto* code = taken ? iff->ifTrue : iff->ifFalse;
+      if (EffectAnalyzer(getPassOptions(), iff->condition).hasSideEffects()) {
+        Expression* drop = builder.makeDrop(iff->condition);
+        *branch = code ? builder.makeSequence(drop, code) : drop;
+      } else {
+        *branch = code ? code : builder.makeNop();
+      }
+      return true;
+    }
+    auto* br = (*branch)->cast<Break>();
+    if (EffectAnalyzer(getPassOptions(), br->condition).hasSideEffects()) {
+      // Keep the condition for its effects, which we can only do when it is
+      // not after a value.
+      if (br->value) return false;
+      auto* drop = builder.makeDrop(br->condition);
+      if (taken) {
+        br->condition = nullptr;
+        br->finalize();
+        *branch = builder.makeSequence(drop, br);
+      } else {
+        *branch = drop;
+      }
+      return true;
+    }
+    if (taken) {
+      br->condition = nullptr;
+      br->finalize();
+    } else {
+      *branch = br->value ? br->value : builder.makeNop();
+    }
+    return true;
+  }
+};
+
+} // anonymous namespace
+
+struct SCCP : public Pass {
+  bool preservesFunctionEffects() override { return true; }
+  void run(PassRunner* runner, Module* module) override {
+    SCCPStats stats;
+    PassRunner subRunner(module, runner->options);
+    subRunner.setIsNested(true);
+    subRunner.add<FunctionSCCP>(&stats);
+    subRunner.run();
+    if (runner->options.debug) {
+      std::cerr << "[sccp] propagated " << stats.constants << " constants and folded "
+                << stats.branches << " branches\n";
+    }
+  }
+};
+
+Pass *createSCCPPass() {
+  return new SCCP();
+}
+
+} // namespace wasm
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Sparse optimizations on the SSA view of a function (see ir/ssa-graph.h).
+// These work on any code, but are most effective after flatten, where every
+// value is in a local.
+//
+//  * SSACopyPropagation makes gets of a copy read the original local
+//    instead, where that local still holds the same value.
+//  * SSADeadValues removes sets whose values are never read, including
+//    values that only flow into phis or into the computation of other dead
+//    values, like a loop counter that nothing reads.
+//
+// Both leave work for other passes: after copy propagation the copies may
+// be dead, and removed sets leave nops and drops behind, which vacuum
+// removes. For example:
+//
+//    --flatten --ssa-copy-propagate --ssa-dead-values --vacuum
+//
+
+#include "wasm.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "ir/effects.h"
+#include "ir/find_all.h"
+#include "ir/ssa-graph.h"
+
+namespace wasm {
+
+struct SSACopyPropagation : public WalkerPass<PostWalker<SSACopyPropagation>> {
+  bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
+
+  Pass* create() override { return new SSACopyPropagation; }
+
+  void doWalkFunction(Function* func) {
+    SSAGraph graph(func);
+    std::vector<GetLocal*> work;
+    for (auto* get : FindAll<GetLocal>(func->body).list) {
+      if (graph.getValues.count(get)) {
+        work.push_back(get);
+      }
+    }
+    while (!work.empty()) {
+      auto* get = work.back();
+      work.pop_back();
+      auto* source = getCopySource(graph, graph.getValue(get));
+      if (!source) continue;
+      // The source's local must still hold the source value here.
+      if (graph.getValueBefore(get, source->index) != source) continue;
+      graph.redirectGet(get, source);
+      // The source may be a copy too.
+      work.push_back(get);
+    }
+  }
+
+  // If a value is a copy of another, returns that one.
+  SSAGraph::Value* getCopySource(SSAGraph& graph, SSAGraph::Value* value) {
+    if (value->kind != SSAGraph::Value::Set) return nullptr;
+    auto* copied = value->set->value;
+    if (auto* get = copied->dynCast<GetLocal>()) {
+      if (graph.getValues.count(get)) {
+        return graph.getValue(get);
+      }
+    } else if (auto* tee = copied->dynCast<SetLocal>()) {
+      if (graph.setValues.count(tee)) {
+        return graph.getValue(tee);
+      }
+    }
+    return nullptr;
+  }
+};
+
+struct SSADeadValues : public WalkerPass<PostWalker<SSADeadValues>> {
+  bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
+
+  Pass* create() override { return new SSADeadValues; }
+
+  void doWalkFunction(Function* func) {
+    SSAGraph graph(func);
+    // A set whose value has no side effects can be removed entirely when it
+    // is dead, and then the gets in its value are not needed either. Note
+    // the sets each get depends on in that way.
+    std::unordered_map<SSAGraph::Value*, std::vector<GetLocal*>> dependentGets;
+    std::unordered_set<GetLocal*> isDependent;
+    std::unordered_set<SetLocal*> removable;
+    auto sets = FindAll<SetLocal>(func->body).list;
+    for (auto* set : sets) {
+      if (!graph.setValues.count(set) || !isRemovable(set)) continue;
+      removable.insert(set);
+      auto& gets = dependentGets[graph.getValue(set)];
+      for (auto* get : FindAll<GetLocal>(set->value).list) {
+        if (graph.getValues.count(get)) {
+          gets.push_back(get);
+          isDependent.insert(get);
+        }
+      }
+    }
+    // A value is live if a needed get reads it, or a live phi merges it, and
+    // the gets a live set depends on are needed.
+    std::unordered_set<SSAGraph::Value*> live;
+    std::vector<SSAGraph::Value*> work;
+    for (auto& pair : graph.getValues) {
+      if (!isDependent.count(pair.first)) {
+        work.push_back(pair.second);
+      }
+    }
+    while (!work.empty()) {
+      auto* value = work.back();
+      work.pop_back();
+      if (!live.insert(value).second) continue;
+      for (auto* operand : value->operands) {
+        work.push_back(operand);
+      }
+      auto iter = dependentGets.find(value);
+      if (iter != dependentGets.end()) {
+        for (auto* get : iter->second) {
+          work.push_back(graph.getValue(get));
+        }
+      }
+    }
+    // Remove the sets of dead values. Children are visited before parents,
+    // so the locations of sets are still valid when we reach them. Removing
+    // dead values does not change what live gets read, and we are done with
+    // the graph, so we do not need to update it.
+    Builder builder(*getModule());
+    for (auto* set : sets) {
+      if (!graph.setValues.count(set)) continue;
+      if (live.count(graph.getValue(set))) continue;
+      auto* location = graph.locations[set];
+      if (set->isTee()) {
+        *location = set->value;
+      } else if (removable.count(set)) {
+        *location = builder.makeNop();
+      } else {
+        *location = builder.makeDrop(set->value);
+      }
+    }
+  }
+
+  bool isRemovable(SetLocal* set) {
+    return !set->isTee() &&
+           !EffectAnalyzer(getPassOptions(), set->value).hasSideEffects();
+  }
+};
+
+Pass* createSSACopyPropagationPass() {
+  return new SSACopyPropagation();
+}
+
+Pass* createSSADeadValuesPass() {
+  return new SSADeadValues();
+}
+
+} // namespace wasm
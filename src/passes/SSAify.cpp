@@ -24,8 +24,8 @@
 // require more than one input to a value is multiple assignments
 // to the same local, with the SSA guarantee that one and only one
 // of those assignments will arrive at the uses of that "merge local".
-// TODO: consider adding a "proper" phi node to the AST, that passes
-//       can utilize
+// Passes that want phis without changing the IR can use the SSA view in
+// ir/ssa-graph.h instead.
 //
 
 #include <iterator>
@@ -47,6 +47,7 @@ static SetLocal IMPOSSIBLE_SET;
 
 struct SSAify : public Pass {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
 
   Pass* create() override { return new SSAify; }
 
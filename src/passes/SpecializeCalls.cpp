@@ -0,0 +1,273 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Specializes functions for constant arguments that are passed to them at
+// hot call sites. DeadArgumentElimination can apply a constant only when
+// every call passes it; here, when a group of call sites passes the same
+// constants for some of the parameters, we clone the function, apply those
+// constants in the clone, optimize it, and redirect those calls to it.
+//
+// Call sites are weighted by their static hotness, which grows with the
+// depth of loops they are nested in. Only groups above a minimum hotness are
+// specialized, small enough functions are cloned, and the total growth is
+// bounded by a fraction of the module's code size. A clone is kept only if
+// optimizing it with the constants made it smaller than the original.
+//
+// The calls to a clone still pass the constants; a later run of DAE (as in
+// the default optimization pipeline) removes those parameters, as all the
+// calls to the clone are visible.
+//
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include "wasm.h"
+#include "pass.h"
+#include "wasm-builder.h"
+#include "ir/utils.h"
+#include "passes/opt-utils.h"
+
+namespace wasm {
+
+// Don't clone functions larger than this.
+static const Index SPECIALIZE_SIZE_LIMIT = 1000;
+
+// A group of calls must be at least this hot to be specialized. A call
+// outside of loops has a hotness of 1, and each enclosing loop multiplies
+// that by 10.
+static const Index SPECIALIZE_MIN_HOTNESS = 10;
+
+// The most clones to create for each function.
+static const Index SPECIALIZE_MAX_CLONES = 4;
+
+// The total size of the clones is at most this fraction of the code size,
+// or the minimum budget, if that is larger.
+static const Index SPECIALIZE_BUDGET_DIVISOR = 10;
+static const Index SPECIALIZE_MIN_BUDGET = 100;
+
+// The hotness of a call nested in a certain number of loops.
+static Index getHotness(Index loopDepth) {
+  Index hotness = 1;
+  for (Index i = 0; i < loopDepth && i < 3; i++) {
+    hotness *= 10;
+  }
+  return hotness;
+}
+
+struct CallSite {
+  Call* call;
+  Index hotness;
+
+  CallSite(Call* call, Index hotness) : call(call), hotness(hotness) {}
+};
+
+// Information for a function
+struct SpecializeFunctionInfo {
+  // The size of the function's body.
+  Index size = 0;
+  // The calls in this function to defined functions.
+  std::vector<CallSite> calls;
+};
+
+typedef std::unordered_map<Name, SpecializeFunctionInfo> SpecializeInfoMap;
+
+struct SpecializeScanner : public WalkerPass<PostWalker<SpecializeScanner>> {
+  bool isFunctionParallel() override { return true; }
+
+  SpecializeScanner(SpecializeInfoMap* infos) : infos(infos) {}
+
+  SpecializeScanner* create() override {
+    return new SpecializeScanner(infos);
+  }
+
+  Index loopDepth = 0;
+
+  static void incLoopDepth(SpecializeScanner* self, Expression** currp) {
+    self->loopDepth++;
+  }
+
+  static void decLoopDepth(SpecializeScanner* self, Expression** currp) {
+    self->loopDepth--;
+  }
+
+  static void scan(SpecializeScanner* self, Expression** currp) {
+    bool isLoop = (*currp)->is<Loop>();
+    if (isLoop) self->pushTask(decLoopDepth, currp);
+    PostWalker<SpecializeScanner>::scan(self, currp);
+    if (isLoop) self->pushTask(incLoopDepth, currp);
+  }
+
+  void visitCall(Call* curr) {
+    if (!getModule()->getFunction(curr->target)->imported()) {
+      (*infos)[getFunction()->name].calls.emplace_back(curr, getHotness(loopDepth));
+    }
+  }
+
+  void visitFunction(Function* curr) {
+    (*infos)[curr->name].size = Measurer::measure(curr->body);
+  }
+
+private:
+  SpecializeInfoMap* infos;
+};
+
+// Call sites that pass the same constants. A Literal of type none means
+// that parameter is not constant.
+struct SpecializationGroup {
+  std::vector<Literal> args;
+  std::vector<Call*> calls;
+  Index hotness = 0;
+};
+
+struct Specialization {
+  Function* original;
+  Function* clone;
+  SpecializationGroup* group;
+};
+
+struct SpecializeCalls : public Pass {
+  void run(PassRunner* runner, Module* module) override {
+    SpecializeInfoMap infos;
+    // Ensure they all exist so the parallel threads don't modify the data structure.
+    for (auto& func : module->functions) {
+      infos[func->name];
+    }
+    {
+      PassRunner runner(module);
+      runner.setIsNested(true);
+      runner.add<SpecializeScanner>(&infos);
+      runner.run();
+    }
+    // Gather the calls to each function, in a deterministic order.
+    Index totalSize = 0;
+    std::unordered_map<Name, std::vector<CallSite>> allCalls;
+    for (auto& func : module->functions) {
+      auto& info = infos[func->name];
+      totalSize += info.size;
+      for (auto& site : info.calls) {
+        allCalls[site.call->target].push_back(site);
+      }
+    }
+    Index budget = std::max(totalSize / SPECIALIZE_BUDGET_DIVISOR, SPECIALIZE_MIN_BUDGET);
+    // Group the calls to each function by their constant arguments, and
+    // pick the hottest groups.
+    std::unordered_map<Name, std::vector<SpecializationGroup>> allGroups;
+    std::vector<Specialization> specializations;
+    // Note that we add clones to the module as we go.
+    auto numFunctions = module->functions.size();
+    for (Index i = 0; i < numFunctions; i++) {
+      auto* func = module->functions[i].get();
+      if (func->imported() || func->stackIR) continue;
+      if (func->getNumParams() == 0) continue;
+      auto size = infos[func->name].size;
+      if (size > SPECIALIZE_SIZE_LIMIT) continue;
+      auto iter = allCalls.find(func->name);
+      if (iter == allCalls.end()) continue;
+      auto& groups = allGroups[func->name];
+      for (auto& site : iter->second) {
+        std::vector<Literal> args;
+        bool anyConstant = false;
+        for (auto* operand : site.call->operands) {
+          if (auto* c = operand->dynCast<Const>()) {
+            args.push_back(c->value);
+            anyConstant = true;
+          } else {
+            args.push_back(Literal());
+          }
+        }
+        if (!anyConstant) continue;
+        auto groupIter = std::find_if(groups.begin(), groups.end(), [&](const SpecializationGroup& group) {
+          return group.args == args;
+        });
+        if (groupIter == groups.end()) {
+          groups.emplace_back();
+          groupIter = groups.end() - 1;
+          groupIter->args = args;
+        }
+        groupIter->calls.push_back(site.call);
+        groupIter->hotness += site.hotness;
+      }
+      std::stable_sort(groups.begin(), groups.end(), [](const SpecializationGroup& a, const SpecializationGroup& b) {
+        return a.hotness > b.hotness;
+      });
+      for (Index j = 0; j < groups.size() && j < SPECIALIZE_MAX_CLONES; j++) {
+        auto& group = groups[j];
+        if (group.hotness < SPECIALIZE_MIN_HOTNESS || size > budget) break;
+        budget -= size;
+        specializations.push_back({ func, makeClone(func, group, module), &group });
+      }
+    }
+    if (specializations.empty()) return;
+    // Optimize the clones with the constants applied.
+    std::unordered_set<Function*> clones;
+    for (auto& specialization : specializations) {
+      clones.insert(specialization.clone);
+    }
+    OptUtils::optimizeAfterInlining(clones, module, runner);
+    // Keep the clones that were improved, and redirect their calls.
+    for (auto& specialization : specializations) {
+      auto* clone = specialization.clone;
+      if (Measurer::measure(clone->body) < infos[specialization.original->name].size) {
+        for (auto* call : specialization.group->calls) {
+          call->target = clone->name;
+        }
+      } else {
+        module->removeFunction(clone->name);
+      }
+    }
+  }
+
+private:
+  Function* makeClone(Function* func, SpecializationGroup& group, Module* module) {
+    Name name;
+    Index i = 0;
+    do {
+      name = Name(std::string(func->name.str) + "$specialized" + std::to_string(i++));
+    } while (module->getFunctionOrNull(name));
+    auto* clone = new Function();
+    clone->name = name;
+    clone->result = func->result;
+    clone->params = func->params;
+    clone->vars = func->vars;
+    clone->type = func->type;
+    clone->localNames = func->localNames;
+    clone->localIndices = func->localIndices;
+    clone->body = ExpressionManipulator::copy(func->body, *module);
+    // Apply the constants at the start of the body, where the
+    // optimizer can propagate them.
+    Builder builder(*module);
+    std::vector<Expression*> sets;
+    for (Index j = 0; j < group.args.size(); j++) {
+      auto& value = group.args[j];
+      if (value.type != none) {
+        sets.push_back(builder.makeSetLocal(j, builder.makeConst(value)));
+      }
+    }
+    sets.push_back(clone->body);
+    auto* block = builder.makeBlock(sets);
+    block->finalize(func->result);
+    clone->body = block;
+    module->addFunction(clone);
+    return clone;
+  }
+};
+
+Pass *createSpecializeCallsPass() {
+  return new SpecializeCalls();
+}
+
+} // namespace wasm
@@ -17,11 +17,19 @@
 //
 // Removes obviously unneeded code
 //
+// The "cleanup" variant also does the work of remove-unused-names in the
+// same walk: names that are never branched to are removed, and a named
+// block whose only child is a named block is merged into it. Removing the
+// names first lets more blocks be simplified away here, so one walk can get
+// further than running vacuum and then remove-unused-names, and running it
+// twice reaches the result of running those two rounds of each.
+//
 
 #include <wasm.h>
 #include <pass.h>
 #include <wasm-builder.h>
 #include <ir/block-utils.h>
+#include <ir/branch-utils.h>
 #include <ir/effects.h>
 #include <ir/type-updating.h>
 
@@ -29,8 +37,13 @@ namespace wasm {
 
 struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
   bool isFunctionParallel() override { return true; }
+  bool preservesFunctionEffects() override { return true; }
+
+  Pass* create() override { return new Vacuum(removeUnusedNames); }
 
-  Pass* create() override { return new Vacuum; }
+  bool removeUnusedNames;
+
+  Vacuum(bool removeUnusedNames) : removeUnusedNames(removeUnusedNames) {}
 
   TypeUpdater typeUpdater;
 
@@ -62,7 +75,6 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
 
         case Expression::Id::BreakId:
         case Expression::Id::SwitchId:
-        case Expression::Id::CallId:
         case Expression::Id::CallIndirectId:
         case Expression::Id::SetLocalId:
         case Expression::Id::StoreId:
@@ -71,6 +83,15 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
         case Expression::Id::HostId:
         case Expression::Id::UnreachableId: return curr; // always needed
 
+        case Expression::Id::CallId: {
+          // if we know what the called function may do, it might be nothing
+          // that is noticeable
+          if (!resultUsed && getPassOptions().funcEffectsMap &&
+              !EffectAnalyzer(getPassOptions(), curr).hasSideEffects()) {
+            return nullptr;
+          }
+          return curr;
+        }
         case Expression::Id::LoadId: {
           // it is ok to remove a load if the result is not used, and it has no
           // side effects (the load itself may trap, if we are not ignoring such things)
@@ -166,6 +187,52 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
     }
   }
 
+  // The type updater tracks the number of branches to each name as we
+  // remove code, which is all we need to know whether a name is used.
+  bool hasBranches(Name name) {
+    return typeUpdater.blockInfos[name].numBreaks > 0;
+  }
+
+  // Removes an unused name, or merges a named block into its only child,
+  // if that is also a named block. Returns the child if we merged.
+  Block* optimizeBlockName(Block* curr) {
+    if (!curr->name.is()) return nullptr;
+    if (!hasBranches(curr->name)) {
+      curr->name = Name();
+      return nullptr;
+    }
+    if (curr->list.size() != 1) return nullptr;
+    auto* child = curr->list[0]->dynCast<Block>();
+    if (!child || !child->name.is() || child->type != curr->type) return nullptr;
+    // breaking out of the child goes to the same place as breaking out of
+    // us, so we just need one name (and block)
+    struct BranchFinder : public PostWalker<BranchFinder> {
+      std::vector<Expression*> branches;
+      void visitBreak(Break* curr) { branches.push_back(curr); }
+      void visitSwitch(Switch* curr) { branches.push_back(curr); }
+    };
+    BranchFinder finder;
+    finder.walk(curr->list[0]);
+    // move the branch counts over as well. the types do not change, as
+    // both blocks already have the same type.
+    auto& from = typeUpdater.blockInfos[curr->name];
+    auto& to = typeUpdater.blockInfos[child->name];
+    for (auto* branch : finder.branches) {
+      bool alreadyToChild;
+      if (auto* br = branch->dynCast<Break>()) {
+        alreadyToChild = br->name == child->name;
+      } else {
+        alreadyToChild = BranchUtils::getUniqueTargets(branch->cast<Switch>()).count(child->name) > 0;
+      }
+      if (BranchUtils::replacePossibleTarget(branch, curr->name, child->name)) {
+        from.numBreaks--;
+        if (!alreadyToChild) to.numBreaks++;
+      }
+    }
+    child->finalize(child->type);
+    return child;
+  }
+
   void visitBlock(Block *curr) {
     // compress out nops and other dead code
     int skip = 0;
@@ -205,6 +272,12 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
       list.resize(size - skip);
       typeUpdater.maybeUpdateTypeToUnreachable(curr);
     }
+    if (removeUnusedNames) {
+      if (auto* child = optimizeBlockName(curr)) {
+        replaceCurrent(child);
+        return;
+      }
+    }
     // the block may now be a trivial one that we can get rid of and just leave its contents
     replaceCurrent(BlockUtils::simplifyToContents(curr, this));
   }
@@ -270,7 +343,18 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
   }
 
   void visitLoop(Loop* curr) {
-    if (curr->body->is<Nop>()) ExpressionManipulator::nop(curr);
+    if (curr->body->is<Nop>()) {
+      ExpressionManipulator::nop(curr);
+      return;
+    }
+    if (removeUnusedNames) {
+      if (curr->name.is() && !hasBranches(curr->name)) {
+        curr->name = Name();
+      }
+      if (!curr->name.is()) {
+        replaceCurrent(curr->body);
+      }
+    }
   }
 
   void visitDrop(Drop* curr) {
@@ -356,7 +440,11 @@ struct Vacuum : public WalkerPass<PostWalker<Vacuum>> {
 };
 
 Pass *createVacuumPass() {
-  return new Vacuum();
+  return new Vacuum(false);
+}
+
+Pass *createCleanupPass() {
+  return new Vacuum(true);
 }
 
 } // namespace wasm
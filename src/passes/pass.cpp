@@ -15,15 +15,19 @@
  */
 
 #include <chrono>
+#include <mutex>
 #include <sstream>
 
 #include "support/colors.h"
+#include "support/memory.h"
 #include "passes/passes.h"
 #include "pass.h"
 #include "wasm-validator.h"
 #include "wasm-io.h"
+#include "ir/effects.h"
 #include "ir/hashed.h"
 #include "ir/module-utils.h"
+#include "ir/utils.h"
 
 namespace wasm {
 
@@ -69,6 +73,7 @@ std::string PassRegistry::getPassDescription(std::string name) {
 void PassRegistry::registerPasses() {
   registerPass("dae", "removes arguments to calls in an lto-like manner", createDAEPass);
   registerPass("dae-optimizing", "removes arguments to calls in an lto-like manner, and optimizes where we removed", createDAEOptimizingPass);
+  registerPass("cleanup", "removes obviously unneeded code and unused names, in a single walk", createCleanupPass);
   registerPass("coalesce-locals", "reduce # of locals by coalescing", createCoalesceLocalsPass);
   registerPass("coalesce-locals-learning", "reduce # of locals by coalescing and learning", createCoalesceLocalsWithLearningPass);
   registerPass("code-pushing", "push code forward, potentially making it not always execute", createCodePushingPass);
@@ -76,11 +81,13 @@ void PassRegistry::registerPasses() {
   registerPass("const-hoisting", "hoist repeated constants to a local", createConstHoistingPass);
   registerPass("dce", "removes unreachable code", createDeadCodeEliminationPass);
   registerPass("dfo", "optimizes using the DataFlow SSA IR", createDataFlowOptsPass);
+  registerPass("discard-function-effects", "discards the effects summaries of functions from generate-function-effects", createDiscardFunctionEffectsPass);
   registerPass("duplicate-function-elimination", "removes duplicate functions", createDuplicateFunctionEliminationPass);
   registerPass("extract-function", "leaves just one function (useful for debugging)", createExtractFunctionPass);
   registerPass("flatten", "flattens out code, removing nesting", createFlattenPass);
   registerPass("fpcast-emu", "emulates function pointer casts, allowing incorrect indirect calls to (sometimes) work", createFuncCastEmulationPass);
   registerPass("func-metrics", "reports function metrics", createFunctionMetricsPass);
+  registerPass("generate-function-effects", "computes the effects of calling each function, so optimizations can move code across calls", createGenerateFunctionEffectsPass);
   registerPass("generate-stack-ir", "generate Stack IR", createGenerateStackIRPass);
   registerPass("inlining", "inline functions (you probably want inlining-optimizing)", createInliningPass);
   registerPass("inlining-optimizing", "inline functions and optimizes where we inlined", createInliningOptimizingPass);
@@ -118,10 +125,12 @@ void PassRegistry::registerPasses() {
   registerPass("remove-unused-nonfunction-module-elements", "removes unused module elements that are not functions", createRemoveUnusedNonFunctionModuleElementsPass);
   registerPass("remove-unused-names", "removes names from locations that are never branched to", createRemoveUnusedNamesPass);
   registerPass("reorder-functions", "sorts functions by access frequency", createReorderFunctionsPass);
+  registerPass("reorder-functions-by-similarity", "sorts functions to place similar ones together, for better compression", createReorderFunctionsBySimilarityPass);
   registerPass("reorder-locals", "sorts locals by access frequency", createReorderLocalsPass);
   registerPass("rereloop", "re-optimize control flow using the relooper algorithm", createReReloopPass);
   registerPass("rse", "remove redundant set_locals", createRedundantSetEliminationPass);
   registerPass("safe-heap", "instrument loads and stores to check for invalid behavior", createSafeHeapPass);
+  registerPass("sccp", "sparse conditional constant propagation, which also removes code behind constant conditions", createSCCPPass);
   registerPass("simplify-locals", "miscellaneous locals-related optimizations", createSimplifyLocalsPass);
   registerPass("simplify-locals-nonesting", "miscellaneous locals-related optimizations (no nesting at all; preserves flatness)", createSimplifyLocalsNoNestingPass);
   registerPass("simplify-locals-notee", "miscellaneous locals-related optimizations (no tees)", createSimplifyLocalsNoTeePass);
@@ -129,8 +138,11 @@ void PassRegistry::registerPasses() {
   registerPass("simplify-locals-notee-nostructure", "miscellaneous locals-related optimizations (no tees or structure)", createSimplifyLocalsNoTeeNoStructurePass);
   registerPass("souperify", "emit Souper IR in text form", createSouperifyPass);
   registerPass("souperify-single-use", "emit Souper IR in text form (single-use nodes only)", createSouperifySingleUsePass);
+  registerPass("specialize-calls", "clones functions for constant arguments passed at hot call sites", createSpecializeCallsPass);
   registerPass("spill-pointers", "spill pointers to the C stack (useful for Boehm-style GC)", createSpillPointersPass);
   registerPass("ssa", "ssa-ify variables so that they have a single assignment", createSSAifyPass);
+  registerPass("ssa-copy-propagate", "makes gets of copies read the original locals, using the SSA view", createSSACopyPropagationPass);
+  registerPass("ssa-dead-values", "removes sets whose values are never read, using the SSA view", createSSADeadValuesPass);
   registerPass("trap-mode-clamp", "replace trapping operations with clamping semantics", createTrapModeClamp);
   registerPass("trap-mode-js", "replace trapping operations with js semantics", createTrapModeJS);
   registerPass("untee", "removes tee_locals, replacing them with sets and gets", createUnteePass);
@@ -161,6 +173,9 @@ void PassRunner::addDefaultFunctionOptimizationPasses() {
     add("pick-load-signs");
   }
   // early propagation
+  if (options.optimizeLevel >= 3) {
+    add("sccp");
+  }
   if (options.optimizeLevel >= 3 || options.shrinkLevel >= 2) {
     add("precompute-propagate");
   } else {
@@ -219,8 +234,9 @@ void PassRunner::addDefaultGlobalOptimizationPostPasses() {
   add("remove-unused-module-elements");
   add("memory-packing");
   // perform Stack IR optimizations here, at the very end of the
-  // optimization pipeline
-  if (options.optimizeLevel >= 2 || options.shrinkLevel >= 1) {
+  // optimization pipeline, unless the writer will do them
+  if ((options.optimizeLevel >= 2 || options.shrinkLevel >= 1) &&
+      !options.optimizeStackIRInWriter) {
     add("generate-stack-ir");
     add("optimize-stack-ir");
   }
@@ -242,6 +258,8 @@ static void dumpWast(Name name, Module* wasm) {
 
 void PassRunner::run() {
   static const int passDebug = getPassDebug();
+  // The seconds spent running passes on each function, for the budgets.
+  std::unordered_map<Name, double> functionSeconds;
   if (!isNested && (options.debug || passDebug)) {
     // for debug logging purposes, run each pass in full before running the other
     auto totalTime = std::chrono::duration<double>(0);
@@ -268,11 +286,12 @@ void PassRunner::run() {
       for (size_t i = 0; i < padding - pass->name.size(); i++) {
         std::cerr << ' ';
       }
+      handleBeforeEffects(pass);
       auto before = std::chrono::steady_clock::now();
       if (pass->isFunctionParallel()) {
         // function-parallel passes should get a new instance per function
         ModuleUtils::iterDefinedFunctions(*wasm, [&](Function* func) {
-          runPassOnFunction(pass, func);
+          runPassOnFunction(pass, func, functionSeconds[func->name]);
         });
       } else {
         runPass(pass);
@@ -316,6 +335,10 @@ void PassRunner::run() {
         std::atomic<size_t> nextFunction;
         nextFunction.store(0);
         size_t numFunctions = wasm->functions.size();
+        // Create the entries now, so the workers do not modify the map.
+        for (auto& func : wasm->functions) {
+          functionSeconds[func->name];
+        }
         for (size_t i = 0; i < num; i++) {
           doWorkers.push_back([&]() {
             auto index = nextFunction.fetch_add(1);
@@ -326,8 +349,9 @@ void PassRunner::run() {
             Function* func = this->wasm->functions[index].get();
             if (!func->imported()) {
               // do the current task: run all passes on this function
+              auto& seconds = functionSeconds.at(func->name);
               for (auto* pass : stack) {
-                runPassOnFunction(pass, func);
+                runPassOnFunction(pass, func, seconds);
               }
             }
             if (index + 1 == numFunctions) {
@@ -341,6 +365,11 @@ void PassRunner::run() {
       stack.clear();
     };
     for (auto* pass : passes) {
+      if (options.funcEffectsMap && !pass->preservesFunctionEffects()) {
+        // passes before this one may still use the summaries
+        flush();
+        handleBeforeEffects(pass);
+      }
       if (pass->isFunctionParallel()) {
         stack.push_back(pass);
       } else {
@@ -356,8 +385,10 @@ void PassRunner::runOnFunction(Function* func) {
   if (options.debug) {
     std::cerr << "[PassRunner] running passes on function " << func->name << std::endl;
   }
+  double seconds = 0;
   for (auto* pass : passes) {
-    runPassOnFunction(pass, func);
+    handleBeforeEffects(pass);
+    runPassOnFunction(pass, func, seconds);
   }
 }
 
@@ -466,29 +497,99 @@ void PassRunner::runPass(Pass* pass) {
     checker = std::unique_ptr<AfterEffectModuleChecker>(
       new AfterEffectModuleChecker(wasm));
   }
+  // Memory used in nested runners counts towards the pass that runs them.
+  bool profileMemory = MemoryProfile::enabled && !isNested;
+  MemoryProfile::Counts countsBefore;
+  size_t rssBefore = 0;
+  if (profileMemory) {
+    countsBefore = MemoryProfile::getTotalCounts();
+    rssBefore = MemoryProfile::getPeakRSS();
+  }
   pass->run(this, wasm);
+  if (profileMemory) {
+    MemoryProfile::record(pass->name, "", MemoryProfile::getTotalCounts() - countsBefore, MemoryProfile::getPeakRSS() - rssBefore);
+  }
   handleAfterEffects(pass);
   if (getPassDebug()) {
     checker->check();
   }
 }
 
-void PassRunner::runPassOnFunction(Pass* pass, Function* func) {
+void PassRunner::runPassOnFunction(Pass* pass, Function* func, double& seconds) {
   assert(pass->isFunctionParallel());
   // function-parallel passes get a new instance per function
-  auto instance = std::unique_ptr<Pass>(pass->create());
+  std::unique_ptr<Pass> instance;
+  auto* name = &pass->name;
+  if (pass->isExpensive()) {
+    auto excess = getBudgetExcess(func, seconds);
+    if (!excess.empty()) {
+      instance = std::unique_ptr<Pass>(pass->createDowngraded());
+      // Log the decision in a single write, as we may be on a worker thread.
+      std::stringstream message;
+      message << "[PassRunner] " << func->name << " is over the budget for expensive passes (" << excess << "): ";
+      if (instance) {
+        message << "running " << instance->name << " instead of " << pass->name << '\n';
+      } else {
+        message << "skipping " << pass->name << '\n';
+      }
+      static std::mutex logMutex;
+      {
+        std::lock_guard<std::mutex> lock(logMutex);
+        std::cerr << message.str();
+      }
+      if (!instance) {
+        return;
+      }
+      name = &instance->name;
+    }
+  }
+  if (!instance) {
+    instance = std::unique_ptr<Pass>(pass->create());
+  }
+  std::chrono::steady_clock::time_point before;
+  if (options.expensivePassTimeLimit) {
+    before = std::chrono::steady_clock::now();
+  }
   std::unique_ptr<AfterEffectFunctionChecker> checker;
   if (getPassDebug()) {
     checker = std::unique_ptr<AfterEffectFunctionChecker>(
       new AfterEffectFunctionChecker(func));
   }
+  // Everything the pass allocates on this function is on this thread.
+  bool profileMemory = MemoryProfile::enabled && !isNested;
+  MemoryProfile::Counts countsBefore;
+  size_t rssBefore = 0;
+  if (profileMemory) {
+    countsBefore = MemoryProfile::getThreadCounts();
+    rssBefore = MemoryProfile::getPeakRSS();
+  }
   instance->runOnFunction(this, wasm, func);
+  if (profileMemory) {
+    MemoryProfile::record(*name, func->name.str, MemoryProfile::getThreadCounts() - countsBefore, MemoryProfile::getPeakRSS() - rssBefore);
+  }
+  if (options.expensivePassTimeLimit) {
+    std::chrono::duration<double> diff = std::chrono::steady_clock::now() - before;
+    seconds += diff.count();
+  }
   handleAfterEffects(pass, func);
   if (getPassDebug()) {
     checker->check();
   }
 }
 
+std::string PassRunner::getBudgetExcess(Function* func, double seconds) {
+  if (options.expensivePassSizeLimit) {
+    auto size = Measurer::measure(func->body);
+    if (size > options.expensivePassSizeLimit) {
+      return std::to_string(size) + " expressions";
+    }
+  }
+  if (options.expensivePassTimeLimit && seconds > options.expensivePassTimeLimit) {
+    return "passes took " + std::to_string(seconds) + " seconds on it";
+  }
+  return "";
+}
+
 void PassRunner::handleAfterEffects(Pass* pass, Function* func) {
   if (pass->modifiesBinaryenIR()) {
     // If Binaryen IR is modified, Stack IR must be cleared - it would
@@ -503,6 +604,14 @@ void PassRunner::handleAfterEffects(Pass* pass, Function* func) {
   }
 }
 
+void PassRunner::handleBeforeEffects(Pass* pass) {
+  if (!pass->preservesFunctionEffects()) {
+    // The pass may add effects to functions, so the summaries could become
+    // wrong.
+    options.funcEffectsMap.reset();
+  }
+}
+
 int PassRunner::getPassDebug() {
   static const int passDebug = getenv("BINARYEN_PASS_DEBUG") ? atoi(getenv("BINARYEN_PASS_DEBUG")) : 0;
   return passDebug;
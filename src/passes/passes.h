@@ -22,6 +22,7 @@ namespace wasm {
 class Pass;
 
 // All passes:
+Pass* createCleanupPass();
 Pass* createCoalesceLocalsPass();
 Pass* createCoalesceLocalsWithLearningPass();
 Pass* createCodeFoldingPass();
@@ -31,12 +32,14 @@ Pass* createDAEPass();
 Pass* createDAEOptimizingPass();
 Pass* createDataFlowOptsPass();
 Pass* createDeadCodeEliminationPass();
+Pass* createDiscardFunctionEffectsPass();
 Pass* createDuplicateFunctionEliminationPass();
 Pass* createExtractFunctionPass();
 Pass* createFlattenPass();
 Pass* createFuncCastEmulationPass();
 Pass* createFullPrinterPass();
 Pass* createFunctionMetricsPass();
+Pass* createGenerateFunctionEffectsPass();
 Pass* createGenerateStackIRPass();
 Pass* createI64ToI32LoweringPass();
 Pass* createInliningPass();
@@ -73,10 +76,12 @@ Pass* createRemoveUnusedModuleElementsPass();
 Pass* createRemoveUnusedNonFunctionModuleElementsPass();
 Pass* createRemoveUnusedNamesPass();
 Pass* createReorderFunctionsPass();
+Pass* createReorderFunctionsBySimilarityPass();
 Pass* createReorderLocalsPass();
 Pass* createReReloopPass();
 Pass* createRedundantSetEliminationPass();
 Pass* createSafeHeapPass();
+Pass* createSCCPPass();
 Pass* createSimplifyLocalsPass();
 Pass* createSimplifyLocalsNoNestingPass();
 Pass* createSimplifyLocalsNoTeePass();
@@ -84,8 +89,11 @@ Pass* createSimplifyLocalsNoStructurePass();
 Pass* createSimplifyLocalsNoTeeNoStructurePass();
 Pass* createSouperifyPass();
 Pass* createSouperifySingleUsePass();
+Pass* createSpecializeCallsPass();
 Pass* createSpillPointersPass();
 Pass* createSSAifyPass();
+Pass* createSSACopyPropagationPass();
+Pass* createSSADeadValuesPass();
 Pass* createTrapModeClamp();
 Pass* createTrapModeJS();
 Pass* createUnteePass();
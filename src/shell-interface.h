@@ -21,6 +21,14 @@
 #ifndef wasm_shell_interface_h
 #define wasm_shell_interface_h
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 #include "shared-constants.h"
 #include "asmjs/shared-constants.h"
 #include "support/name.h"
@@ -33,6 +41,110 @@ namespace wasm {
 struct ExitException {};
 struct TrapException {};
 
+// A memory that several instances can use at once, each on its own thread
+// and with its own ShellExternalInterface. The storage for the maximum size
+// is allocated up front, so growing never moves it, and atomic accesses are
+// done with real atomic operations on it. Waiting and waking work like a
+// futex: waiters queue up per address, and are woken in order.
+class SharedMemory {
+  char* data;
+  size_t capacity;
+  // The size in pages.
+  std::atomic<uint32_t> size;
+
+  struct Waiter {
+    std::condition_variable condition;
+    bool woken = false;
+  };
+  std::mutex waitMutex;
+  std::unordered_map<Address::address_t, std::list<Waiter*>> waiters;
+
+  SharedMemory(SharedMemory&) = delete;
+  SharedMemory& operator=(const SharedMemory&) = delete;
+
+ public:
+  SharedMemory(Address initial, Address max) : size(initial) {
+    capacity = std::max(size_t(max) * wasm::Memory::kPageSize, size_t(1));
+    // calloc lets the system provide zeroed pages lazily, so reserving the
+    // maximum costs little until it is used.
+    data = static_cast<char*>(calloc(capacity, 1));
+    if (!data) {
+      Fatal() << "could not allocate a shared memory of " << capacity << " bytes";
+    }
+  }
+  ~SharedMemory() { free(data); }
+
+  char* getData() { return data; }
+
+  Address getSize() { return size.load(); }
+
+  Address grow(Address delta, Address max) {
+    uint32_t old = size.load();
+    do {
+      if (delta > max || old > max - delta) return Address(uint32_t(-1));
+    } while (!size.compare_exchange_weak(old, old + delta));
+    return old;
+  }
+
+  template<typename T>
+  std::atomic<T>* getAtomic(size_t address) {
+    static_assert(sizeof(std::atomic<T>) == sizeof(T), "atomics must be the size of the values");
+    assert(address % sizeof(T) == 0 && address + sizeof(T) <= capacity);
+    return reinterpret_cast<std::atomic<T>*>(data + address);
+  }
+
+  template<typename T>
+  int32_t wait(size_t address, T expected, int64_t timeout) {
+    std::unique_lock<std::mutex> lock(waitMutex);
+    // Check the value while holding the lock, so a wake that happens after
+    // the memory changed cannot be missed.
+    if (getAtomic<T>(address)->load() != expected) {
+      return 1;
+    }
+    Waiter waiter;
+    auto& queue = waiters[address];
+    queue.push_back(&waiter);
+    // A timeout of centuries is as good as forever, and avoids overflowing
+    // the clock.
+    if (timeout < 0 || timeout >= (int64_t(1) << 62)) {
+      waiter.condition.wait(lock, [&]() { return waiter.woken; });
+    } else {
+      waiter.condition.wait_for(lock, std::chrono::nanoseconds(timeout), [&]() { return waiter.woken; });
+    }
+    if (waiter.woken) {
+      return 0;
+    }
+    // Nothing woke us, so we are still in the queue.
+    auto& remaining = waiters[address];
+    remaining.remove(&waiter);
+    if (remaining.empty()) {
+      waiters.erase(address);
+    }
+    return 2;
+  }
+
+  uint32_t wake(size_t address, uint32_t count) {
+    std::lock_guard<std::mutex> lock(waitMutex);
+    auto iter = waiters.find(address);
+    if (iter == waiters.end()) {
+      return 0;
+    }
+    auto& queue = iter->second;
+    uint32_t woken = 0;
+    while (woken < count && !queue.empty()) {
+      auto* waiter = queue.front();
+      queue.pop_front();
+      waiter->woken = true;
+      waiter->condition.notify_one();
+      woken++;
+    }
+    if (queue.empty()) {
+      waiters.erase(iter);
+    }
+    return woken;
+  }
+};
+
 struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
   // The underlying memory can be accessed through unaligned pointers which
   // isn't well-behaved in C++. WebAssembly nonetheless expects it to behave
@@ -44,6 +156,9 @@ struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
   class Memory {
     // Use char because it doesn't run afoul of aliasing rules.
     std::vector<char> memory;
+    // If the memory is shared with other instances, what we access instead.
+    std::shared_ptr<SharedMemory> shared;
+    char* base = nullptr;
     template<typename T>
     static bool aligned(const char* address) {
       static_assert(!(sizeof(T) & (sizeof(T) - 1)), "must be a power of 2");
@@ -54,7 +169,18 @@ struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
 
    public:
     Memory() {}
+    void share(std::shared_ptr<SharedMemory> newShared) {
+      shared = newShared;
+      base = shared->getData();
+    }
+    SharedMemory* getShared() { return shared.get(); }
+    // Whether other instances may access the memory, and so wake waiters.
+    bool hasOtherUsers() { return shared.use_count() > 1; }
     void resize(size_t newSize) {
+      if (shared) {
+        // The shared storage has room for the maximum size already.
+        return;
+      }
       // Ensure the smallest allocation is large enough that most allocators
       // will provide page-aligned storage. This hopefully allows the
       // interpreter's memory to be as aligned as the memory being simulated,
@@ -67,22 +193,23 @@ struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
       if (newSize < oldSize && newSize < minSize) {
         std::memset(&memory[newSize], 0, minSize - newSize);
       }
+      base = memory.data();
     }
     template<typename T>
     void set(size_t address, T value) {
-      if (aligned<T>(&memory[address])) {
-        *reinterpret_cast<T*>(&memory[address]) = value;
+      if (aligned<T>(&base[address])) {
+        *reinterpret_cast<T*>(&base[address]) = value;
       } else {
-        std::memcpy(&memory[address], &value, sizeof(T));
+        std::memcpy(&base[address], &value, sizeof(T));
       }
     }
     template<typename T>
     T get(size_t address) {
-      if (aligned<T>(&memory[address])) {
-        return *reinterpret_cast<T*>(&memory[address]);
+      if (aligned<T>(&base[address])) {
+        return *reinterpret_cast<T*>(&base[address]);
       } else {
         T loaded;
-        std::memcpy(&loaded, &memory[address], sizeof(T));
+        std::memcpy(&loaded, &base[address], sizeof(T));
         return loaded;
       }
     }
@@ -92,7 +219,16 @@ struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
 
   ShellExternalInterface() : memory() {}
 
+  // Use a memory that other instances, possibly on other threads, use too.
+  // The module must have a shared memory whose limits fit in it.
+  ShellExternalInterface(std::shared_ptr<SharedMemory> shared) : memory() {
+    memory.share(shared);
+  }
+
   void init(Module& wasm, ModuleInstance& instance) override {
+    if (wasm.memory.shared && !memory.getShared()) {
+      memory.share(std::make_shared<SharedMemory>(wasm.memory.initial, wasm.memory.max));
+    }
     memory.resize(wasm.memory.initial * wasm::Memory::kPageSize);
     // apply memory segments
     for (auto& segment : wasm.memory.segments) {
@@ -192,6 +328,133 @@ struct ShellExternalInterface final : ModuleInstance::ExternalInterface {
     memory.resize(newSize);
   }
 
+  // Atomic accesses are aligned, so they can be done directly on the
+  // storage, which makes them atomic with respect to other threads when the
+  // memory is shared.
+  template<typename T>
+  std::atomic<T>* getAtomic(Address addr) {
+    if (auto* shared = memory.getShared()) {
+      return shared->getAtomic<T>(addr);
+    }
+    return nullptr;
+  }
+
+  template<typename T>
+  Literal makeLiteral(T value, Type type) {
+    return type == i32 ? Literal(uint32_t(value)) : Literal(uint64_t(value));
+  }
+
+  template<typename T>
+  Literal doAtomicRMW(AtomicRMWOp op, std::atomic<T>* atomic, Literal value) {
+    T operand = value.type == i32 ? T(value.geti32()) : T(value.geti64());
+    T old;
+    switch (op) {
+      case Add:  old = atomic->fetch_add(operand); break;
+      case Sub:  old = atomic->fetch_sub(operand); break;
+      case And:  old = atomic->fetch_and(operand); break;
+      case Or:   old = atomic->fetch_or(operand);  break;
+      case Xor:  old = atomic->fetch_xor(operand); break;
+      case Xchg: old = atomic->exchange(operand);  break;
+      default: WASM_UNREACHABLE();
+    }
+    return makeLiteral(old, value.type);
+  }
+
+  template<typename T>
+  Literal doAtomicCmpxchg(std::atomic<T>* atomic, Literal expected, Literal replacement) {
+    T old = expected.type == i32 ? T(expected.geti32()) : T(expected.geti64());
+    T desired = replacement.type == i32 ? T(replacement.geti32()) : T(replacement.geti64());
+    // On failure this loads the current value, which is what we return.
+    atomic->compare_exchange_strong(old, desired);
+    return makeLiteral(old, expected.type);
+  }
+
+  Literal atomicLoad(Address addr, Index bytes, Type type) override {
+    if (!memory.getShared()) {
+      return ModuleInstance::ExternalInterface::atomicLoad(addr, bytes, type);
+    }
+    switch (bytes) {
+      case 1: return makeLiteral(getAtomic<uint8_t>(addr)->load(), type);
+      case 2: return makeLiteral(getAtomic<uint16_t>(addr)->load(), type);
+      case 4: return makeLiteral(getAtomic<uint32_t>(addr)->load(), type);
+      case 8: return makeLiteral(getAtomic<uint64_t>(addr)->load(), type);
+      default: WASM_UNREACHABLE();
+    }
+  }
+
+  void atomicStore(Address addr, Index bytes, Literal value) override {
+    if (!memory.getShared()) {
+      return ModuleInstance::ExternalInterface::atomicStore(addr, bytes, value);
+    }
+    uint64_t bits = value.type == i32 ? uint32_t(value.geti32()) : value.geti64();
+    switch (bytes) {
+      case 1: getAtomic<uint8_t>(addr)->store(bits); break;
+      case 2: getAtomic<uint16_t>(addr)->store(bits); break;
+      case 4: getAtomic<uint32_t>(addr)->store(bits); break;
+      case 8: getAtomic<uint64_t>(addr)->store(bits); break;
+      default: WASM_UNREACHABLE();
+    }
+  }
+
+  Literal atomicRMW(AtomicRMWOp op, Address addr, Index bytes, Literal value) override {
+    if (!memory.getShared()) {
+      return ModuleInstance::ExternalInterface::atomicRMW(op, addr, bytes, value);
+    }
+    switch (bytes) {
+      case 1: return doAtomicRMW(op, getAtomic<uint8_t>(addr), value);
+      case 2: return doAtomicRMW(op, getAtomic<uint16_t>(addr), value);
+      case 4: return doAtomicRMW(op, getAtomic<uint32_t>(addr), value);
+      case 8: return doAtomicRMW(op, getAtomic<uint64_t>(addr), value);
+      default: WASM_UNREACHABLE();
+    }
+  }
+
+  Literal atomicCmpxchg(Address addr, Index bytes, Literal expected, Literal replacement) override {
+    if (!memory.getShared()) {
+      return ModuleInstance::ExternalInterface::atomicCmpxchg(addr, bytes, expected, replacement);
+    }
+    switch (bytes) {
+      case 1: return doAtomicCmpxchg(getAtomic<uint8_t>(addr), expected, replacement);
+      case 2: return doAtomicCmpxchg(getAtomic<uint16_t>(addr), expected, replacement);
+      case 4: return doAtomicCmpxchg(getAtomic<uint32_t>(addr), expected, replacement);
+      case 8: return doAtomicCmpxchg(getAtomic<uint64_t>(addr), expected, replacement);
+      default: WASM_UNREACHABLE();
+    }
+  }
+
+  int32_t atomicWait(Address addr, Literal expected, int64_t timeout) override {
+    auto* shared = memory.getShared();
+    if (!shared || !memory.hasOtherUsers()) {
+      return ModuleInstance::ExternalInterface::atomicWait(addr, expected, timeout);
+    }
+    if (expected.type == i32) {
+      return shared->wait<uint32_t>(addr, expected.geti32(), timeout);
+    }
+    return shared->wait<uint64_t>(addr, expected.geti64(), timeout);
+  }
+
+  uint32_t atomicWake(Address addr, uint32_t count) override {
+    auto* shared = memory.getShared();
+    if (!shared) {
+      return 0;
+    }
+    return shared->wake(addr, count);
+  }
+
+  Address getSharedMemorySize(Address lastSeen) override {
+    if (auto* shared = memory.getShared()) {
+      return shared->getSize();
+    }
+    return lastSeen;
+  }
+
+  Address growSharedMemory(Address lastSeen, Address delta, Address max) override {
+    if (auto* shared = memory.getShared()) {
+      return shared->grow(delta, max);
+    }
+    return ModuleInstance::ExternalInterface::growSharedMemory(lastSeen, delta, max);
+  }
+
   void trap(const char* why) override {
     std::cerr << "[trap " << why << "]\n";
     throw TrapException();
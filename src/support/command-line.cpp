@@ -94,6 +94,14 @@ Options& Options::add_positional(const std::string& name, Arguments arguments,
 }
 
 void Options::parse(int argc, const char* argv[]) {
+  auto error = parseOrError(argc, argv);
+  if (!error.empty()) {
+    std::cerr << error << '\n';
+    exit(EXIT_FAILURE);
+  }
+}
+
+std::string Options::parseOrError(int argc, const char* argv[]) {
   assert(argc > 0 && "expect at least program name as an argument");
   size_t positionalsSeen = 0;
   auto dashes = [](const std::string& s) {
@@ -108,15 +116,12 @@ void Options::parse(int argc, const char* argv[]) {
       // Positional.
       switch (positional) {
         case Arguments::Zero:
-          std::cerr << "Unexpected positional argument '" << currentOption
-                    << "'\n";
-          exit(EXIT_FAILURE);
+          return "Unexpected positional argument '" + currentOption + "'";
         case Arguments::One:
         case Arguments::Optional:
           if (positionalsSeen) {
-            std::cerr << "Unexpected second positional argument '"
-                      << currentOption << "' for " << positionalName << '\n';
-            exit(EXIT_FAILURE);
+            return "Unexpected second positional argument '" + currentOption +
+                   "' for " + positionalName;
           }
         // Fallthrough.
         case Arguments::N:
@@ -139,30 +144,26 @@ void Options::parse(int argc, const char* argv[]) {
       if (o.longName == currentOption || o.shortName == currentOption)
         option = &o;
     if (!option) {
-      std::cerr << "Unknown option '" << currentOption << "'\n";
-      exit(EXIT_FAILURE);
+      return "Unknown option '" + currentOption + "'";
     }
     switch (option->arguments) {
       case Arguments::Zero:
         if (argument.size()) {
-          std::cerr << "Unexpected argument '" << argument << "' for option '"
-                    << currentOption << "'\n";
-          exit(EXIT_FAILURE);
+          return "Unexpected argument '" + argument + "' for option '" +
+                 currentOption + "'";
         }
         break;
       case Arguments::One:
         if (option->seen) {
-          std::cerr << "Unexpected second argument '" << argument << "' for '"
-                    << currentOption << "'\n";
-          exit(EXIT_FAILURE);
+          return "Unexpected second argument '" + argument + "' for '" +
+                 currentOption + "'";
         }
       // Fallthrough.
       case Arguments::N:
         if (!argument.size()) {
           if (i + 1 == e) {
-            std::cerr << "Couldn't find expected argument for '"
-                      << currentOption << "'\n";
-            exit(EXIT_FAILURE);
+            return "Couldn't find expected argument for '" + currentOption +
+                   "'";
           }
           argument = argv[++i];
         }
@@ -176,4 +177,5 @@ void Options::parse(int argc, const char* argv[]) {
     option->action(this, argument);
     ++option->seen;
   }
+  return "";
 }
@@ -48,6 +48,9 @@ class Options {
   Options &add_positional(const std::string& name, Arguments arguments,
                           const Action &action);
   void parse(int argc, const char *argv[]);
+  // Like parse, but returns a description of a bad argument instead of
+  // printing it and exiting, or an empty string if there was none.
+  std::string parseOrError(int argc, const char *argv[]);
 
  private:
   Options() = delete;
@@ -0,0 +1,156 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "support/bits.h"
+#include "support/compression.h"
+
+namespace wasm {
+
+namespace {
+
+const size_t WindowSize = 32768;
+const size_t MinMatch = 3;
+const size_t MaxMatch = 258;
+const size_t MaxChainLength = 64;
+const size_t HashBits = 15;
+// How many symbols we consider to be in one block. Each block has its own
+// Huffman tables in deflate, which we account for approximately.
+const size_t BlockSymbols = 16384;
+
+const size_t NumLengthCodes = 29;
+const size_t NumLiteralCodes = 256 + 1 + NumLengthCodes;
+const size_t NumDistanceCodes = 30;
+
+inline uint32_t floorLog2(uint32_t x) {
+  return 31 - CountLeadingZeroes(x);
+}
+
+// Returns the deflate length code (relative to 257) and adds its extra bits.
+inline size_t getLengthCode(size_t length, size_t& extraBits) {
+  if (length < 11) return length - MinMatch;
+  if (length == MaxMatch) return NumLengthCodes - 1;
+  uint32_t n = length - MinMatch;
+  uint32_t bits = floorLog2(n) - 2;
+  extraBits += bits;
+  return 4 * bits + (n >> bits);
+}
+
+// Returns the deflate distance code and adds its extra bits.
+inline size_t getDistanceCode(size_t distance, size_t& extraBits) {
+  uint32_t n = distance - 1;
+  if (n < 4) return n;
+  uint32_t bits = floorLog2(n) - 1;
+  extraBits += bits;
+  return 2 * bits + (n >> bits);
+}
+
+inline uint32_t hash3(const unsigned char* p) {
+  uint32_t x = p[0] | (p[1] << 8) | (p[2] << 16);
+  return (x * 2654435761u) >> (32 - HashBits);
+}
+
+struct Block {
+  std::vector<size_t> literals, distances;
+  size_t numSymbols = 0;
+  size_t extraBits = 0;
+
+  Block() : literals(NumLiteralCodes), distances(NumDistanceCodes) {}
+
+  // Returns the estimated size of the block in bits: the entropy of the
+  // symbols, plus extra bits, plus a rough cost for the code tables.
+  double getBits() {
+    double bits = extraBits + 17; // block header
+    auto addEntropy = [&](std::vector<size_t>& counts) {
+      size_t total = 0;
+      for (auto count : counts) total += count;
+      for (auto count : counts) {
+        if (count == 0) continue;
+        // Huffman codes are at least one bit long.
+        bits += count * std::max(1.0, -std::log2(double(count) / total));
+        bits += 5; // code length in the table
+      }
+    };
+    literals[256]++; // end of block
+    addEntropy(literals);
+    addEntropy(distances);
+    return bits;
+  }
+};
+
+} // anonymous namespace
+
+size_t estimateCompressedSize(const char* data, size_t size) {
+  auto* bytes = reinterpret_cast<const unsigned char*>(data);
+  std::vector<int32_t> head(size_t(1) << HashBits, -1);
+  std::vector<int32_t> prev(size, -1);
+  auto insert = [&](size_t i) {
+    if (i + MinMatch > size) return;
+    auto h = hash3(bytes + i);
+    prev[i] = head[h];
+    head[h] = i;
+  };
+  double bits = 0;
+  Block block;
+  auto addSymbol = [&]() {
+    if (++block.numSymbols == BlockSymbols) {
+      bits += block.getBits();
+      block = Block();
+    }
+  };
+  size_t i = 0;
+  while (i < size) {
+    // Greedily find the longest match in the window.
+    size_t bestLength = 0, bestDistance = 0;
+    if (i + MinMatch <= size) {
+      int32_t candidate = head[hash3(bytes + i)];
+      size_t maxLength = std::min(MaxMatch, size - i);
+      for (size_t chain = 0; chain < MaxChainLength && candidate >= 0 && i - candidate <= WindowSize; chain++) {
+        size_t length = 0;
+        while (length < maxLength && bytes[candidate + length] == bytes[i + length]) {
+          length++;
+        }
+        if (length > bestLength) {
+          bestLength = length;
+          bestDistance = i - candidate;
+          if (length == maxLength) break;
+        }
+        candidate = prev[candidate];
+      }
+    }
+    if (bestLength >= MinMatch) {
+      block.literals[257 + getLengthCode(bestLength, block.extraBits)]++;
+      block.distances[getDistanceCode(bestDistance, block.extraBits)]++;
+      for (size_t j = 0; j < bestLength; j++) {
+        insert(i + j);
+      }
+      i += bestLength;
+    } else {
+      block.literals[bytes[i]]++;
+      insert(i);
+      i++;
+    }
+    addSymbol();
+  }
+  bits += block.getBits();
+  return size_t(std::ceil(bits / 8));
+}
+
+} // namespace wasm
@@ -0,0 +1,38 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Estimates how well data will compress with a deflate-style compressor
+// (gzip, zlib, etc.), without depending on one. This is useful to compare
+// alternative layouts of the same data, where the absolute number matters
+// less than the difference.
+//
+
+#ifndef wasm_support_compression_h
+#define wasm_support_compression_h
+
+#include <cstddef>
+
+namespace wasm {
+
+// Returns the estimated size in bytes of the data after compression. The
+// estimate models LZ77 matching in a 32K window followed by entropy coding of
+// the literal/length and distance symbols, like deflate does.
+size_t estimateCompressedSize(const char* data, size_t size);
+
+} // namespace wasm
+
+#endif // wasm_support_compression_h
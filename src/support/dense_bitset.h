@@ -0,0 +1,117 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// A set of small integers stored as a dense array of bits. Unlike
+// SortedVector, merging and comparing sets is done a machine word at
+// a time and never allocates, which makes this a good fit for dataflow
+// problems where every set has the same, not too large, universe.
+//
+
+#ifndef wasm_support_dense_bitset_h
+#define wasm_support_dense_bitset_h
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "support/bits.h"
+
+namespace wasm {
+
+struct DenseBitset {
+  typedef uint64_t Word;
+  static const Index WordBits = 64;
+
+  std::vector<Word> words;
+
+  DenseBitset() {}
+  explicit DenseBitset(Index size) : words((size + WordBits - 1) / WordBits, 0) {}
+
+  static Index numWords(Index size) {
+    return (size + WordBits - 1) / WordBits;
+  }
+
+  void insert(Index x) {
+    words[x / WordBits] |= Word(1) << (x % WordBits);
+  }
+
+  void erase(Index x) {
+    words[x / WordBits] &= ~(Word(1) << (x % WordBits));
+  }
+
+  bool has(Index x) const {
+    return (words[x / WordBits] >> (x % WordBits)) & 1;
+  }
+
+  bool empty() const {
+    for (auto word : words) {
+      if (word) return false;
+    }
+    return true;
+  }
+
+  // Adds all the elements of another set of the same size, returning
+  // whether anything was added.
+  bool merge(const DenseBitset& other) {
+    assert(words.size() == other.words.size());
+    Word changed = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+      auto old = words[i];
+      words[i] |= other.words[i];
+      changed |= old ^ words[i];
+    }
+    return changed != 0;
+  }
+
+  // Sets this to gen | (other & ~kill), the standard gen/kill transfer
+  // function, returning whether anything changed.
+  bool transfer(const DenseBitset& gen, const DenseBitset& other, const DenseBitset& kill) {
+    assert(words.size() == gen.words.size());
+    assert(words.size() == other.words.size());
+    assert(words.size() == kill.words.size());
+    Word changed = 0;
+    for (size_t i = 0; i < words.size(); i++) {
+      auto word = gen.words[i] | (other.words[i] & ~kill.words[i]);
+      changed |= word ^ words[i];
+      words[i] = word;
+    }
+    return changed != 0;
+  }
+
+  // Calls func on each element, in increasing order.
+  template<typename T>
+  void forEach(T func) const {
+    for (size_t i = 0; i < words.size(); i++) {
+      auto word = words[i];
+      while (word) {
+        func(Index(i * WordBits + CountTrailingZeroes(word)));
+        word &= word - 1;
+      }
+    }
+  }
+
+  bool operator==(const DenseBitset& other) const {
+    return words == other.words;
+  }
+  bool operator!=(const DenseBitset& other) const {
+    return !(*this == other);
+  }
+};
+
+} // namespace wasm
+
+#endif // wasm_support_dense_bitset_h
@@ -0,0 +1,461 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Fast JSON reading, for large inputs like wasm-metadce's graphs.
+//
+// json::Reader is a streaming reader: it calls a handler for each value,
+// key, and start and end of an array or object, in order, without building
+// anything. It works in place on a null-terminated buffer, unescaping
+// strings into it, so it does not allocate except for its stack of open
+// arrays and objects.
+//
+// json::Document uses the reader to build a tree of nodes, all allocated
+// in an arena, which is freed all at once with the document. Strings and
+// keys stay in the input, which must outlive the document. Interning is
+// most of the cost of reading a big graph, so strings are only interned
+// when asked for as IStrings, and keys never are.
+//
+
+#ifndef wasm_support_json_reader_h
+#define wasm_support_json_reader_h
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "mixed_arena.h"
+#include "support/json.h"
+#include "support/utilities.h"
+
+namespace json {
+
+// The calls a Reader makes. Derive from this and define the ones you need.
+struct Handler {
+  void visitNull() {}
+  void visitBool(bool value) {}
+  void visitNumber(double value) {}
+  // Strings and keys are null-terminated, and are in the input buffer.
+  void visitString(const char* str, size_t size) {}
+  void visitKey(const char* str, size_t size) {}
+  void startArray() {}
+  void endArray() {}
+  void startObject() {}
+  void endObject() {}
+};
+
+template<typename SubType>
+class Reader {
+public:
+  Reader(char* input, SubType& handler) : input(input), curr(input), handler(handler) {}
+
+  // Reads a single JSON value, which must be all of the input.
+  void read() {
+    while (1) {
+      skipSpace();
+      switch (*curr) {
+        case '{': {
+          curr++;
+          handler.startObject();
+          skipSpace();
+          if (*curr == '}') {
+            curr++;
+            handler.endObject();
+            break;
+          }
+          open.push_back(true);
+          readKey();
+          // Read the first value.
+          continue;
+        }
+        case '[': {
+          curr++;
+          handler.startArray();
+          skipSpace();
+          if (*curr == ']') {
+            curr++;
+            handler.endArray();
+            break;
+          }
+          open.push_back(false);
+          continue;
+        }
+        case '"': {
+          size_t size;
+          auto* str = readString(size);
+          handler.visitString(str, size);
+          break;
+        }
+        case 't': {
+          expectWord("true");
+          handler.visitBool(true);
+          break;
+        }
+        case 'f': {
+          expectWord("false");
+          handler.visitBool(false);
+          break;
+        }
+        case 'n': {
+          expectWord("null");
+          handler.visitNull();
+          break;
+        }
+        default: {
+          char* after;
+          double value = strtod(curr, &after);
+          if (after == curr) error("expected a value");
+          curr = after;
+          handler.visitNumber(value);
+        }
+      }
+      // We finished a value. Close the arrays and objects it ends, until we
+      // find the next value in one.
+      while (1) {
+        skipSpace();
+        if (open.empty()) {
+          if (*curr) error("expected the end of the input");
+          return;
+        }
+        bool inObject = open.back();
+        if (*curr == ',') {
+          curr++;
+          skipSpace();
+          if (*curr == (inObject ? '}' : ']')) {
+            // Allow a trailing comma, like json::Value does.
+            continue;
+          }
+          if (inObject) {
+            readKey();
+          }
+          break;
+        }
+        if (*curr == (inObject ? '}' : ']')) {
+          curr++;
+          open.pop_back();
+          if (inObject) {
+            handler.endObject();
+          } else {
+            handler.endArray();
+          }
+          continue;
+        }
+        error(inObject ? "expected ',' or '}'" : "expected ',' or ']'");
+      }
+    }
+  }
+
+private:
+  char* input;
+  char* curr;
+  SubType& handler;
+  // For each open array or object, whether it is an object.
+  std::vector<bool> open;
+
+  void error(const char* what) {
+    wasm::Fatal() << "JSON parse error at offset " << (curr - input) << ": " << what;
+  }
+
+  void skipSpace() {
+    while (*curr == ' ' || *curr == '\n' || *curr == '\r' || *curr == '\t') {
+      curr++;
+    }
+  }
+
+  void expectWord(const char* word) {
+    auto size = strlen(word);
+    if (strncmp(curr, word, size) != 0) error("expected a value");
+    curr += size;
+  }
+
+  void readKey() {
+    skipSpace();
+    if (*curr != '"') error("expected a key");
+    size_t size;
+    auto* str = readString(size);
+    handler.visitKey(str, size);
+    skipSpace();
+    if (*curr != ':') error("expected ':'");
+    curr++;
+  }
+
+  int readHexDigit() {
+    char c = *curr++;
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    curr--;
+    error("expected a hex digit");
+    return 0;
+  }
+
+  uint32_t readHex4() {
+    uint32_t ret = 0;
+    for (int i = 0; i < 4; i++) {
+      ret = (ret << 4) | readHexDigit();
+    }
+    return ret;
+  }
+
+  // Reads a string, unescaping it in place, and null-terminates it.
+  char* readString(size_t& size) {
+    assert(*curr == '"');
+    curr++;
+    char* start = curr;
+    // Most strings have no escapes, so nothing needs to move.
+    while (*curr != '"' && *curr != '\\') {
+      if (!*curr) error("unterminated string");
+      curr++;
+    }
+    char* out = curr;
+    while (*curr != '"') {
+      char c = *curr++;
+      if (!c) {
+        curr--;
+        error("unterminated string");
+      }
+      if (c != '\\') {
+        *out++ = c;
+        continue;
+      }
+      c = *curr++;
+      switch (c) {
+        case '"': *out++ = '"'; break;
+        case '\\': *out++ = '\\'; break;
+        case '/': *out++ = '/'; break;
+        case 'b': *out++ = '\b'; break;
+        case 'f': *out++ = '\f'; break;
+        case 'n': *out++ = '\n'; break;
+        case 'r': *out++ = '\r'; break;
+        case 't': *out++ = '\t'; break;
+        case 'u': {
+          uint32_t code = readHex4();
+          if (code >= 0xd800 && code < 0xdc00 && curr[0] == '\\' && curr[1] == 'u') {
+            // A surrogate pair.
+            curr += 2;
+            uint32_t low = readHex4();
+            if (low < 0xdc00 || low >= 0xe000) error("invalid surrogate pair");
+            code = 0x10000 + ((code - 0xd800) << 10) + (low - 0xdc00);
+          }
+          // The UTF-8 is never longer than the escape, so this does not
+          // overtake the input.
+          if (code < 0x80) {
+            *out++ = char(code);
+          } else if (code < 0x800) {
+            *out++ = char(0xc0 | (code >> 6));
+            *out++ = char(0x80 | (code & 0x3f));
+          } else if (code < 0x10000) {
+            *out++ = char(0xe0 | (code >> 12));
+            *out++ = char(0x80 | ((code >> 6) & 0x3f));
+            *out++ = char(0x80 | (code & 0x3f));
+          } else {
+            *out++ = char(0xf0 | (code >> 18));
+            *out++ = char(0x80 | ((code >> 12) & 0x3f));
+            *out++ = char(0x80 | ((code >> 6) & 0x3f));
+            *out++ = char(0x80 | (code & 0x3f));
+          }
+          break;
+        }
+        default: {
+          curr--;
+          error("invalid escape");
+        }
+      }
+    }
+    curr++;
+    *out = 0;
+    size = out - start;
+    return start;
+  }
+};
+
+// A parsed JSON value, allocated in a Document's arena.
+struct Node {
+  struct Member {
+    const char* key;
+    Node* value;
+  };
+
+  Value::Type type;
+  union {
+    const char* str;
+    double num;
+    bool boo;
+    Node** items;
+    Member* members;
+  };
+  // The number of items or members in an array or object.
+  size_t count = 0;
+
+  bool isString() { return type == Value::String; }
+  bool isNumber() { return type == Value::Number; }
+  bool isArray()  { return type == Value::Array; }
+  bool isNull()   { return type == Value::Null; }
+  bool isBool()   { return type == Value::Bool; }
+  bool isObject() { return type == Value::Object; }
+
+  const char* getCString() {
+    assert(isString());
+    return str;
+  }
+  // Interns the string, which points into the input, as json::Value does.
+  IString getIString() {
+    assert(isString());
+    return IString(str);
+  }
+  double getNumber() {
+    assert(isNumber());
+    return num;
+  }
+  bool getBool() {
+    assert(isBool());
+    return boo;
+  }
+
+  // Array operations
+
+  size_t size() {
+    assert(isArray());
+    return count;
+  }
+  Node* operator[](size_t i) {
+    assert(isArray() && i < count);
+    return items[i];
+  }
+
+  // Object operations
+
+  size_t numMembers() {
+    assert(isObject());
+    return count;
+  }
+  Member& getMember(size_t i) {
+    assert(isObject() && i < count);
+    return members[i];
+  }
+  // Returns the value of a key, or nullptr if it is not present. If a key
+  // appears more than once, the last one counts.
+  Node* get(const char* key) {
+    assert(isObject());
+    for (size_t i = count; i > 0; i--) {
+      if (strcmp(members[i - 1].key, key) == 0) {
+        return members[i - 1].value;
+      }
+    }
+    return nullptr;
+  }
+  bool has(const char* key) {
+    return get(key) != nullptr;
+  }
+};
+
+class Document {
+public:
+  // Parses null-terminated JSON text, modifying it in place.
+  Document(char* input) {
+    Builder builder(*this);
+    Reader<Builder>(input, builder).read();
+    assert(builder.values.size() == 1);
+    root = builder.values[0];
+  }
+  Document(const Document&) = delete;
+  Document& operator=(const Document&) = delete;
+
+  Node* getRoot() { return root; }
+
+private:
+  MixedArena arena;
+  Node* root;
+
+  template<typename T>
+  T* allocate(size_t num = 1) {
+    return static_cast<T*>(arena.allocSpace(sizeof(T) * num, alignof(T)));
+  }
+
+  Node* makeNode(Value::Type type) {
+    auto* ret = new (allocate<Node>()) Node();
+    ret->type = type;
+    return ret;
+  }
+
+  struct Builder : public Handler {
+    Document& doc;
+    // The values that are done, whose arrays and objects are not, and the
+    // keys in those objects.
+    std::vector<Node*> values;
+    std::vector<const char*> keys;
+    // Where the items of each open array or object start in values.
+    std::vector<size_t> starts;
+
+    Builder(Document& doc) : doc(doc) {}
+
+    void visitNull() {
+      values.push_back(doc.makeNode(Value::Null));
+    }
+    void visitBool(bool value) {
+      auto* node = doc.makeNode(Value::Bool);
+      node->boo = value;
+      values.push_back(node);
+    }
+    void visitNumber(double value) {
+      auto* node = doc.makeNode(Value::Number);
+      node->num = value;
+      values.push_back(node);
+    }
+    void visitString(const char* str, size_t size) {
+      auto* node = doc.makeNode(Value::String);
+      node->str = str;
+      values.push_back(node);
+    }
+    void visitKey(const char* str, size_t size) {
+      keys.push_back(str);
+    }
+    void startArray() {
+      starts.push_back(values.size());
+    }
+    void endArray() {
+      auto start = starts.back();
+      starts.pop_back();
+      auto* node = doc.makeNode(Value::Array);
+      node->count = values.size() - start;
+      node->items = doc.allocate<Node*>(node->count);
+      std::copy(values.begin() + start, values.end(), node->items);
+      values.resize(start);
+      values.push_back(node);
+    }
+    void startObject() {
+      starts.push_back(values.size());
+    }
+    void endObject() {
+      auto start = starts.back();
+      starts.pop_back();
+      auto* node = doc.makeNode(Value::Object);
+      node->count = values.size() - start;
+      node->members = doc.allocate<Node::Member>(node->count);
+      auto keyStart = keys.size() - node->count;
+      for (size_t i = 0; i < node->count; i++) {
+        new (&node->members[i]) Node::Member{ keys[keyStart + i], values[start + i] };
+      }
+      keys.resize(keyStart);
+      values.resize(start);
+      values.push_back(node);
+    }
+  };
+};
+
+} // namespace json
+
+#endif // wasm_support_json_reader_h
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+#include "memory.h"
+
+namespace wasm {
+
+namespace MemoryProfile {
+
+bool enabled = false;
+
+namespace {
+
+// The counts of all the threads that ever noted an allocation. Threads do
+// not own their counts, so they stay valid after a thread exits.
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::unique_ptr<Counts>> threadCounts;
+};
+
+Registry& getRegistry() {
+  static Registry registry;
+  return registry;
+}
+
+struct PassRecord {
+  Counts counts;
+  size_t rssGrowth = 0;
+};
+
+struct FunctionRecord {
+  size_t total = 0;
+  // The pass that allocated the most on this function.
+  std::string largestPass;
+  size_t largest = 0;
+};
+
+struct Records {
+  std::mutex mutex;
+  // In the order the passes first ran.
+  std::vector<std::string> passOrder;
+  std::map<std::string, PassRecord> passes;
+  std::unordered_map<std::string, FunctionRecord> functions;
+};
+
+Records& getRecords() {
+  static Records records;
+  return records;
+}
+
+std::string formatBytes(size_t bytes) {
+  std::stringstream ret;
+  ret.precision(1);
+  ret << std::fixed;
+  if (bytes >= 1024 * 1024) {
+    ret << (bytes / (1024.0 * 1024.0)) << " MB";
+  } else if (bytes >= 1024) {
+    ret << (bytes / 1024.0) << " kB";
+  } else {
+    ret << bytes << " B";
+  }
+  return ret.str();
+}
+
+} // anonymous namespace
+
+Counts& getThreadCounts() {
+  static thread_local Counts* counts = nullptr;
+  if (!counts) {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threadCounts.emplace_back(new Counts);
+    counts = registry.threadCounts.back().get();
+  }
+  return *counts;
+}
+
+Counts getTotalCounts() {
+  auto& registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  Counts ret;
+  for (auto& counts : registry.threadCounts) {
+    ret += *counts;
+  }
+  return ret;
+}
+
+size_t getPeakRSS() {
+#if defined(__linux__) || defined(__APPLE__)
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) {
+    return 0;
+  }
+#if defined(__APPLE__)
+  return usage.ru_maxrss;
+#else
+  // Linux reports kilobytes.
+  return size_t(usage.ru_maxrss) * 1024;
+#endif
+#else
+  return 0;
+#endif
+}
+
+void record(const std::string& pass, const std::string& function, const Counts& counts, size_t rssGrowth) {
+  auto& records = getRecords();
+  std::lock_guard<std::mutex> lock(records.mutex);
+  auto iter = records.passes.find(pass);
+  if (iter == records.passes.end()) {
+    records.passOrder.push_back(pass);
+    iter = records.passes.emplace(pass, PassRecord()).first;
+  }
+  iter->second.counts += counts;
+  iter->second.rssGrowth += rssGrowth;
+  if (!function.empty()) {
+    auto total = counts.total();
+    auto& functionRecord = records.functions[function];
+    functionRecord.total += total;
+    if (total > functionRecord.largest) {
+      functionRecord.largest = total;
+      functionRecord.largestPass = pass;
+    }
+  }
+}
+
+void dump(std::ostream& o, size_t numFunctions) {
+  auto& records = getRecords();
+  std::lock_guard<std::mutex> lock(records.mutex);
+  o << "[memory-profile] peak RSS: " << formatBytes(getPeakRSS()) << '\n';
+  o << "[memory-profile] allocated by each pass (in the arena, local graphs, interference matrices), and the growth of the peak RSS while it ran:\n";
+  size_t padding = 0;
+  for (auto& pass : records.passOrder) {
+    padding = std::max(padding, pass.size());
+  }
+  for (auto& pass : records.passOrder) {
+    auto& record = records.passes[pass];
+    o << "[memory-profile]   " << pass << std::string(padding - pass.size(), ' ')
+      << "  " << formatBytes(record.counts.total())
+      << " (" << formatBytes(record.counts.bytes[Arena])
+      << ", " << formatBytes(record.counts.bytes[LocalGraph])
+      << ", " << formatBytes(record.counts.bytes[Interferences])
+      << "), +" << formatBytes(record.rssGrowth) << '\n';
+  }
+  std::vector<std::pair<std::string, FunctionRecord>> functions(records.functions.begin(), records.functions.end());
+  std::sort(functions.begin(), functions.end(), [](const std::pair<std::string, FunctionRecord>& a,
+                                                   const std::pair<std::string, FunctionRecord>& b) {
+    if (a.second.total != b.second.total) {
+      return a.second.total > b.second.total;
+    }
+    return a.first < b.first;
+  });
+  if (functions.size() > numFunctions) {
+    functions.resize(numFunctions);
+  }
+  if (!functions.empty()) {
+    o << "[memory-profile] functions that passes allocated the most on:\n";
+  }
+  for (auto& function : functions) {
+    o << "[memory-profile]   $" << function.first << ": " << formatBytes(function.second.total);
+    if (function.second.largest) {
+      o << ", most in " << function.second.largestPass << " (" << formatBytes(function.second.largest) << ')';
+    }
+    o << '\n';
+  }
+  records.passOrder.clear();
+  records.passes.clear();
+  records.functions.clear();
+}
+
+} // namespace MemoryProfile
+
+} // namespace wasm
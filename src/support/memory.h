@@ -0,0 +1,108 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Memory accounting, for --memory-profile.
+//
+// While profiling is enabled, the arena and the large side structures of
+// passes note the bytes they allocate, in counters per thread. The
+// PassRunner reads them before and after each pass, and records how much
+// each pass allocated, on which functions, and how the peak resident set
+// size of the process grew. When profiling is disabled, noting an
+// allocation is just a check of a global flag.
+//
+// Only allocations are counted, not frees, so these are the bytes each pass
+// asked for, and not how much it kept.
+//
+
+#ifndef wasm_support_memory_h
+#define wasm_support_memory_h
+
+#include <cstddef>
+#include <iostream>
+#include <string>
+
+namespace wasm {
+
+namespace MemoryProfile {
+
+enum Category {
+  Arena,
+  LocalGraph,
+  Interferences,
+  NumCategories
+};
+
+struct Counts {
+  size_t bytes[NumCategories] = {};
+
+  size_t total() const {
+    size_t ret = 0;
+    for (auto b : bytes) {
+      ret += b;
+    }
+    return ret;
+  }
+
+  Counts operator-(const Counts& other) const {
+    Counts ret;
+    for (size_t i = 0; i < NumCategories; i++) {
+      ret.bytes[i] = bytes[i] - other.bytes[i];
+    }
+    return ret;
+  }
+
+  Counts& operator+=(const Counts& other) {
+    for (size_t i = 0; i < NumCategories; i++) {
+      bytes[i] += other.bytes[i];
+    }
+    return *this;
+  }
+};
+
+// Whether to count. Set this before doing work on other threads.
+extern bool enabled;
+
+// The counts of the current thread.
+Counts& getThreadCounts();
+
+inline void note(Category category, size_t bytes) {
+  if (enabled) {
+    getThreadCounts().bytes[category] += bytes;
+  }
+}
+
+// The sum of the counts of all threads. Call this only when no other thread
+// is allocating.
+Counts getTotalCounts();
+
+// The peak resident set size of the process so far, in bytes, or 0 if we
+// cannot tell on this platform.
+size_t getPeakRSS();
+
+// Records that a pass allocated some memory, and that the peak resident set
+// size grew by some amount while it ran. If the pass ran on a single
+// function, give its name. This is thread-safe.
+void record(const std::string& pass, const std::string& function, const Counts& counts, size_t rssGrowth);
+
+// Prints what was recorded, and forgets it.
+void dump(std::ostream& o, size_t numFunctions = 10);
+
+} // namespace MemoryProfile
+
+} // namespace wasm
+
+#endif // wasm_support_memory_h
@@ -39,6 +39,12 @@ static std::mutex debug;
 
 namespace wasm {
 
+// Whether the current OS thread is one of the pool's helper threads. Work
+// that is started from inside a helper thread (for example, a PassRunner
+// running inside a job that was itself sent to the pool) cannot wait on the
+// pool, so it is run sequentially on the calling thread instead.
+static thread_local bool onPoolThread = false;
+
 // Thread
 
 Thread::Thread(ThreadPool* parent) : parent(parent) {
@@ -70,6 +76,7 @@ void Thread::work(std::function<ThreadWorkState ()> doWork_) {
 
 void Thread::mainLoop(void *self_) {
   auto* self = static_cast<Thread*>(self_);
+  onPoolThread = true;
   while (1) {
     DEBUG_THREAD("checking for work\n");
     {
@@ -157,7 +164,7 @@ ThreadPool* ThreadPool::get() {
 void ThreadPool::work(std::vector<std::function<ThreadWorkState ()>>& doWorkers) {
   size_t num = threads.size();
   // If no multiple cores, or on a side thread, do not use worker threads
-  if (num == 0) {
+  if (num == 0 || onPoolThread) {
     // just run sequentially
     DEBUG_POOL("work() sequentially\n");
     assert(doWorkers.size() > 0);
@@ -123,15 +123,35 @@ public:
     std::cout << "shrink level: " << options.passOptions.shrinkLevel << '\n';
   }
 
+  // Makes each function body at least this many expressions, by adding more
+  // code before it. Functions are otherwise small, and this lets us see how
+  // passes scale with the size of a function.
+  void setFunctionSize(Index size) {
+    functionSize = size;
+  }
+
+  // Keeps adding functions after the input runs out, until their bodies have
+  // this many expressions in total. How much code the input turns into
+  // varies a lot, and this makes the size predictable.
+  void setMinSize(Index size) {
+    minSize = size;
+  }
+
   void build(bool initEmitAtomics = true) {
     emitAtomics = initEmitAtomics;
     setupMemory();
     setupTable();
     setupGlobals();
-    // keep adding functions until we run out of input
-    while (!finishedInput) {
+    if (functionSize) {
+      addGrowGuard();
+    }
+    // keep adding functions until we run out of input, and have as much code
+    // as we were asked for
+    Index size = 0;
+    while (!finishedInput || size < minSize) {
       auto* func = addFunction();
       addInvocations(func);
+      size += Measurer::measure(func->body);
     }
     if (HANG_LIMIT > 0) {
       addHangLimitSupport();
@@ -181,6 +201,12 @@ private:
   // Whether to emit atomics
   bool emitAtomics = true;
 
+  // The minimum size of a function body, see setFunctionSize()
+  Index functionSize = 0;
+
+  // The minimum size of all the function bodies, see setMinSize()
+  Index minSize = 0;
+
   // Whether to emit atomic waits (which in single-threaded mode, may hang...)
   static const bool ATOMIC_WAITS = false;
 
@@ -400,6 +426,9 @@ private:
     // Mutations add random small changes, which can subtly break duplicate code
     // patterns.
     mutate(func);
+    if (functionSize) {
+      growBody(func);
+    }
     // TODO: liveness operations on gets, with some prob alter a get to one with
     //       more possible sets
     // Recombination, mutation, etc. can break validation; fix things up after.
@@ -430,6 +459,33 @@ private:
     return func;
   }
 
+  const Name GROW_GUARD_GLOBAL = "growGuard";
+
+  // The code we add to grow functions is each behind a check of this global,
+  // so that if some of it does not complete, the rest is not dead code.
+  void addGrowGuard() {
+    wasm.addGlobal(builder.makeGlobal(
+      GROW_GUARD_GLOBAL,
+      i32,
+      builder.makeConst(Literal(int32_t(0))),
+      Builder::Mutable
+    ));
+  }
+
+  void growBody(Function* func) {
+    auto size = Measurer::measure(func->body);
+    if (size >= functionSize) return;
+    auto* block = builder.makeBlock();
+    while (size < functionSize) {
+      auto* curr = builder.makeIf(builder.makeGetGlobal(GROW_GUARD_GLOBAL, i32), make(none));
+      size += Measurer::measure(curr);
+      block->list.push_back(curr);
+    }
+    block->list.push_back(func->body);
+    block->finalize();
+    func->body = block;
+  }
+
   void addHangLimitChecks(Function* func) {
     // loop limit
     FindAll<Loop> loops(func->body);
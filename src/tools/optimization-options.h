@@ -14,7 +14,10 @@
  * limitations under the License.
  */
 
+#include <algorithm>
+
 #include "support/command-line.h"
+#include "support/memory.h"
 
 //
 // Shared optimization options for commandline tools
@@ -103,6 +106,21 @@ struct OptimizationOptions : public Options {
                 Options::Arguments::Zero,
                 [this](Options*, const std::string&) {
                   passOptions.ignoreImplicitTraps = true;
+                })
+           .add("--expensive-pass-size-limit", "-epsl", "Skip or downgrade expensive passes (like merge-locals and code-folding) on functions with more expressions than this, logging each such decision",
+                Options::Arguments::One,
+                [this](Options* o, const std::string& argument) {
+                  passOptions.expensivePassSizeLimit = atoi(argument.c_str());
+                })
+           .add("--expensive-pass-time-limit", "-eptl", "Skip or downgrade expensive passes on functions that passes have already spent more than this many seconds on, logging each such decision",
+                Options::Arguments::One,
+                [this](Options* o, const std::string& argument) {
+                  passOptions.expensivePassTimeLimit = atof(argument.c_str());
+                })
+           .add("--memory-profile", "-mp", "Report to stderr how much memory each pass allocated, in total and on the functions it allocated the most on, and how much the peak RSS grew while it ran",
+                Options::Arguments::Zero,
+                [](Options*, const std::string&) {
+                  MemoryProfile::enabled = true;
                 });
     // add passes in registry
     for (const auto& p : PassRegistry::get()->getRegisteredNames()) {
@@ -129,6 +147,29 @@ struct OptimizationOptions : public Options {
     return passes.size() > 0;
   }
 
+  // Whether the passes end with the Stack IR optimizations. The writer should
+  // then do them as well, on functions that later passes modified.
+  bool optimizingStackIR() {
+    if (runningDefaultOptimizationPasses() &&
+        (passOptions.optimizeLevel >= 2 || passOptions.shrinkLevel >= 1)) {
+      return true;
+    }
+    return std::find(passes.begin(), passes.end(), "optimize-stack-ir") != passes.end();
+  }
+
+  // Lets the binary writer do the Stack IR optimizations of the default
+  // pipeline, which then leaves them out. Call this only if the module will
+  // be written as a binary, with setOptimizeStackIR.
+  void optimizeStackIRInWriter() {
+    for (auto& pass : passes) {
+      // printing shows the Stack IR of functions, or which have it
+      if (pass.find("print") == 0) return;
+    }
+    if (optimizingStackIR()) {
+      passOptions.optimizeStackIRInWriter = true;
+    }
+  }
+
   void runPasses(Module& wasm) {
     PassRunner passRunner(&wasm, passOptions);
     if (debug) passRunner.setDebug(true);
@@ -141,6 +182,9 @@ struct OptimizationOptions : public Options {
       }
     }
     passRunner.run();
+    if (MemoryProfile::enabled) {
+      MemoryProfile::dump(std::cerr);
+    }
   }
 };
 
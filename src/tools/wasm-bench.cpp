@@ -0,0 +1,1048 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Measures the throughput of reading and writing modules: parsing and
+// printing the text format, and reading and writing the binary format.
+//
+// The modules are synthesized in a few shapes that stress different parts
+// of that code (deep nesting, wide blocks, many locals, large data segments,
+// and the fuzzer's random modules), or read from a file. Each operation is
+// run a few times and the fastest run is reported, as JSON, in MB/s of text
+// or binary and in expressions per second, so that results can be compared
+// across commits.
+//
+// With --threads, it instead stresses the interpreter's shared memories: a
+// module is instantiated once per thread on a single shared memory, and the
+// threads add to counters at the same time, with atomic operations, under a
+// lock, and by taking turns, which makes them wait for and wake each other.
+//
+// With --json, it measures reading JSON instead, with json::Value, with the
+// streaming json::Reader, and into an arena with json::Document, on a
+// synthesized wasm-metadce graph or on INFILE.
+//
+// With --complexity, it looks for passes whose running time grows too fast
+// with the size of their input: each pass runs on modules of each shape at
+// doubling sizes, and if its time grows faster than size to the power of
+// --max-exponent, it is reported, and the largest module is saved so the
+// problem can be looked into. Each pass runs in a child process, so a pass
+// that fails on some shape is reported as well, without ending the run, and
+// a pass that takes longer than --timeout is stopped and reported as too
+// slow.
+//
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <sstream>
+#include <thread>
+
+#include "pass.h"
+#include "support/colors.h"
+#include "support/command-line.h"
+#include "support/file.h"
+#include "support/json-reader.h"
+#include "support/path.h"
+#include "wasm-binary.h"
+#include "wasm-builder.h"
+#include "wasm-io.h"
+#include "wasm-printing.h"
+#include "wasm-s-parser.h"
+#include "wasm-validator.h"
+#include "ir/module-utils.h"
+#include "ir/utils.h"
+#include "optimization-options.h"
+#include "fuzzing.h"
+#include "shell-interface.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace wasm;
+
+// Synthesizes modules of a given size, which is roughly the number of
+// expressions in them.
+struct ModuleSynthesizer {
+  Module& wasm;
+  Builder builder;
+  std::mt19937 random;
+
+  ModuleSynthesizer(Module& wasm, unsigned seed) : wasm(wasm), builder(wasm), random(seed) {}
+
+  void addFunction(Name name, std::vector<Type>&& params, Type result,
+                   std::vector<Type>&& vars, Expression* body) {
+    auto* func = builder.makeFunction(name, std::move(params), result, std::move(vars), body);
+    func->type = ensureFunctionType(getSig(func), &wasm)->name;
+    wasm.addFunction(func);
+    auto* export_ = new Export();
+    export_->name = export_->value = name;
+    export_->kind = ExternalKind::Function;
+    wasm.addExport(export_);
+  }
+
+  // Control flow and arithmetic nested a hundred levels deep.
+  void deep(Index size) {
+    const Index depth = 100;
+    for (Index i = 0; i * 2 * depth < size; i++) {
+      Expression* curr = builder.makeGetLocal(0, i32);
+      for (Index j = 0; j < depth; j++) {
+        auto* value = builder.makeConst(Literal(int32_t(j)));
+        switch (j % 3) {
+          case 0: curr = builder.makeBlock(curr); break;
+          case 1: curr = builder.makeBinary(AddInt32, curr, value); break;
+          case 2: curr = builder.makeIf(builder.makeGetLocal(0, i32), curr, value); break;
+        }
+      }
+      addFunction(Name("deep" + std::to_string(i)), { i32 }, i32, {}, curr);
+    }
+  }
+
+  // Blocks with a thousand children each.
+  void wide(Index size) {
+    const Index width = 1000;
+    for (Index i = 0; i * 4 * width < size; i++) {
+      auto* block = builder.makeBlock();
+      for (Index j = 0; j < width; j++) {
+        if (j & 1) {
+          block->list.push_back(builder.makeSetLocal(1,
+            builder.makeBinary(MulInt32, builder.makeGetLocal(0, i32),
+                                         builder.makeConst(Literal(int32_t(j))))));
+        } else {
+          block->list.push_back(builder.makeDrop(
+            builder.makeBinary(AddInt32, builder.makeGetLocal(1, i32),
+                                         builder.makeConst(Literal(int32_t(j))))));
+        }
+      }
+      block->finalize();
+      addFunction(Name("wide" + std::to_string(i)), { i32 }, none, { i32 }, block);
+    }
+  }
+
+  // Functions with a thousand locals of all types, copied around.
+  void locals(Index size) {
+    const Index numLocals = 1000;
+    const Type types[] = { i32, i64, f32, f64 };
+    for (Index i = 0; i * 2 * numLocals < size; i++) {
+      std::vector<Type> vars;
+      for (Index j = 0; j < numLocals; j++) {
+        vars.push_back(types[j % 4]);
+      }
+      auto* block = builder.makeBlock();
+      for (Index j = 0; j < numLocals; j++) {
+        // A local of the same type, far away.
+        Index from = (j + numLocals / 2 + 4) % numLocals;
+        block->list.push_back(builder.makeSetLocal(j, builder.makeGetLocal(from, vars[from])));
+      }
+      block->finalize();
+      addFunction(Name("locals" + std::to_string(i)), {}, none, std::move(vars), block);
+    }
+  }
+
+  // Data segments of random bytes, 16 bytes per unit of size.
+  void data(Index size) {
+    const size_t segmentSize = 1024;
+    size_t total = size_t(size) * 16;
+    wasm.memory.exists = true;
+    wasm.memory.initial = wasm.memory.max = (total + Memory::kPageSize - 1) / Memory::kPageSize;
+    std::uniform_int_distribution<int> byte(0, 255);
+    for (size_t offset = 0; offset < total; offset += segmentSize) {
+      std::vector<char> bytes(std::min(segmentSize, total - offset));
+      for (auto& b : bytes) {
+        b = char(byte(random));
+      }
+      wasm.memory.segments.emplace_back(builder.makeConst(Literal(int32_t(offset))), bytes);
+    }
+  }
+
+  // A module from the fuzzer, from as much random input. By default the
+  // functions are small, and there are more of them as the size grows.
+  void fuzz(Index size, Index functionSize = 0) {
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<char> input(size);
+    for (auto& b : input) {
+      b = char(byte(random));
+    }
+    TranslateToFuzzReader reader(wasm, input);
+    reader.setMinSize(size);
+    reader.setFunctionSize(functionSize);
+    reader.build(false);
+    // Printing unreachable code does not always give text that we can parse
+    // back, so remove it.
+    PassRunner runner(&wasm);
+    runner.add("dce");
+    runner.run();
+  }
+};
+
+static const char* shapes[] = { "deep", "wide", "locals", "data", "fuzz", "fuzz-body" };
+
+static void synthesize(Module& wasm, std::string shape, Index size, unsigned seed) {
+  ModuleSynthesizer synthesizer(wasm, seed);
+  if (shape == "deep") {
+    synthesizer.deep(size);
+  } else if (shape == "wide") {
+    synthesizer.wide(size);
+  } else if (shape == "locals") {
+    synthesizer.locals(size);
+  } else if (shape == "data") {
+    synthesizer.data(size);
+  } else if (shape == "fuzz") {
+    synthesizer.fuzz(size);
+  } else if (shape == "fuzz-body") {
+    // The fuzzer's code in a few functions of the given size.
+    synthesizer.fuzz(size, size);
+  } else {
+    Fatal() << "unknown module shape: " << shape;
+  }
+  if (!WasmValidator().validate(wasm)) {
+    WasmPrinter::printModule(&wasm);
+    Fatal() << "synthesized an invalid module of shape " << shape;
+  }
+}
+
+static size_t countExpressions(Module& wasm) {
+  size_t count = 0;
+  ModuleUtils::iterDefinedFunctions(wasm, [&](Function* func) {
+    count += Measurer::measure(func->body);
+  });
+  ModuleUtils::iterDefinedGlobals(wasm, [&](Global* global) {
+    count += Measurer::measure(global->init);
+  });
+  for (auto& segment : wasm.memory.segments) {
+    count += Measurer::measure(segment.offset);
+  }
+  for (auto& segment : wasm.table.segments) {
+    count += Measurer::measure(segment.offset);
+  }
+  return count;
+}
+
+struct Result {
+  std::string name;
+  double seconds;
+  // The bytes processed, or with --threads, the operations done.
+  size_t amount;
+};
+
+// Runs an operation a number of times, and returns the fastest time. The
+// setup is not timed.
+template<typename Setup, typename Operation>
+static double measure(Index iterations, Setup setup, Operation operation) {
+  double best = 0;
+  for (Index i = 0; i < iterations; i++) {
+    setup();
+    auto before = std::chrono::steady_clock::now();
+    operation();
+    auto after = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(after - before).count();
+    if (i == 0 || seconds < best) {
+      best = seconds;
+    }
+  }
+  return best;
+}
+
+static std::string escapeJSON(std::string str) {
+  std::string ret;
+  for (auto c : str) {
+    if (c == '"' || c == '\\') {
+      ret += '\\';
+      ret += c;
+    } else if (c >= 0 && c < 32) {
+      char buffer[8];
+      snprintf(buffer, sizeof(buffer), "\\u%04x", c);
+      ret += buffer;
+    } else {
+      ret += c;
+    }
+  }
+  return ret;
+}
+
+static void benchmark(Module& wasm, std::string name, Index iterations, bool first, std::ostream& o) {
+  size_t expressions = countExpressions(wasm);
+  std::vector<Result> results;
+
+  std::string text;
+  results.push_back({ "print-text", measure(iterations, []() {}, [&]() {
+    std::stringstream stream;
+    WasmPrinter::printModule(&wasm, stream);
+    text = stream.str();
+  }), text.size() });
+
+  std::vector<char> input;
+  results.push_back({ "parse-text", measure(iterations, [&]() {
+    input.assign(text.begin(), text.end());
+    input.push_back(0);
+  }, [&]() {
+    Module parsed;
+    try {
+      SExpressionParser parser(input.data());
+      SExpressionWasmBuilder builder(parsed, *(*parser.root)[0]);
+    } catch (ParseException& p) {
+      p.dump(std::cerr);
+      Fatal() << "error in parsing the printed text of " << name;
+    }
+  }), text.size() });
+
+  BufferWithRandomAccess buffer;
+  results.push_back({ "write-binary", measure(iterations, [&]() {
+    buffer.clear();
+  }, [&]() {
+    WasmBinaryWriter writer(&wasm, buffer);
+    writer.write();
+  }), buffer.size() });
+
+  std::vector<char> binary(buffer.begin(), buffer.end());
+  results.push_back({ "read-binary", measure(iterations, []() {}, [&]() {
+    Module read;
+    WasmBinaryBuilder parser(read, binary, false);
+    parser.read();
+  }), binary.size() });
+
+  if (!first) o << ",\n";
+  o << "    {\n";
+  o << "      \"module\": \"" << escapeJSON(name) << "\",\n";
+  o << "      \"expressions\": " << expressions << ",\n";
+  o << "      \"text-bytes\": " << text.size() << ",\n";
+  o << "      \"binary-bytes\": " << binary.size() << ",\n";
+  o << "      \"results\": {\n";
+  for (Index i = 0; i < results.size(); i++) {
+    auto& result = results[i];
+    // Avoid dividing by zero on tiny modules.
+    double seconds = std::max(result.seconds, 1e-9);
+    o << "        \"" << result.name << "\": { "
+      << "\"seconds\": " << result.seconds << ", "
+      << "\"MB/s\": " << (result.amount / seconds / (1024 * 1024)) << ", "
+      << "\"expressions/s\": " << (expressions / seconds) << " }"
+      << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  o << "      }\n";
+  o << "    }";
+}
+
+// The module each thread runs. The counters are at 0 (added to atomically),
+// 8 (added to under the lock at 4) and 16 (added to by whoever has the turn
+// at 12).
+static const char* threadsModule = R"(
+(module
+ (memory $0 (shared 1 1))
+ (func $add (export "add") (param $n i32)
+  (loop $l
+   (drop (i32.atomic.rmw.add (i32.const 0) (i32.const 1)))
+   (br_if $l (tee_local $n (i32.sub (get_local $n) (i32.const 1))))
+  )
+ )
+ (func $lock (export "lock") (param $n i32)
+  (loop $l
+   (block $acquired
+    (loop $spin
+     (br_if $acquired
+      (i32.eqz (i32.atomic.rmw.cmpxchg (i32.const 4) (i32.const 0) (i32.const 1)))
+     )
+     (drop (i32.wait (i32.const 4) (i32.const 1) (i64.const -1)))
+     (br $spin)
+    )
+   )
+   (i32.store (i32.const 8) (i32.add (i32.load (i32.const 8)) (i32.const 1)))
+   (i32.atomic.store (i32.const 4) (i32.const 0))
+   (drop (wake (i32.const 4) (i32.const 1)))
+   (br_if $l (tee_local $n (i32.sub (get_local $n) (i32.const 1))))
+  )
+ )
+ (func $turns (export "turns") (param $id i32) (param $threads i32) (param $n i32)
+  (local $turn i32)
+  (loop $l
+   (block $mine
+    (loop $wait
+     (br_if $mine
+      (i32.eq (tee_local $turn (i32.atomic.load (i32.const 12))) (get_local $id))
+     )
+     (drop (i32.wait (i32.const 12) (get_local $turn) (i64.const -1)))
+     (br $wait)
+    )
+   )
+   (i32.store (i32.const 16) (i32.add (i32.load (i32.const 16)) (i32.const 1)))
+   (i32.atomic.store (i32.const 12)
+    (i32.rem_u (i32.add (get_local $id) (i32.const 1)) (get_local $threads))
+   )
+   (drop (wake (i32.const 12) (i32.const -1)))
+   (br_if $l (tee_local $n (i32.sub (get_local $n) (i32.const 1))))
+  )
+ )
+)
+)";
+
+// Runs one of the functions in threadsModule on each of a number of threads,
+// each with its own instance, on one shared memory, and checks the counter it
+// adds to.
+static Result benchmarkThreads(Module& wasm, Name name, Address counter, Index threads,
+                               Index operations, Index iterations) {
+  std::shared_ptr<SharedMemory> memory;
+  std::vector<std::unique_ptr<ShellExternalInterface>> interfaces;
+  std::vector<std::unique_ptr<ModuleInstance>> instances;
+  double seconds = measure(iterations, [&]() {
+    instances.clear();
+    interfaces.clear();
+    memory = std::make_shared<SharedMemory>(wasm.memory.initial, wasm.memory.max);
+    for (Index i = 0; i < threads; i++) {
+      interfaces.push_back(make_unique<ShellExternalInterface>(memory));
+      instances.push_back(make_unique<ModuleInstance>(wasm, interfaces.back().get()));
+    }
+  }, [&]() {
+    std::vector<std::thread> workers;
+    std::atomic<bool> trapped;
+    trapped.store(false);
+    for (Index i = 0; i < threads; i++) {
+      workers.emplace_back([&, i]() {
+        LiteralList arguments;
+        if (name == "turns") {
+          arguments.push_back(Literal(int32_t(i)));
+          arguments.push_back(Literal(int32_t(threads)));
+        }
+        arguments.push_back(Literal(int32_t(operations)));
+        try {
+          instances[i]->callExport(name, arguments);
+        } catch (const TrapException&) {
+          trapped.store(true);
+        }
+      });
+    }
+    for (auto& worker : workers) {
+      worker.join();
+    }
+    if (trapped.load()) {
+      Fatal() << "trapped while running " << name << " on " << threads << " threads";
+    }
+  });
+  auto expected = uint32_t(threads) * operations;
+  auto actual = memory->getAtomic<uint32_t>(counter)->load();
+  if (actual != expected) {
+    Fatal() << name << " on " << threads << " threads counted " << actual
+            << " operations, but there were " << expected;
+  }
+  return { name.str, seconds, expected };
+}
+
+static void benchmarkThreads(Index threads, Index size, Index iterations, std::ostream& o) {
+  Module wasm;
+  std::vector<char> input(threadsModule, threadsModule + strlen(threadsModule) + 1);
+  SExpressionParser parser(input.data());
+  SExpressionWasmBuilder builder(wasm, *(*parser.root)[0]);
+  if (!WasmValidator().validate(wasm, Feature::Atomics)) {
+    Fatal() << "invalid threads module";
+  }
+  std::vector<Result> results;
+  results.push_back(benchmarkThreads(wasm, "add", 0, threads, size, iterations));
+  results.push_back(benchmarkThreads(wasm, "lock", 8, threads, size, iterations));
+  // Each turn is a hand-off between threads, which is far slower than the
+  // other operations.
+  results.push_back(benchmarkThreads(wasm, "turns", 16, threads, std::max(size / 100, Index(1)), iterations));
+  o << "{\n";
+  o << "  \"iterations\": " << iterations << ",\n";
+  o << "  \"threads\": " << threads << ",\n";
+  o << "  \"results\": {\n";
+  for (Index i = 0; i < results.size(); i++) {
+    auto& result = results[i];
+    double seconds = std::max(result.seconds, 1e-9);
+    o << "    \"" << result.name << "\": { "
+      << "\"seconds\": " << result.seconds << ", "
+      << "\"operations\": " << result.amount << ", "
+      << "\"operations/s\": " << (result.amount / seconds) << " }"
+      << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  o << "  }\n";
+  o << "}\n";
+}
+
+// A wasm-metadce graph, with a node per unit of size, that each reach a few
+// others.
+static std::string synthesizeGraph(Index size, unsigned seed) {
+  std::mt19937 random(seed);
+  std::uniform_int_distribution<Index> node(0, std::max(size, Index(1)) - 1);
+  std::stringstream graph;
+  graph << "[\n";
+  for (Index i = 0; i < size; i++) {
+    graph << "  {\n";
+    graph << "    \"name\": \"node" << i << "\",\n";
+    if (i % 10 == 0) {
+      graph << "    \"export\": \"export" << i << "\",\n";
+      graph << "    \"root\": true,\n";
+    } else if (i % 10 == 1) {
+      graph << "    \"import\": [\"env\", \"import" << i << "\"],\n";
+    }
+    graph << "    \"reaches\": [";
+    for (Index j = 0; j < 4; j++) {
+      graph << (j ? ", " : "") << "\"node" << node(random) << '"';
+    }
+    graph << "]\n";
+    graph << "  }" << (i + 1 < size ? ",\n" : "\n");
+  }
+  graph << "]\n";
+  return graph.str();
+}
+
+// Counts what the streaming reader sees, so it has something to do.
+struct CountingHandler : public json::Handler {
+  size_t count = 0;
+
+  void visitNull() { count++; }
+  void visitBool(bool value) { count++; }
+  void visitNumber(double value) { count++; }
+  void visitString(const char* str, size_t size) { count++; }
+  void visitKey(const char* str, size_t size) { count++; }
+  void startArray() { count++; }
+  void startObject() { count++; }
+};
+
+static void benchmarkJSON(std::string text, std::string name, Index iterations, std::ostream& o) {
+  // json::Value interns strings pointing into the buffer it parses, so parse
+  // a copy that we never free first. Later runs then find every string
+  // already interned, and their buffers can be freed.
+  auto* kept = new std::vector<char>(text.begin(), text.end());
+  kept->push_back(0);
+  json::Value().parse(kept->data());
+
+  std::vector<char> input;
+  auto setup = [&]() {
+    input.assign(text.begin(), text.end());
+    input.push_back(0);
+  };
+  std::vector<Result> results;
+  results.push_back({ "json::Value", measure(iterations, setup, [&]() {
+    json::Value value;
+    value.parse(input.data());
+  }), text.size() });
+  size_t count = 0;
+  results.push_back({ "json::Reader", measure(iterations, setup, [&]() {
+    CountingHandler handler;
+    json::Reader<CountingHandler>(input.data(), handler).read();
+    count = handler.count;
+  }), text.size() });
+  results.push_back({ "json::Document", measure(iterations, setup, [&]() {
+    json::Document document(input.data());
+  }), text.size() });
+
+  o << "{\n";
+  o << "  \"iterations\": " << iterations << ",\n";
+  o << "  \"input\": \"" << escapeJSON(name) << "\",\n";
+  o << "  \"bytes\": " << text.size() << ",\n";
+  o << "  \"values\": " << count << ",\n";
+  o << "  \"results\": {\n";
+  for (Index i = 0; i < results.size(); i++) {
+    auto& result = results[i];
+    double seconds = std::max(result.seconds, 1e-9);
+    o << "    \"" << result.name << "\": { "
+      << "\"seconds\": " << result.seconds << ", "
+      << "\"MB/s\": " << (result.amount / seconds / (1024 * 1024)) << ", "
+      << "\"values/s\": " << (count / seconds) << " }"
+      << (i + 1 < results.size() ? ",\n" : "\n");
+  }
+  o << "  }\n";
+  o << "}\n";
+}
+
+// Passes that we cannot run on arbitrary modules: extract-function needs an
+// argument, and i64-to-i32-lowering does not support i64 globals.
+static const char* complexitySkippedPasses[] = { "extract-function", "i64-to-i32-lowering" };
+
+// Passes that need flat IR, which we flatten before timing them.
+static const char* complexityFlatPasses[] = { "dfo", "rereloop", "souperify", "souperify-single-use" };
+
+// Below this time the measurements are mostly noise, so we do not report the
+// exponent of a pass as too high.
+static const double MinComplexitySeconds = 0.01;
+
+// Fits time = c * size ^ exponent to the measurements, in log space.
+static double fitExponent(const std::vector<size_t>& sizes, const std::vector<double>& seconds) {
+  double n = 0, sumX = 0, sumY = 0, sumXX = 0, sumXY = 0;
+  for (Index i = 0; i < sizes.size(); i++) {
+    double x = std::log(double(std::max(sizes[i], size_t(1))));
+    double y = std::log(std::max(seconds[i], 1e-9));
+    n++;
+    sumX += x;
+    sumY += y;
+    sumXX += x * x;
+    sumXY += x * y;
+  }
+  double denominator = n * sumXX - sumX * sumX;
+  if (denominator == 0) return 0;
+  return (n * sumXY - sumX * sumY) / denominator;
+}
+
+// Sends std::cout and std::cerr somewhere else while it is alive.
+struct StreamRedirect {
+  std::streambuf* oldOut;
+  std::streambuf* oldErr;
+
+  StreamRedirect(std::streambuf* buffer) {
+    oldOut = std::cout.rdbuf(buffer);
+    oldErr = std::cerr.rdbuf(buffer);
+  }
+  ~StreamRedirect() {
+    std::cout.rdbuf(oldOut);
+    std::cerr.rdbuf(oldErr);
+  }
+};
+
+// The times of a pass on the modules of a shape, at each size.
+struct PassTimes {
+  std::vector<size_t> sizes;
+  std::vector<double> seconds;
+  // If the pass failed, how (it exited with an error, or crashed).
+  std::string failure;
+  // Whether the pass ran out of time, in which case there are no times.
+  bool timedOut = false;
+};
+
+// Returns whether a pass's time grows faster than size to the power of
+// maxExponent, and the exponent.
+static bool isTooSlow(PassTimes& times, double maxExponent, double& exponent) {
+  exponent = fitExponent(times.sizes, times.seconds);
+  return exponent > maxExponent && times.seconds.back() >= MinComplexitySeconds;
+}
+
+// Synthesizes modules of a shape at doubling sizes, up to the given one.
+static void synthesizeSteps(std::string shape, Index size, Index steps, unsigned seed,
+                            std::vector<std::unique_ptr<Module>>& modules, PassTimes& times) {
+  for (Index i = 0; i < steps; i++) {
+    modules.push_back(make_unique<Module>());
+    synthesize(*modules.back(), shape, std::max(size >> (steps - 1 - i), Index(1)), seed);
+    times.sizes.push_back(countExpressions(*modules.back()));
+  }
+}
+
+static void saveModule(Module& wasm, std::string saved) {
+  ModuleWriter writer;
+  writer.setBinary(true);
+  writer.write(wasm, saved);
+}
+
+// Runs a pass on each of the modules and times it. Unless told not to,
+// discards what the pass prints or reports, which would fill the output.
+static void timePass(std::string pass, std::vector<std::unique_ptr<Module>>& modules,
+                     Index iterations, PassTimes& times, bool discard = true) {
+  bool flat = std::find(std::begin(complexityFlatPasses), std::end(complexityFlatPasses),
+                        pass) != std::end(complexityFlatPasses);
+  std::stringstream discarded;
+  for (auto& wasm : modules) {
+    std::unique_ptr<Module> copy;
+    times.seconds.push_back(measure(iterations, [&]() {
+      copy = make_unique<Module>();
+      ModuleUtils::copyModule(*wasm, *copy);
+      if (flat) {
+        PassRunner runner(copy.get());
+        runner.add("flatten");
+        runner.run();
+      }
+    }, [&]() {
+      std::unique_ptr<StreamRedirect> redirect;
+      if (discard) {
+        redirect = make_unique<StreamRedirect>(discarded.rdbuf());
+      }
+      PassRunner runner(copy.get());
+      runner.add(pass);
+      runner.run();
+    }));
+    discarded.str("");
+  }
+}
+
+#ifdef _WIN32
+static void timePassIsolated(std::string shape, std::string pass, Index size, Index steps,
+                             Index iterations, unsigned seed, double maxExponent,
+                             Index timeout, std::string saved, PassTimes& times) {
+  // Without fork(), a pass that fails ends the benchmark, and there is no
+  // timeout.
+  std::vector<std::unique_ptr<Module>> modules;
+  synthesizeSteps(shape, size, steps, seed, modules, times);
+  timePass(pass, modules, iterations, times);
+  double exponent;
+  if (isTooSlow(times, maxExponent, exponent)) {
+    saveModule(*modules.back(), saved);
+  }
+}
+#else
+// Reads what was written to a temporary file.
+static std::string readTemporaryFile(FILE* file) {
+  std::string ret;
+  fflush(file);
+  rewind(file);
+  char buffer[4096];
+  size_t num;
+  while ((num = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+    ret.append(buffer, num);
+  }
+  fclose(file);
+  return ret;
+}
+
+// Times a pass in a forked child process, so that if it fails, with Fatal()
+// or by crashing, we can report that and go on with the other passes. The
+// child sends back the times, and its stderr, in temporary files. If the
+// timeout is not 0, the child is stopped by SIGALRM after that many seconds;
+// it saves the largest module before it starts timing, so that it is there
+// if that happens, and removes it if the pass turns out not to be too slow.
+// Note that this process must not start the thread pool, as a child only has
+// the thread that forked it, so all the work is done in the children.
+static void timePassIsolated(std::string shape, std::string pass, Index size, Index steps,
+                             Index iterations, unsigned seed, double maxExponent,
+                             Index timeout, std::string saved, PassTimes& times) {
+  FILE* timesFile = tmpfile();
+  FILE* errFile = tmpfile();
+  if (!timesFile || !errFile) {
+    Fatal() << "could not create a temporary file: " << strerror(errno);
+  }
+  // don't let the child flush what we have buffered
+  std::cout.flush();
+  std::cerr.flush();
+  fflush(nullptr);
+  auto pid = fork();
+  if (pid < 0) {
+    Fatal() << "fork failed: " << strerror(errno);
+  }
+  if (pid == 0) {
+    int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, STDOUT_FILENO);
+    dup2(fileno(errFile), STDERR_FILENO);
+    // stdout goes nowhere, and stderr to the file we read if the pass fails.
+    PassTimes childTimes;
+    std::vector<std::unique_ptr<Module>> modules;
+    synthesizeSteps(shape, size, steps, seed, modules, childTimes);
+    if (timeout) {
+      saveModule(*modules.back(), saved);
+      alarm(timeout);
+    }
+    timePass(pass, modules, iterations, childTimes, false);
+    alarm(0);
+    double exponent;
+    if (isTooSlow(childTimes, maxExponent, exponent)) {
+      if (!timeout) {
+        saveModule(*modules.back(), saved);
+      }
+    } else if (timeout) {
+      unlink(saved.c_str());
+    }
+    std::stringstream out;
+    out.precision(17);
+    for (Index i = 0; i < steps; i++) {
+      out << childTimes.sizes[i] << ' ' << childTimes.seconds[i] << '\n';
+    }
+    auto str = out.str();
+    fwrite(str.data(), 1, str.size(), timesFile);
+    fflush(timesFile);
+    std::cerr.flush();
+    _exit(0);
+  }
+  int status;
+  while (waitpid(pid, &status, 0) < 0) {
+    if (errno != EINTR) {
+      Fatal() << "waitpid failed: " << strerror(errno);
+    }
+  }
+  std::stringstream in(readTemporaryFile(timesFile));
+  auto err = readTemporaryFile(errFile);
+  if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM) {
+    times.timedOut = true;
+  } else if (WIFSIGNALED(status)) {
+    times.failure = std::string("crashed with signal ") + std::to_string(WTERMSIG(status)) +
+                    " (" + strsignal(WTERMSIG(status)) + ")";
+  } else if (WEXITSTATUS(status) != 0) {
+    times.failure = "exited with code " + std::to_string(WEXITSTATUS(status));
+  } else {
+    size_t exprs;
+    double seconds;
+    while (in >> exprs >> seconds) {
+      times.sizes.push_back(exprs);
+      times.seconds.push_back(seconds);
+    }
+    if (times.sizes.size() != steps) {
+      times.failure = "did not report its times";
+    }
+  }
+  if (!times.failure.empty()) {
+    // Show the last line of what it said, where Fatal() errors are.
+    while (!err.empty() && err.back() == '\n') err.pop_back();
+    auto lastLine = err.substr(err.rfind('\n') == std::string::npos ? 0 : err.rfind('\n') + 1);
+    if (!lastLine.empty()) {
+      times.failure += ": " + lastLine;
+    }
+    times.sizes.clear();
+    times.seconds.clear();
+    if (timeout) {
+      unlink(saved.c_str());
+    }
+  }
+}
+#endif // _WIN32
+
+// How runs of complexity mode went, which is also how it exits, distinct
+// from Fatal() errors.
+enum ComplexityResult {
+  ComplexityOk = 0,
+  // Some pass's time grew too fast.
+  ComplexityTooSlow = 2,
+  // Some pass failed.
+  ComplexityFailed = 3
+};
+
+// Runs each pass on modules of a shape at doubling sizes, up to the given
+// one, and reports the passes whose time grows faster than maxExponent, and
+// those that failed.
+static ComplexityResult benchmarkComplexity(std::string shape, std::vector<std::string>& passes,
+                                            Index size, Index steps, Index iterations,
+                                            unsigned seed, double maxExponent, Index timeout,
+                                            std::string saveDir, bool first, std::ostream& o) {
+  auto ret = ComplexityOk;
+  std::vector<size_t> sizes;
+  std::stringstream passResults;
+  for (Index p = 0; p < passes.size(); p++) {
+    auto& pass = passes[p];
+    PassTimes times;
+    auto saved = saveDir + Path::getPathSeparator() + "complexity-" + shape + '-' + pass + ".wasm";
+    timePassIsolated(shape, pass, size, steps, iterations, seed, maxExponent, timeout, saved, times);
+    passResults << "        \"" << escapeJSON(pass) << "\": { ";
+    if (!times.failure.empty()) {
+      ret = ComplexityFailed;
+      std::cerr << "[complexity] " << pass << " on " << shape << " failed: " << times.failure << '\n';
+      passResults << "\"failed\": \"" << escapeJSON(times.failure) << "\" }";
+      passResults << (p + 1 < passes.size() ? ",\n" : "\n");
+      continue;
+    }
+    if (times.timedOut) {
+      if (ret == ComplexityOk) ret = ComplexityTooSlow;
+      std::cerr << "[complexity] " << pass << " on " << shape << ": took more than " << timeout
+                << " seconds, saved the largest module to " << saved << '\n';
+      passResults << "\"timeout\": " << timeout << ", \"saved\": \"" << escapeJSON(saved) << "\" }";
+      passResults << (p + 1 < passes.size() ? ",\n" : "\n");
+      continue;
+    }
+    sizes = times.sizes;
+    auto& seconds = times.seconds;
+    double exponent;
+    bool flagged = isTooSlow(times, maxExponent, exponent);
+    if (flagged) {
+      if (ret == ComplexityOk) ret = ComplexityTooSlow;
+      std::cerr << "[complexity] " << pass << " on " << shape << ": time grows as size^"
+                << exponent << ", saved the largest module to " << saved << '\n';
+    }
+    passResults << "\"seconds\": [";
+    for (Index i = 0; i < seconds.size(); i++) {
+      passResults << (i ? ", " : "") << seconds[i];
+    }
+    passResults << "], \"exponent\": " << exponent;
+    if (flagged) {
+      passResults << ", \"saved\": \"" << escapeJSON(saved) << '"';
+    }
+    passResults << " }" << (p + 1 < passes.size() ? ",\n" : "\n");
+  }
+  if (!first) o << ",\n";
+  o << "    {\n";
+  o << "      \"shape\": \"" << escapeJSON(shape) << "\",\n";
+  o << "      \"expressions\": [";
+  for (Index i = 0; i < sizes.size(); i++) {
+    o << (i ? ", " : "") << sizes[i];
+  }
+  o << "],\n";
+  o << "      \"passes\": {\n";
+  o << passResults.str();
+  o << "      }\n";
+  o << "    }";
+  return ret;
+}
+
+int main(int argc, const char* argv[]) {
+  std::vector<std::string> selected;
+  Index size = 100000;
+  Index iterations = 5;
+  unsigned seed = 0;
+  Index threads = 0;
+  bool json = false;
+  bool complexity = false;
+  std::vector<std::string> passes;
+  Index steps = 4;
+  double maxExponent = 1.5;
+  Index timeout = 300;
+  std::string saveDir = ".";
+  std::string output;
+
+  Options options("wasm-bench", "Measure the throughput of parsing and printing the text "
+                                "format, and of reading and writing the binary format.\n\n"
+                                "Modules are synthesized in several shapes (deep, wide, "
+                                "locals, data, fuzz and fuzz-body), or read from INFILE if one is given. "
+                                "Each operation runs several times and the fastest run is "
+                                "reported as JSON, in MB/s of text or binary and in "
+                                "expressions per second.");
+  options
+      .add("--shape", "-s", "The shape of module to synthesize: deep (nested control flow), "
+                            "wide (big blocks), locals (many locals), data (big data segments) "
+                            "fuzz (random modules from the fuzzer) or fuzz-body (the same, "
+                            "in functions of --size expressions). Can be given more "
+                            "than once (default: all of them)",
+           Options::Arguments::N,
+           [&](Options* o, const std::string& argument) { selected.push_back(argument); })
+      .add("--size", "-n", "The approximate number of expressions in each synthesized "
+                           "module, except that data has 16 bytes of data per unit of "
+                           "size (default: 100000)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { size = std::stoul(argument); })
+      .add("--iterations", "-i", "How many times to run each operation (default: 5)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             iterations = std::max(std::stoul(argument), 1ul);
+           })
+      .add("--seed", "", "The seed for the random contents of synthesized modules (default: 0)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { seed = std::stoul(argument); })
+      .add("--threads", "-t", "Instead of reading and writing modules, run a module in the "
+                              "interpreter on this many threads at once, on one shared "
+                              "memory, and measure its atomic operations, a lock, and "
+                              "threads taking turns. Each thread does --size operations, "
+                              "or a hundredth of that many turns",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             threads = std::max(std::stoul(argument), 1ul);
+           })
+      .add("--json", "", "Instead of reading and writing modules, measure reading JSON, "
+                         "in a wasm-metadce graph with --size nodes, or in INFILE",
+           Options::Arguments::Zero,
+           [&](Options* o, const std::string& argument) { json = true; })
+      .add("--complexity", "", "Instead of reading and writing modules, time each pass on "
+                               "modules of each shape at doubling sizes up to --size, and "
+                               "report the passes whose time grows faster than "
+                               "--max-exponent, or that take longer than --timeout. "
+                               "Each pass runs in a child process, and passes that "
+                               "fail are reported too. Exits with code "
+                               "2 if some pass was too slow, and 3 if some pass failed",
+           Options::Arguments::Zero,
+           [&](Options* o, const std::string& argument) { complexity = true; })
+      .add("--pass", "-p", "With --complexity, a pass to time. Can be given more than once "
+                           "(default: all of them)",
+           Options::Arguments::N,
+           [&](Options* o, const std::string& argument) { passes.push_back(argument); })
+      .add("--steps", "", "With --complexity, how many sizes to time each pass on, each "
+                          "half the next (default: 4)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             steps = std::max(std::stoul(argument), 2ul);
+           })
+      .add("--max-exponent", "", "With --complexity, the highest acceptable exponent of how "
+                                 "a pass's time grows with the size of the module "
+                                 "(default: 1.5)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { maxExponent = std::stod(argument); })
+      .add("--timeout", "", "With --complexity, how many seconds a pass may take on the "
+                            "modules of a shape before it is stopped and reported as too "
+                            "slow, or 0 for no limit (default: 300)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { timeout = std::stoul(argument); })
+      .add("--save-dir", "", "With --complexity, where to save the modules on which passes "
+                             "were too slow (default: the current directory)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { saveDir = argument; })
+      .add("--output", "-o", "Output file for the JSON results (stdout if not specified)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             output = argument;
+             Colors::disable();
+           })
+      .add_positional("INFILE", Options::Arguments::Optional,
+                      [](Options* o, const std::string& argument) {
+                        o->extra["infile"] = argument;
+                      });
+  options.parse(argc, argv);
+
+  std::stringstream results;
+  if (threads) {
+    benchmarkThreads(threads, size, iterations, results);
+    Output(output, Flags::Text, options.debug ? Flags::Debug : Flags::Release) << results.str();
+    return 0;
+  }
+  if (json) {
+    if (options.extra.count("infile")) {
+      auto infile = options.extra["infile"];
+      benchmarkJSON(read_file<std::string>(infile, Flags::Text, Flags::Release), infile, iterations, results);
+    } else {
+      benchmarkJSON(synthesizeGraph(size, seed), "graph", iterations, results);
+    }
+    Output(output, Flags::Text, options.debug ? Flags::Debug : Flags::Release) << results.str();
+    return 0;
+  }
+  if (selected.empty()) {
+    selected.assign(std::begin(shapes), std::end(shapes));
+  }
+  if (complexity) {
+    if (passes.empty()) {
+      for (auto& pass : PassRegistry::get()->getRegisteredNames()) {
+        if (std::find(std::begin(complexitySkippedPasses), std::end(complexitySkippedPasses),
+                      pass) == std::end(complexitySkippedPasses)) {
+          passes.push_back(pass);
+        }
+      }
+    }
+    results << "{\n";
+    results << "  \"iterations\": " << iterations << ",\n";
+    results << "  \"max-exponent\": " << maxExponent << ",\n";
+    results << "  \"shapes\": [\n";
+    auto result = ComplexityOk;
+    for (Index i = 0; i < selected.size(); i++) {
+      if (options.debug) std::cerr << "timing passes on " << selected[i] << "...\n";
+      result = std::max(result, benchmarkComplexity(selected[i], passes, size, steps, iterations,
+                                                    seed, maxExponent, timeout, saveDir, i == 0,
+                                                    results));
+    }
+    results << "\n  ]\n";
+    results << "}\n";
+    Output(output, Flags::Text, options.debug ? Flags::Debug : Flags::Release) << results.str();
+    return result;
+  }
+  results << "{\n";
+  results << "  \"iterations\": " << iterations << ",\n";
+  results << "  \"modules\": [\n";
+  if (options.extra.count("infile")) {
+    auto infile = options.extra["infile"];
+    Module wasm;
+    ModuleReader reader;
+    try {
+      reader.read(infile, wasm);
+    } catch (ParseException& p) {
+      p.dump(std::cerr);
+      Fatal() << "error in parsing input";
+    }
+    benchmark(wasm, infile, iterations, true, results);
+  } else {
+    bool first = true;
+    for (auto& shape : selected) {
+      if (options.debug) std::cerr << "benchmarking " << shape << "...\n";
+      Module wasm;
+      synthesize(wasm, shape, size, seed);
+      benchmark(wasm, shape, iterations, first, results);
+      first = false;
+    }
+  }
+  results << "\n  ]\n";
+  results << "}\n";
+
+  Output(output, Flags::Text, options.debug ? Flags::Debug : Flags::Release) << results.str();
+}
@@ -418,7 +418,8 @@ int main(int argc, const char* argv[]) {
     }
   }
 
-  if (!WasmValidator().validate(wasm)) {
+  // atomics are allowed, but the ctors are evaluated on a single thread
+  if (!WasmValidator().validate(wasm, Feature::Atomics)) {
     WasmPrinter::printModule(&wasm);
     Fatal() << "error in validating input";
   }
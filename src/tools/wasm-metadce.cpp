@@ -29,7 +29,7 @@
 #include "pass.h"
 #include "support/command-line.h"
 #include "support/file.h"
-#include "support/json.h"
+#include "support/json-reader.h"
 #include "support/colors.h"
 #include "wasm-io.h"
 #include "wasm-builder.h"
@@ -461,69 +461,66 @@ int main(int argc, const char* argv[]) {
     }
   }
 
-  auto graphInput(read_file<std::string>(graphFile, Flags::Text, Flags::Release));
-  auto* copy = strdup(graphInput.c_str());
-  json::Value outside;
-  outside.parse(copy);
+  auto graphInput(read_file<std::vector<char>>(graphFile, Flags::Text, Flags::Release));
+  json::Document document(graphInput.data());
+  json::Node* outside = document.getRoot();
 
   // parse the JSON into our graph, doing all the JSON parsing here, leaving
   // the abstract computation for the class itself
-  const json::IString NAME("name"),
-                        REACHES("reaches"),
-                        ROOT("root"),
-                        EXPORT("export"),
-                        IMPORT("import");
+  const char* NAME = "name";
+  const char* REACHES = "reaches";
+  const char* ROOT = "root";
+  const char* EXPORT = "export";
+  const char* IMPORT = "import";
 
   MetaDCEGraph graph(wasm);
 
-  if (!outside.isArray()) {
+  if (!outside->isArray()) {
     Fatal() << "input graph must be a JSON array of nodes. see --help for the form";
   }
-  auto size = outside.size();
+  auto size = outside->size();
   for (size_t i = 0; i < size; i++) {
-    json::Ref ref = outside[i];
+    json::Node* ref = (*outside)[i];
     if (!ref->isObject()) {
       Fatal() << "nodes in input graph must be JSON objects. see --help for the form";
     }
-    if (!ref->has(NAME)) {
+    json::Node* name = ref->get(NAME);
+    if (!name || !name->isString()) {
       Fatal() << "nodes in input graph must have a name. see --help for the form";
     }
-    DCENode node(ref[NAME]->getIString());
-    if (ref->has(REACHES)) {
-      json::Ref reaches = ref[REACHES];
+    DCENode node(name->getIString());
+    if (json::Node* reaches = ref->get(REACHES)) {
       if (!reaches->isArray()) {
         Fatal() << "node.reaches must be an array. see --help for the form";
       }
       auto size = reaches->size();
+      node.reaches.reserve(size);
       for (size_t j = 0; j < size; j++) {
-        json::Ref name = reaches[j];
+        json::Node* name = (*reaches)[j];
         if (!name->isString()) {
           Fatal() << "node.reaches items must be strings. see --help for the form";
         }
         node.reaches.push_back(name->getIString());
       }
     }
-    if (ref->has(ROOT)) {
-      json::Ref root = ref[ROOT];
+    if (json::Node* root = ref->get(ROOT)) {
       if (!root->isBool() || !root->getBool()) {
         Fatal() << "node.root, if it exists, must be true. see --help for the form";
       }
       graph.roots.insert(node.name);
     }
-    if (ref->has(EXPORT)) {
-      json::Ref exp = ref[EXPORT];
+    if (json::Node* exp = ref->get(EXPORT)) {
       if (!exp->isString()) {
         Fatal() << "node.export, if it exists, must be a string. see --help for the form";
       }
       graph.exportToDCENode[exp->getIString()] = node.name;
       graph.DCENodeToExport[node.name] = exp->getIString();
     }
-    if (ref->has(IMPORT)) {
-      json::Ref imp = ref[IMPORT];
-      if (!imp->isArray() || imp->size() != 2 || !imp[0]->isString() || !imp[1]->isString()) {
+    if (json::Node* imp = ref->get(IMPORT)) {
+      if (!imp->isArray() || imp->size() != 2 || !(*imp)[0]->isString() || !(*imp)[1]->isString()) {
         Fatal() << "node.import, if it exists, must be an array of two strings. see --help for the form";
       }
-      auto id = graph.getImportId(imp[0]->getIString(), imp[1]->getIString());
+      auto id = graph.getImportId((*imp)[0]->getIString(), (*imp)[1]->getIString());
       graph.importIdToDCENode[id] = node.name;
     }
     // TODO: optimize this copy with a clever move
@@ -553,7 +550,4 @@ int main(int argc, const char* argv[]) {
 
   // Print out everything that we found is removable, the outside might use that
   graph.printAllUnused();
-
-  // Clean up
-  free(copy);
 }
@@ -19,17 +19,21 @@
 // then writes it.
 //
 
+#include <chrono>
 #include <memory>
+#include <sstream>
 
 #include "pass.h"
 #include "support/command-line.h"
 #include "support/file.h"
+#include "support/threads.h"
 #include "wasm-printing.h"
 #include "wasm-s-parser.h"
 #include "wasm-validator.h"
 #include "wasm-io.h"
 #include "wasm-interpreter.h"
 #include "wasm-binary.h"
+#include "wasm-encoded-size.h"
 #include "shell-interface.h"
 #include "optimization-options.h"
 #include "execution-results.h"
@@ -56,6 +60,160 @@ std::string runCommand(std::string command) {
 #endif
 }
 
+//
+// Batch mode: run many (input, output, options) jobs inside one process.
+//
+// The manifest has one job per line, of the form
+//
+//   INFILE OUTFILE [OPTIONS...]
+//
+// where OPTIONS are the optimization options wasm-opt accepts on the
+// commandline (-O3, --vacuum, --no-validation, etc.). Empty lines and lines
+// starting with '#' are ignored. The whole manifest is read and each job's
+// options are parsed before any job starts; a line with a bad option or pass
+// name becomes a failed job. Jobs are then run concurrently on the thread
+// pool; a job whose input fails to parse or validate is reported and does
+// not affect the others. The jobs share this process, though, so a fatal
+// error or a crash in a pass ends the whole batch. Run jobs that may hit
+// one as separate wasm-opt processes.
+//
+
+struct BatchJob {
+  std::string input, output;
+  std::unique_ptr<OptimizationOptions> options;
+  bool ok = false;
+  std::string error;
+  double seconds = 0;
+};
+
+static std::vector<std::unique_ptr<BatchJob>> readBatchManifest(std::string filename, bool debug) {
+  std::vector<std::unique_ptr<BatchJob>> jobs;
+  auto text = read_file<std::string>(filename, Flags::Text, debug ? Flags::Debug : Flags::Release);
+  std::istringstream lines(text.c_str()); // text files are read with a trailing '\0'
+  std::string line;
+  size_t lineNumber = 0;
+  while (std::getline(lines, line)) {
+    lineNumber++;
+    std::istringstream words(line);
+    std::vector<std::string> args;
+    std::string word;
+    while (words >> word) {
+      args.push_back(word);
+    }
+    if (args.empty() || args[0][0] == '#') continue;
+    auto job = make_unique<BatchJob>();
+    job->input = args[0];
+    job->output = args.size() > 1 ? args[1] : "";
+    job->options = make_unique<OptimizationOptions>("wasm-opt", "batch job");
+    if (args.size() < 2) {
+      job->error = "manifest line " + std::to_string(lineNumber) + ": expected INFILE OUTFILE [OPTIONS...]";
+    } else {
+      // parse the job's options as if they were a commandline
+      std::vector<const char*> argv;
+      argv.push_back("wasm-opt");
+      for (size_t i = 2; i < args.size(); i++) {
+        argv.push_back(args[i].c_str());
+      }
+      auto error = job->options->parseOrError(argv.size(), argv.data());
+      if (!error.empty()) {
+        job->error = "manifest line " + std::to_string(lineNumber) + ": " + error;
+      }
+    }
+    jobs.push_back(std::move(job));
+  }
+  return jobs;
+}
+
+static void runBatchJob(BatchJob& job, bool emitBinary, bool debugInfo) {
+  if (!job.error.empty()) return; // its manifest line was bad
+  auto before = std::chrono::steady_clock::now();
+  Module wasm;
+  FeatureSet features = Feature::Atomics;
+  if (!std::ifstream(job.input).good()) {
+    job.error = "failed opening '" + job.input + "'";
+    return;
+  }
+  try {
+    ModuleReader reader;
+    reader.read(job.input, wasm);
+    auto& options = *job.options;
+    if (options.passOptions.validate && !WasmValidator().validate(wasm, features)) {
+      job.error = "input does not validate";
+    } else {
+      if (emitBinary) {
+        options.optimizeStackIRInWriter();
+      }
+      if (options.runningPasses()) {
+        options.runPasses(wasm);
+        if (options.passOptions.validate && !WasmValidator().validate(wasm, features)) {
+          job.error = "output does not validate";
+        }
+      }
+      if (job.error.empty()) {
+        ModuleWriter writer;
+        writer.setBinary(emitBinary);
+        writer.setDebugInfo(debugInfo);
+        if (options.optimizingStackIR()) {
+          writer.setOptimizeStackIR(options.passOptions);
+        }
+        writer.write(wasm, job.output);
+        job.ok = true;
+      }
+    }
+  } catch (ParseException& p) {
+    std::stringstream ss;
+    p.dump(ss);
+    job.error = "error in parsing input: " + ss.str();
+  } catch (MapParseException& p) {
+    std::stringstream ss;
+    p.dump(ss);
+    job.error = "error in parsing input: " + ss.str();
+  } catch (std::bad_alloc&) {
+    job.error = "error in building module, std::bad_alloc";
+  }
+  std::chrono::duration<double> diff = std::chrono::steady_clock::now() - before;
+  job.seconds = diff.count();
+}
+
+static int runBatch(std::string manifest, bool emitBinary, bool debugInfo, bool debug) {
+  auto jobs = readBatchManifest(manifest, debug);
+  auto before = std::chrono::steady_clock::now();
+  if (!jobs.empty()) {
+    // Each job runs its passes on the thread it was given; passes inside
+    // a job do not fan out further, as the pool is busy with other jobs.
+    size_t num = ThreadPool::get()->size();
+    std::vector<std::function<ThreadWorkState ()>> doWorkers;
+    std::atomic<size_t> nextJob;
+    nextJob.store(0);
+    for (size_t i = 0; i < num; i++) {
+      doWorkers.push_back([&]() {
+        auto index = nextJob.fetch_add(1);
+        if (index >= jobs.size()) {
+          return ThreadWorkState::Finished;
+        }
+        runBatchJob(*jobs[index], emitBinary, debugInfo);
+        return ThreadWorkState::More;
+      });
+    }
+    ThreadPool::get()->work(doWorkers);
+  }
+  std::chrono::duration<double> total = std::chrono::steady_clock::now() - before;
+  // summary
+  size_t failures = 0;
+  for (auto& job : jobs) {
+    std::cerr << "[batch] " << job->input << " -> " << job->output << ": ";
+    if (job->ok) {
+      std::cerr << "ok";
+    } else {
+      std::cerr << "FAILED (" << job->error << ")";
+      failures++;
+    }
+    std::cerr << ", " << job->seconds << " seconds\n";
+  }
+  std::cerr << "[batch] " << jobs.size() << " jobs, " << failures << " failed, " << total.count() << " seconds total\n";
+  return failures ? 1 : 0;
+}
+
 //
 // main
 //
@@ -76,6 +234,7 @@ int main(int argc, const char* argv[]) {
   std::string inputSourceMapFilename;
   std::string outputSourceMapFilename;
   std::string outputSourceMapUrl;
+  std::string batchManifest;
 
   OptimizationOptions options("wasm-opt", "Read, write, and optimize files");
   options
@@ -127,12 +286,19 @@ int main(int argc, const char* argv[]) {
       .add("--output-source-map-url", "-osu", "Emit specified string as source map URL",
            Options::Arguments::One,
            [&outputSourceMapUrl](Options *o, const std::string& argument) { outputSourceMapUrl = argument; })
+      .add("--batch", "", "Run the jobs listed in a manifest file inside this process, one 'INFILE OUTFILE [OPTIONS...]' per line",
+           Options::Arguments::One,
+           [&batchManifest](Options *o, const std::string& argument) { batchManifest = argument; })
       .add_positional("INFILE", Options::Arguments::One,
                       [](Options* o, const std::string& argument) {
                         o->extra["infile"] = argument;
                       });
   options.parse(argc, argv);
 
+  if (batchManifest.size()) {
+    return runBatch(batchManifest, emitBinary, debugInfo, options.debug);
+  }
+
   Module wasm;
   // It should be safe to just always enable atomics in wasm-opt, because we
   // don't expect any passes to accidentally generate atomic ops
@@ -233,6 +399,12 @@ int main(int argc, const char* argv[]) {
     curr = &other;
   }
 
+  // The writer can do the Stack IR optimizations, unless we converge, which
+  // measures the Stack IR the pipeline keeps.
+  if (emitBinary && options.extra.count("output") > 0 && !converge) {
+    options.optimizeStackIRInWriter();
+  }
+
   if (options.runningPasses()) {
     if (options.debug) std::cerr << "running passes...\n";
     auto runPasses = [&]() {
@@ -248,18 +420,14 @@ int main(int argc, const char* argv[]) {
     runPasses();
     if (converge) {
       // Keep on running passes to convergence, defined as binary
-      // size no longer decreasing.
-      auto getSize = [&]() {
-        BufferWithRandomAccess buffer;
-        WasmBinaryWriter writer(curr, buffer);
-        writer.write();
-        return buffer.size();
-      };
-      auto lastSize = getSize();
+      // size no longer decreasing. The oracle only measures functions
+      // that changed since the last time.
+      EncodedSizeOracle oracle(*curr);
+      auto lastSize = oracle.getModuleSize();
       while (1) {
         if (options.debug) std::cerr << "running iteration for convergence (" << lastSize << ")...\n";
         runPasses();
-        auto currSize = getSize();
+        auto currSize = oracle.getModuleSize();
         if (currSize >= lastSize) break;
         lastSize = currSize;
       }
@@ -280,6 +448,9 @@ int main(int argc, const char* argv[]) {
       writer.setSourceMapFilename(outputSourceMapFilename);
       writer.setSourceMapUrl(outputSourceMapUrl);
     }
+    if (options.optimizingStackIR()) {
+      writer.setOptimizeStackIR(options.passOptions);
+    }
     writer.write(*curr, options.extra["output"]);
 
     if (extraFuzzCommand.size() > 0) {
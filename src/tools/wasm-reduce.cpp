@@ -23,7 +23,9 @@
 // much more debuggable manner).
 //
 
+#include <functional>
 #include <memory>
+#include <sstream>
 #include <cstdio>
 #include <cstdlib>
 
@@ -40,6 +42,7 @@
 #include "ir/literal-utils.h"
 #include "ir/properties.h"
 #include "wasm-validator.h"
+#include "optimization-options.h"
 #ifdef _WIN32
 #ifndef NOMINMAX
 #define NOMINMAX
@@ -68,12 +71,31 @@ std::string GetLastErrorStdStr() {
   }
   return std::string();
 }
+#else
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 #endif
 using namespace wasm;
 
 // a timeout on every execution of the command
 size_t timeout = 2;
 
+// how many times we ran the command on a reduction, and how long that took
+size_t numTests = 0;
+double testTime = 0;
+
+// if set, instead of running a command we run these passes in a forked
+// child process, see ProgramResult::getFromPasses
+std::unique_ptr<OptimizationOptions> inProcessOptions;
+
+// the exit code of the child when the module it is given does not validate,
+// which is distinct from a Fatal() error in a pass
+static const int InvalidModuleCode = 2;
+// the code for a timeout, as the timeout command reports it
+static const int TimeoutCode = 124;
+
 struct ProgramResult {
   int code;
   std::string output;
@@ -187,6 +209,57 @@ struct ProgramResult {
   }
 #endif // _WIN32
 
+#ifdef _WIN32
+  void getFromPasses(Module& wasm, OptimizationOptions& options) {
+    Fatal() << "in-process reduction requires fork()";
+  }
+#else
+  // runs the passes on the module in a forked child process, and notes how
+  // the child exited: the code is the exit code, TimeoutCode if it ran out
+  // of time, or 128 plus the signal number if it crashed or aborted. The
+  // child works on its own copy of the module, so nothing is written or
+  // parsed. Note that the parent must not have started the thread pool (by
+  // running passes or validating), as the child only has the thread that
+  // forked it.
+  void getFromPasses(Module& wasm, OptimizationOptions& options) {
+    Timer timer;
+    timer.start();
+    // don't let the child flush what we have buffered
+    std::cout.flush();
+    fflush(nullptr);
+    auto pid = fork();
+    if (pid < 0) {
+      Fatal() << "fork failed: " << strerror(errno) << ".\n";
+    }
+    if (pid == 0) {
+      int devNull = open("/dev/null", O_WRONLY);
+      dup2(devNull, STDOUT_FILENO);
+      dup2(devNull, STDERR_FILENO);
+      alarm(timeout);
+      if (!WasmValidator().validate(wasm, options.features, WasmValidator::Globally | WasmValidator::Quiet)) {
+        _exit(InvalidModuleCode);
+      }
+      options.runPasses(wasm);
+      _exit(0);
+    }
+    int status;
+    while (waitpid(pid, &status, 0) < 0) {
+      if (errno != EINTR) {
+        Fatal() << "waitpid failed: " << strerror(errno) << ".\n";
+      }
+    }
+    if (WIFSIGNALED(status)) {
+      auto signal = WTERMSIG(status);
+      code = signal == SIGALRM ? TimeoutCode : 128 + signal;
+    } else {
+      code = WEXITSTATUS(status);
+    }
+    output.clear();
+    timer.stop();
+    time = timer.getTotal();
+  }
+#endif // _WIN32
+
   bool operator==(ProgramResult& other) {
     return code == other.code && output == other.output;
   }
@@ -214,6 +287,24 @@ inline std::ostream& operator<<(std::ostream& o, ProgramResult& result) {
 
 ProgramResult expected;
 
+// gets the result of the command on the test file, or in in-process mode,
+// of running the passes on it
+ProgramResult getResultOnTest(std::string command, std::string test) {
+  Timer timer;
+  timer.start();
+  ProgramResult result;
+  if (inProcessOptions) {
+    Module wasm;
+    ModuleReader().read(test, wasm);
+    result.getFromPasses(wasm, *inProcessOptions);
+  } else {
+    result.getFromExecution(command);
+  }
+  timer.stop();
+  testTime += timer.getTotal();
+  return result;
+}
+
 // Removing functions is extremely beneficial and efficient. We aggressively
 // try to remove functions, unless we've seen they can't be removed, in which
 // case we may try again but much later.
@@ -277,7 +368,8 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
           if (newSize < oldSize) {
             // the pass didn't fail, and the size looks smaller, so promising
             // see if it is still has the property we are preserving
-            if (ProgramResult(command) == expected) {
+            numTests++;
+            if (getResultOnTest(command, test) == expected) {
               std::cerr << "|    command \"" << currCommand << "\" succeeded, reduced size to " << newSize << ", and preserved the property\n";
               copy_file(test, working);
               more = true;
@@ -339,17 +431,22 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
   }
 
   bool writeAndTestReduction(ProgramResult& out) {
-    // write the module out
-    ModuleWriter writer;
-    writer.setBinary(binary);
-    writer.setDebugInfo(debugInfo);
-    writer.write(*getModule(), test);
-    // note that it is ok for the destructively-reduced module to be bigger
-    // than the previous - each destructive reduction removes logical code,
-    // and so is strictly better, even if the wasm binary format happens to
-    // encode things slightly less efficiently.
-    // test it
-    out.getFromExecution(command);
+    numTests++;
+    Timer timer;
+    timer.start();
+    if (inProcessOptions) {
+      // no need to write anything, the child gets a copy of the module
+      out.getFromPasses(*getModule(), *inProcessOptions);
+    } else {
+      // write the module out. note that it is ok for the destructively-reduced
+      // module to be bigger than the previous - each destructive reduction
+      // removes logical code, and so is strictly better, even if the wasm
+      // binary format happens to encode things slightly less efficiently.
+      writeModule(test);
+      out.getFromExecution(command);
+    }
+    timer.stop();
+    testTime += timer.getTotal();
     return out == expected;
   }
 
@@ -377,7 +474,28 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
 
   void noteReduction(size_t amount = 1) {
     reduced += amount;
-    copy_file(test, working);
+    if (inProcessOptions) {
+      // the test file was not written, but the module is what we tested
+      writeModule(working);
+    } else {
+      copy_file(test, working);
+    }
+  }
+
+  // we must not write out an invalid module. in in-process mode, we don't
+  // write it, and the child process checks it is valid. we must not validate
+  // here in that mode anyhow, as that starts the thread pool, and the child
+  // processes would not have its threads.
+  bool isValidOrTestedInProcess() {
+    return inProcessOptions ||
+           WasmValidator().validate(*module, Feature::All, WasmValidator::Globally | WasmValidator::Quiet);
+  }
+
+  void writeModule(std::string filename) {
+    ModuleWriter writer;
+    writer.setBinary(binary);
+    writer.setDebugInfo(debugInfo);
+    writer.write(*getModule(), filename);
   }
 
   // tests a reduction on an arbitrary child
@@ -401,6 +519,130 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
     return "(non-function context)";
   }
 
+  // Delta debugging (ddmin): removes as many of the items as it can, while
+  // the command still behaves as expected. tryToRemove is given some of the
+  // remaining items, and must remove them, test that, and undo the removal
+  // if the test fails. We first try to remove half the items at a time, and
+  // on failure split them into smaller and smaller chunks, so when most of
+  // the items can go this takes a logarithmic number of tests rather than a
+  // test per item. We also try to remove everything but a chunk, which
+  // quickly finds a small set of items that must stay. Returns how many
+  // items were removed. tryToRemove should call noteReduction() when it
+  // succeeds, as a later failure may reload the working module.
+  template<typename T>
+  size_t reduceByDeltaDebugging(std::vector<T> items, std::function<bool (std::vector<T>&)> tryToRemove) {
+    size_t removed = 0;
+    size_t numChunks = 2;
+    while (!items.empty()) {
+      numChunks = std::min(numChunks, items.size());
+      std::vector<std::vector<T>> chunks(numChunks);
+      for (size_t i = 0; i < items.size(); i++) {
+        chunks[i * numChunks / items.size()].push_back(items[i]);
+      }
+      auto allBut = [&](size_t skip) {
+        std::vector<T> ret;
+        for (size_t i = 0; i < numChunks; i++) {
+          if (i != skip) {
+            ret.insert(ret.end(), chunks[i].begin(), chunks[i].end());
+          }
+        }
+        return ret;
+      };
+      bool progress = false;
+      for (size_t i = 0; i < numChunks && !progress; i++) {
+        if (tryToRemove(chunks[i])) {
+          removed += chunks[i].size();
+          items = allBut(i);
+          numChunks = std::max(numChunks - 1, size_t(2));
+          progress = true;
+        }
+      }
+      // With two chunks, removing the complement of one is removing the
+      // other, which we just tried.
+      for (size_t i = 0; i < numChunks && !progress && numChunks > 2; i++) {
+        auto others = allBut(i);
+        if (tryToRemove(others)) {
+          removed += others.size();
+          items = chunks[i];
+          numChunks = 2;
+          progress = true;
+        }
+      }
+      if (progress) continue;
+      if (numChunks == items.size()) break;
+      numChunks = std::min(2 * numChunks, items.size());
+    }
+    return removed;
+  }
+
+  // Hierarchical delta debugging over the children of blocks: reduce the
+  // outermost blocks first, a level of nesting at a time, so whole subtrees
+  // are removed before we look inside them.
+  void reduceBlocksHierarchically(Expression* body) {
+    std::vector<Block*> level;
+    findOutermostBlocks(body, level);
+    while (!level.empty()) {
+      std::vector<Block*> next;
+      for (auto* block : level) {
+        if (block->list.size() > 1 && shouldTryToReduce()) {
+          reduceBlockByDeltaDebugging(block);
+        }
+        for (auto* child : block->list) {
+          findOutermostBlocks(child, next);
+        }
+      }
+      level.swap(next);
+    }
+  }
+
+  void findOutermostBlocks(Expression* root, std::vector<Block*>& found) {
+    std::vector<Expression*> work = { root };
+    while (!work.empty()) {
+      auto* curr = work.back();
+      work.pop_back();
+      if (auto* block = curr->dynCast<Block>()) {
+        found.push_back(block);
+        continue;
+      }
+      for (auto* child : ChildIterator(curr)) {
+        work.push_back(child);
+      }
+    }
+  }
+
+  void reduceBlockByDeltaDebugging(Block* block) {
+    std::vector<Expression*> children;
+    for (auto* child : block->list) {
+      children.push_back(child);
+    }
+    auto removed = reduceByDeltaDebugging<Expression*>(children, [&](std::vector<Expression*>& toRemove) {
+      std::unordered_set<Expression*> removing(toRemove.begin(), toRemove.end());
+      std::vector<Expression*> old;
+      for (auto* child : block->list) {
+        old.push_back(child);
+      }
+      auto oldType = block->type;
+      block->list.clear();
+      for (auto* child : old) {
+        if (!removing.count(child)) {
+          block->list.push_back(child);
+        }
+      }
+      // The block must still fit where it is.
+      block->finalize();
+      if (block->type == oldType && writeAndTestReduction()) {
+        noteReduction(toRemove.size());
+        return true;
+      }
+      block->list.set(old);
+      block->type = oldType;
+      return false;
+    });
+    if (removed) {
+      std::cerr << "|      removed " << removed << " block children (in " << getLocation() << ")\n";
+    }
+  }
+
   // visitors. in each we try to remove code in a destructive and nontrivial way.
   // "nontrivial" means something that optimization passes can't achieve, since we
   // don't need to duplicate work that they do
@@ -557,6 +799,11 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
     }
   }
 
+  void doWalkFunction(Function* func) {
+    reduceBlocksHierarchically(func->body);
+    WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<Reducer>>>::doWalkFunction(func);
+  }
+
   void visitFunction(Function* curr) {
     if (!curr->imported()) {
       // extra chance to work on the function toplevel element, as if it can
@@ -595,6 +842,35 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
 
   template<typename T, typename U>
   void visitSegmented(T* curr, U zero, size_t bonus) {
+    // try to remove entire segments
+    if (!curr->segments.empty() && shouldTryToReduce(bonus)) {
+      auto original = curr->segments;
+      std::vector<bool> kept(original.size(), true);
+      auto update = [&]() {
+        curr->segments.clear();
+        for (Index i = 0; i < original.size(); i++) {
+          if (kept[i]) curr->segments.push_back(original[i]);
+        }
+      };
+      std::vector<Index> indexes;
+      for (Index i = 0; i < original.size(); i++) {
+        indexes.push_back(i);
+      }
+      auto removed = reduceByDeltaDebugging<Index>(indexes, [&](std::vector<Index>& toRemove) {
+        for (auto i : toRemove) kept[i] = false;
+        update();
+        if (writeAndTestReduction()) {
+          noteReduction(toRemove.size());
+          return true;
+        }
+        for (auto i : toRemove) kept[i] = true;
+        update();
+        return false;
+      });
+      if (removed) {
+        std::cerr << "|      removed " << removed << " segments\n";
+      }
+    }
     // try to reduce to first function. first, shrink segment elements.
     // while we are shrinking successfully, keep going exponentially.
     bool justShrank = false;
@@ -645,69 +921,59 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
 
   void visitModule(Module* curr) {
     assert(curr == module.get());
-    // try to remove functions
+    // try to remove functions. functions we already failed to remove are
+    // only tried again once in a while.
     std::cerr << "|    try to remove functions\n";
     std::vector<Name> functionNames;
     for (auto& func : module->functions) {
-      functionNames.push_back(func->name);
-    }
-    size_t skip = 1;
-    // If we just removed some functions in the previous iteration, keep trying to remove more
-    // as this is one of the most efficient ways to reduce.
-    bool justRemoved = false;
-    for (size_t i = 0; i < functionNames.size(); i++) {
-      if (!justRemoved &&
-          functionsWeTriedToRemove.count(functionNames[i]) == 1 &&
-         !shouldTryToReduce(std::max((factor / 100) + 1, 1000))) continue;
-      std::vector<Name> names;
-      for (size_t j = 0; names.size() < skip && i + j < functionNames.size(); j++) {
-        auto name = functionNames[i + j];
-        if (module->getFunctionOrNull(name)) {
-          names.push_back(name);
-          functionsWeTriedToRemove.insert(name);
-        }
-      }
-      if (names.size() == 0) continue;
-      std::cout << "|    try to remove " << names.size() << " functions (skip: " << skip << ")\n";
-      justRemoved = tryToRemoveFunctions(names);
-      if (justRemoved) {
-        noteReduction(names.size());
-        i += skip;
-        skip = std::min(size_t(factor), 2 * skip);
-      } else {
-        skip = std::max(skip / 2, size_t(1)); // or 1?
+      if (functionsWeTriedToRemove.count(func->name) == 0 ||
+          shouldTryToReduce(std::max((factor / 100) + 1, 1000))) {
+        functionNames.push_back(func->name);
+        functionsWeTriedToRemove.insert(func->name);
       }
     }
+    reduceByDeltaDebugging<Name>(functionNames, [&](std::vector<Name>& names) {
+      if (!tryToRemoveFunctions(names)) return false;
+      noteReduction(names.size());
+      return true;
+    });
     // try to remove exports
     std::cerr << "|    try to remove exports (with factor " << factor << ")\n";
-    std::vector<Export> exports;
+    std::vector<Name> exportNames;
     for (auto& exp : module->exports) {
-      exports.push_back(*exp);
+      if (shouldTryToReduce(std::max((factor / 100) + 1, 1000))) {
+        exportNames.push_back(exp->name);
+      }
     }
-    skip = 1;
-    for (size_t i = 0; i < exports.size(); i++) {
-      if (!shouldTryToReduce(std::max((factor / 100) + 1, 1000))) continue;
-      std::vector<Export> currExports;
-      for (size_t j = 0; currExports.size() < skip && i + j < exports.size(); j++) {
-        auto exp = exports[i + j];
-        if (module->getExportOrNull(exp.name)) {
-          currExports.push_back(exp);
-          module->removeExport(exp.name);
-        }
+    reduceByDeltaDebugging<Name>(exportNames, [&](std::vector<Name>& names) {
+      std::vector<Export> removed;
+      for (auto name : names) {
+        removed.push_back(*module->getExport(name));
+        module->removeExport(name);
       }
-      ProgramResult result;
-      if (!writeAndTestReduction(result)) {
-        for (auto exp : currExports) {
-          module->addExport(new Export(exp));
-        }
-        skip = std::max(skip / 2, size_t(1)); // or 1?
-      } else {
-        std::cerr << "|      removed " << currExports.size() << " exports\n";
-        noteReduction(currExports.size());
-        i += skip;
-        skip = std::min(size_t(factor), 2 * skip);
+      if (writeAndTestReduction()) {
+        std::cerr << "|      removed " << names.size() << " exports\n";
+        noteReduction(names.size());
+        return true;
+      }
+      for (auto& exp : removed) {
+        module->addExport(new Export(exp));
+      }
+      return false;
+    });
+    // try to remove globals
+    std::cerr << "|    try to remove globals\n";
+    std::vector<Name> globalNames;
+    for (auto& global : module->globals) {
+      if (shouldTryToReduce(std::max((factor / 100) + 1, 1000))) {
+        globalNames.push_back(global->name);
       }
     }
+    reduceByDeltaDebugging<Name>(globalNames, [&](std::vector<Name>& names) {
+      if (!tryToRemoveGlobals(names)) return false;
+      noteReduction(names.size());
+      return true;
+    });
     // If we are left with a single function that is not exported or used in
     // a table, that is useful as then we can change the return type.
     if (module->functions.size() == 1 && module->exports.empty() && module->table.segments.empty()) {
@@ -796,8 +1062,7 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
     FunctionReferenceRemover referenceRemover(names);
     referenceRemover.walkModule(module.get());
 
-    if (WasmValidator().validate(*module, Feature::All, WasmValidator::Globally | WasmValidator::Quiet) &&
-        writeAndTestReduction()) {
+    if (isValidOrTestedInProcess() && writeAndTestReduction()) {
       std::cerr << "|      removed " << names.size() << " functions\n";
       return true;
     } else {
@@ -806,6 +1071,53 @@ struct Reducer : public WalkerPass<PostWalker<Reducer, UnifiedExpressionVisitor<
     }
   }
 
+  bool tryToRemoveGlobals(std::vector<Name> names) {
+    for (auto name : names) {
+      module->removeGlobal(name);
+    }
+
+    // remove all references to them: reads become zeros, and writes just
+    // drop their values
+    struct GlobalReferenceRemover : public PostWalker<GlobalReferenceRemover> {
+      std::unordered_set<Name> names;
+      std::vector<Name> exportsToRemove;
+
+      GlobalReferenceRemover(std::vector<Name>& vec) : names(vec.begin(), vec.end()) {}
+
+      void visitGetGlobal(GetGlobal* curr) {
+        if (names.count(curr->name)) {
+          replaceCurrent(LiteralUtils::makeZero(curr->type, *getModule()));
+        }
+      }
+      void visitSetGlobal(SetGlobal* curr) {
+        if (names.count(curr->name)) {
+          replaceCurrent(Builder(*getModule()).makeDrop(curr->value));
+        }
+      }
+      void visitExport(Export* curr) {
+        if (curr->kind == ExternalKind::Global && names.count(curr->value)) {
+          exportsToRemove.push_back(curr->name);
+        }
+      }
+      void doWalkModule(Module* module) {
+        PostWalker<GlobalReferenceRemover>::doWalkModule(module);
+        for (auto name : exportsToRemove) {
+          module->removeExport(name);
+        }
+      }
+    };
+    GlobalReferenceRemover referenceRemover(names);
+    referenceRemover.walkModule(module.get());
+
+    if (isValidOrTestedInProcess() && writeAndTestReduction()) {
+      std::cerr << "|      removed " << names.size() << " globals\n";
+      return true;
+    } else {
+      loadWorking(); // restore it from orbit
+      return false;
+    }
+  }
+
   // helpers
 
   // try to replace condition with always true and always false
@@ -876,6 +1188,25 @@ int main(int argc, const char* argv[]) {
            [&](Options* o, const std::string& argument) {
              command = argument;
            })
+      .add("--in-process", "-ip", "Instead of running a command, run these wasm-opt options (like \"-O3 --flatten\") on each "
+                                  "candidate in a forked child process, and reduce while keeping how that exits (normally, with an "
+                                  "error, by crashing or aborting, or by timing out) unchanged. This avoids writing and reading a file "
+                                  "and starting a process for each test.",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             std::vector<std::string> args;
+             std::istringstream stream(argument);
+             std::string arg;
+             while (stream >> arg) {
+               args.push_back(arg);
+             }
+             std::vector<const char*> argv = { "wasm-reduce --in-process" };
+             for (auto& arg : args) {
+               argv.push_back(arg.c_str());
+             }
+             inProcessOptions = make_unique<OptimizationOptions>("wasm-reduce --in-process", "Passes to run in-process");
+             inProcessOptions->parse(argv.size(), argv.data());
+           })
       .add("--test", "-t", "Test file (this will be written to to test, the given command should read it when we call it)",
            Options::Arguments::One,
            [&](Options* o, const std::string& argument) {
@@ -925,6 +1256,7 @@ int main(int argc, const char* argv[]) {
                       });
   options.parse(argc, argv);
 
+  if (command.size() == 0 && !inProcessOptions) Fatal() << "command not provided\n";
   if (test.size() == 0) Fatal() << "test file not provided\n";
   if (working.size() == 0) Fatal() << "working file not provided\n";
 
@@ -939,7 +1271,7 @@ int main(int argc, const char* argv[]) {
 
   // get the expected output
   copy_file(input, test);
-  expected.getFromExecution(command);
+  expected = getResultOnTest(command, test);
 
   std::cerr << "|expected result:\n" << expected << '\n';
   std::cerr << "|!! Make sure the above is what you expect! !!\n\n";
@@ -951,19 +1283,27 @@ int main(int argc, const char* argv[]) {
     }
   };
 
-  if (expected.time + 1 >= timeout) {
+  if (expected.time + 1 >= timeout && expected.code != TimeoutCode) {
     stopIfNotForced("execution time is dangerously close to the timeout - you should probably increase the timeout", expected);
   }
 
-  std::cerr << "|checking that command has different behavior on invalid binary (this verifies that the test file is used by the command)\n";
-  {
-    {
-      std::ofstream dst(test, std::ios::binary);
-      dst << "waka waka\n";
+  if (inProcessOptions) {
+    if (expected.code == InvalidModuleCode) {
+      stopIfNotForced("the input is not valid", expected);
+    } else if (!expected.failed()) {
+      stopIfNotForced("the passes do not fail on the input", expected);
     }
-    ProgramResult result(command);
-    if (result == expected) {
-      stopIfNotForced("running command on an invalid module should give different results", result);
+  } else {
+    std::cerr << "|checking that command has different behavior on invalid binary (this verifies that the test file is used by the command)\n";
+    {
+      {
+        std::ofstream dst(test, std::ios::binary);
+        dst << "waka waka\n";
+      }
+      ProgramResult result(command);
+      if (result == expected) {
+        stopIfNotForced("running command on an invalid module should give different results", result);
+      }
     }
   }
 
@@ -976,7 +1316,7 @@ int main(int argc, const char* argv[]) {
     if (readWrite.failed()) {
       stopIfNotForced("failed to read and write the binary", readWrite);
     } else {
-      ProgramResult result(command);
+      auto result = getResultOnTest(command, test);
       if (result != expected) {
         stopIfNotForced("running command on the canonicalized module should give the same results", result);
       }
@@ -1060,6 +1400,6 @@ int main(int argc, const char* argv[]) {
 
     std::cerr << "|  destructive reduction led to size: " << file_size(working) << '\n';
   }
-  std::cerr << "|finished, final size: " << file_size(working) << "\n";
+  std::cerr << "|finished, final size: " << file_size(working) << ", tests run: " << numTests << " (in " << testTime << " seconds)\n";
   copy_file(working, test); // just to avoid confusion
 }
@@ -0,0 +1,538 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Splits a module in two: a primary module with the functions needed at
+// startup, and a secondary module with all the other ("cold") functions,
+// which can be downloaded and compiled later, on demand.
+//
+// The functions to keep in the primary module are given as a list, or as
+// a profile file containing the names of the functions that ran during
+// startup, one per line.
+//
+// References from the primary module to cold functions go through the
+// table: each such function gets a new table slot, initially filled with
+// a placeholder import, which the loader should implement by loading the
+// secondary module and then calling the function in the same slot again.
+// Direct calls in the primary module become call_indirects to the slot,
+// and exported or tabled cold functions are replaced with thunks that do
+// the same. The secondary module imports the primary module's memory,
+// table, globals and functions, and its element segment overwrites the
+// placeholders in the table with the real functions.
+//
+
+#include <fstream>
+#include <sstream>
+
+#include "asm_v_wasm.h"
+#include "pass.h"
+#include "support/colors.h"
+#include "support/command-line.h"
+#include "support/file.h"
+#include "wasm-binary.h"
+#include "wasm-builder.h"
+#include "wasm-io.h"
+#include "wasm-printing.h"
+#include "wasm-validator.h"
+#include "ir/find_all.h"
+#include "ir/function-type-utils.h"
+#include "ir/module-utils.h"
+
+using namespace wasm;
+
+struct ModuleSplitter {
+  Module& primary;
+  Module& secondary;
+  std::set<Name>& keep;
+  Name importNamespace;
+  Name placeholderNamespace;
+
+  // The functions that move to the secondary module, in module order.
+  std::vector<Name> cold;
+  std::set<Name> isCold;
+  // The table slots of the cold functions the primary module refers to.
+  std::map<Name, Index> slots;
+  // The cold functions that need a thunk in the primary module.
+  std::set<Name> needsThunk;
+
+  ModuleSplitter(Module& primary, Module& secondary, std::set<Name>& keep,
+                 Name importNamespace, Name placeholderNamespace)
+    : primary(primary), secondary(secondary), keep(keep),
+      importNamespace(importNamespace), placeholderNamespace(placeholderNamespace) {}
+
+  void split() {
+    classifyFunctions();
+    findPrimaryReferences();
+    // Copy the cold functions before the primary module changes.
+    for (auto name : cold) {
+      ModuleUtils::copyFunction(primary.getFunction(name), secondary);
+    }
+    allocateSlots();
+    rewritePrimary();
+    linkSecondary();
+  }
+
+  void classifyFunctions() {
+    for (auto& func : primary.functions) {
+      if (func->imported() || keep.count(func->name) || func->name == primary.start) {
+        continue;
+      }
+      cold.push_back(func->name);
+      isCold.insert(func->name);
+    }
+  }
+
+  void findPrimaryReferences() {
+    for (auto& func : primary.functions) {
+      if (func->imported() || isCold.count(func->name)) continue;
+      for (auto* call : FindAll<Call>(func->body).list) {
+        if (isCold.count(call->target)) {
+          slots[call->target];
+        }
+      }
+    }
+    for (auto& curr : primary.exports) {
+      if (curr->kind == ExternalKind::Function && isCold.count(curr->value)) {
+        slots[curr->value];
+        needsThunk.insert(curr->value);
+      }
+    }
+    for (auto& segment : primary.table.segments) {
+      for (auto name : segment.data) {
+        if (isCold.count(name)) {
+          slots[name];
+          needsThunk.insert(name);
+        }
+      }
+    }
+  }
+
+  // New slots go after everything in the table.
+  void allocateSlots() {
+    if (slots.empty()) return;
+    auto& table = primary.table;
+    Index base = table.initial;
+    for (auto& segment : table.segments) {
+      auto* offset = segment.offset->dynCast<Const>();
+      if (!offset) {
+        Fatal() << "cannot split a module with a non-constant table segment offset";
+      }
+      base = std::max(base, Index(offset->value.geti32() + segment.data.size()));
+    }
+    Builder builder(primary);
+    std::vector<Name> placeholders;
+    for (auto name : cold) {
+      if (!slots.count(name)) continue;
+      Index slot = base + placeholders.size();
+      slots[name] = slot;
+      auto* func = primary.getFunction(name);
+      auto* import = new Function();
+      import->name = getValidFunctionName(primary, std::string(placeholderNamespace.str) + "$" + std::to_string(slot));
+      import->module = placeholderNamespace;
+      import->base = Name(std::to_string(slot));
+      import->type = ensureFunctionType(getSig(func), &primary)->name;
+      FunctionTypeUtils::fillFunction(import, primary.getFunctionType(import->type));
+      primary.addFunction(import);
+      placeholders.push_back(import->name);
+    }
+    table.exists = true;
+    table.initial = base + placeholders.size();
+    if (table.max < table.initial) {
+      table.max = table.initial;
+    }
+    table.segments.emplace_back(builder.makeConst(Literal(int32_t(base))), placeholders);
+  }
+
+  CallIndirect* makeIndirectCall(Function* func, const std::vector<Expression*>& operands) {
+    Builder builder(primary);
+    auto* call = builder.makeCallIndirect(ensureFunctionType(getSig(func), &primary),
+                                          builder.makeConst(Literal(int32_t(slots[func->name]))),
+                                          operands);
+    call->finalize();
+    return call;
+  }
+
+  void rewritePrimary() {
+    // Calls to cold functions go through the table.
+    struct CallRewriter : public PostWalker<CallRewriter> {
+      ModuleSplitter& parent;
+
+      CallRewriter(ModuleSplitter& parent) : parent(parent) {}
+
+      void visitCall(Call* curr) {
+        if (!parent.isCold.count(curr->target)) return;
+        std::vector<Expression*> operands;
+        for (auto* operand : curr->operands) {
+          operands.push_back(operand);
+        }
+        replaceCurrent(parent.makeIndirectCall(getModule()->getFunction(curr->target), operands));
+      }
+    };
+    CallRewriter rewriter(*this);
+    rewriter.setModule(&primary);
+    for (auto& func : primary.functions) {
+      if (func->imported() || isCold.count(func->name)) continue;
+      rewriter.walkFunction(func.get());
+    }
+    // Replace the cold functions with thunks, or remove them entirely.
+    Builder builder(primary);
+    for (auto name : cold) {
+      auto* func = primary.getFunction(name);
+      Function* thunk = nullptr;
+      if (needsThunk.count(name)) {
+        std::vector<Expression*> args;
+        for (Index i = 0; i < func->getNumParams(); i++) {
+          args.push_back(builder.makeGetLocal(i, func->getLocalType(i)));
+        }
+        auto* body = makeIndirectCall(func, args);
+        auto params = func->params;
+        thunk = builder.makeFunction(name, std::move(params), func->result, {}, body);
+        thunk->type = func->type;
+      }
+      primary.removeFunction(name);
+      if (thunk) {
+        primary.addFunction(thunk);
+      }
+    }
+  }
+
+  // Exports something from the primary module for the secondary module,
+  // reusing an existing export if there is one.
+  Name exportFromPrimary(ExternalKind kind, Name internal, Name preferred) {
+    for (auto& curr : primary.exports) {
+      if (curr->kind == kind && curr->value == internal) {
+        return curr->name;
+      }
+    }
+    Name name = preferred;
+    Index i = 0;
+    while (primary.getExportOrNull(name)) {
+      name = Name(std::string(preferred.str) + "_" + std::to_string(i++));
+    }
+    auto* curr = new Export();
+    curr->name = name;
+    curr->value = internal;
+    curr->kind = kind;
+    primary.addExport(curr);
+    return name;
+  }
+
+  // Sets up a secondary import of a primary module entity.
+  void importFromPrimary(Importable* secondaryImport, Importable* primaryEntity,
+                         ExternalKind kind, Name internal, Name preferred) {
+    if (primaryEntity->imported()) {
+      secondaryImport->module = primaryEntity->module;
+      secondaryImport->base = primaryEntity->base;
+    } else {
+      secondaryImport->module = importNamespace;
+      secondaryImport->base = exportFromPrimary(kind, internal, preferred);
+    }
+  }
+
+  void linkSecondary() {
+    std::set<Name> calledFunctions, usedGlobals, usedTypes;
+    for (auto& func : secondary.functions) {
+      for (auto* call : FindAll<Call>(func->body).list) {
+        if (!isCold.count(call->target)) {
+          calledFunctions.insert(call->target);
+        }
+      }
+      for (auto* get : FindAll<GetGlobal>(func->body).list) {
+        usedGlobals.insert(get->name);
+      }
+      for (auto* set : FindAll<SetGlobal>(func->body).list) {
+        usedGlobals.insert(set->name);
+      }
+      for (auto* call : FindAll<CallIndirect>(func->body).list) {
+        usedTypes.insert(call->fullType);
+      }
+    }
+    for (auto name : calledFunctions) {
+      auto* target = primary.getFunction(name);
+      auto* import = new Function();
+      import->name = name;
+      importFromPrimary(import, target, ExternalKind::Function, name, name);
+      import->type = ensureFunctionType(getSig(target), &secondary)->name;
+      FunctionTypeUtils::fillFunction(import, secondary.getFunctionType(import->type));
+      secondary.addFunction(import);
+    }
+    // Mutable globals cannot be imported, so the primary module exports
+    // accessor functions for them instead.
+    std::map<Name, Name> getters, setters;
+    for (auto name : usedGlobals) {
+      auto* global = primary.getGlobal(name);
+      if (global->mutable_) {
+        getters[name] = importAccessor(global, false);
+        setters[name] = importAccessor(global, true);
+        continue;
+      }
+      auto* import = new Global();
+      import->name = name;
+      import->type = global->type;
+      importFromPrimary(import, global, ExternalKind::Global, name, name);
+      secondary.addGlobal(import);
+    }
+    if (!getters.empty()) {
+      struct GlobalRewriter : public PostWalker<GlobalRewriter> {
+        std::map<Name, Name>& getters;
+        std::map<Name, Name>& setters;
+
+        GlobalRewriter(std::map<Name, Name>& getters, std::map<Name, Name>& setters) : getters(getters), setters(setters) {}
+
+        void visitGetGlobal(GetGlobal* curr) {
+          auto iter = getters.find(curr->name);
+          if (iter != getters.end()) {
+            replaceCurrent(Builder(*getModule()).makeCall(iter->second, {}, curr->type));
+          }
+        }
+        void visitSetGlobal(SetGlobal* curr) {
+          auto iter = setters.find(curr->name);
+          if (iter != setters.end()) {
+            auto* call = Builder(*getModule()).makeCall(iter->second, { curr->value }, none);
+            call->finalize();
+            replaceCurrent(call);
+          }
+        }
+      };
+      GlobalRewriter rewriter(getters, setters);
+      rewriter.setModule(&secondary);
+      for (auto name : cold) {
+        rewriter.walkFunction(secondary.getFunction(name));
+      }
+    }
+    for (auto name : usedTypes) {
+      if (secondary.getFunctionTypeOrNull(name)) continue;
+      auto* type = new FunctionType(*primary.getFunctionType(name));
+      secondary.addFunctionType(type);
+    }
+    if (primary.memory.exists) {
+      auto& memory = secondary.memory;
+      memory.exists = true;
+      memory.initial = primary.memory.initial;
+      memory.max = primary.memory.max;
+      memory.shared = primary.memory.shared;
+      importFromPrimary(&memory, &primary.memory, ExternalKind::Memory, primary.memory.name, Name("memory"));
+    }
+    if (primary.table.exists) {
+      auto& table = secondary.table;
+      table.exists = true;
+      table.initial = primary.table.initial;
+      table.max = primary.table.max;
+      importFromPrimary(&table, &primary.table, ExternalKind::Table, primary.table.name, Name("table"));
+      // Fill in the slots of the placeholders with the real functions.
+      if (!slots.empty()) {
+        std::vector<Name> data;
+        Index base = Index(-1);
+        for (auto name : cold) {
+          auto iter = slots.find(name);
+          if (iter == slots.end()) continue;
+          base = std::min(base, iter->second);
+          data.push_back(name);
+        }
+        Builder builder(secondary);
+        table.segments.emplace_back(builder.makeConst(Literal(int32_t(base))), data);
+      }
+    }
+  }
+
+  // Adds a getter or setter for a global to the primary module, and
+  // imports it in the secondary module. Returns the name of the import.
+  Name importAccessor(Global* global, bool set) {
+    Builder builder(primary);
+    auto suffix = set ? "$set" : "$get";
+    auto name = getValidFunctionName(primary, std::string(global->name.str) + suffix);
+    Function* accessor;
+    if (set) {
+      accessor = builder.makeFunction(name, std::vector<Type>{ global->type }, none, std::vector<Type>{},
+        builder.makeSetGlobal(global->name, builder.makeGetLocal(0, global->type)));
+    } else {
+      accessor = builder.makeFunction(name, std::vector<Type>{}, global->type, std::vector<Type>{},
+        builder.makeGetGlobal(global->name, global->type));
+    }
+    accessor->type = ensureFunctionType(getSig(accessor), &primary)->name;
+    primary.addFunction(accessor);
+    auto* import = new Function();
+    import->name = getValidFunctionName(secondary, name.str);
+    importFromPrimary(import, accessor, ExternalKind::Function, name, name);
+    import->type = ensureFunctionType(getSig(accessor), &secondary)->name;
+    FunctionTypeUtils::fillFunction(import, secondary.getFunctionType(import->type));
+    secondary.addFunction(import);
+    return import->name;
+  }
+
+  static Name getValidFunctionName(Module& module, std::string name) {
+    Name ret = name;
+    Index i = 0;
+    while (module.getFunctionOrNull(ret)) {
+      ret = Name(name + "_" + std::to_string(i++));
+    }
+    return ret;
+  }
+};
+
+static void readNames(std::string input, std::set<Name>& names) {
+  std::istringstream stream(input.c_str());
+  std::string line;
+  while (std::getline(stream, line)) {
+    // ignore comments and surrounding whitespace
+    line = line.substr(0, line.find('#'));
+    auto start = line.find_first_not_of(" \t\r");
+    if (start == std::string::npos) continue;
+    auto end = line.find_last_not_of(" \t\r");
+    names.insert(Name(line.substr(start, end - start + 1)));
+  }
+}
+
+static size_t getBinarySize(Module& wasm) {
+  BufferWithRandomAccess buffer;
+  WasmBinaryWriter writer(&wasm, buffer);
+  writer.write();
+  return buffer.size();
+}
+
+static void writeModule(Module& wasm, std::string filename, bool emitBinary, bool debugInfo) {
+  ModuleWriter writer;
+  writer.setBinary(emitBinary);
+  writer.setDebugInfo(debugInfo);
+  writer.write(wasm, filename);
+}
+
+int main(int argc, const char* argv[]) {
+  std::set<Name> keep;
+  std::string primaryOutput, secondaryOutput;
+  Name importNamespace = "primary";
+  Name placeholderNamespace = "placeholder";
+  bool emitBinary = true;
+  bool debugInfo = false;
+  bool verbose = false;
+
+  Options options("wasm-split", "Split a module into a primary module, with the functions "
+                                "needed at startup, and a secondary module, with the rest, "
+                                "to be loaded lazily.\n\n"
+                                "The primary module calls the moved functions through the "
+                                "table. Until the secondary module is instantiated, their "
+                                "slots hold imports from the placeholder namespace, named "
+                                "by the slot index. The secondary module imports the memory, "
+                                "table, globals and functions it needs from the primary "
+                                "module, and its element segment fills in those slots.");
+  options
+      .add("--keep-funcs", "-k", "Comma-separated list of functions to keep in the primary module",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             std::istringstream stream(argument);
+             std::string name;
+             while (std::getline(stream, name, ',')) {
+               keep.insert(Name(name));
+             }
+           })
+      .add("--profile", "-p", "File with the names of the functions to keep in the primary "
+                               "module, such as the ones that ran during startup, one per line",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             readNames(read_file<std::string>(argument, Flags::Text, Flags::Release), keep);
+           })
+      .add("--primary-output", "-o1", "Output file for the primary module",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             primaryOutput = argument;
+             Colors::disable();
+           })
+      .add("--secondary-output", "-o2", "Output file for the secondary module",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) {
+             secondaryOutput = argument;
+             Colors::disable();
+           })
+      .add("--import-namespace", "-in", "The namespace the secondary module imports from "
+                                         "the primary module with (default: primary)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { importNamespace = argument; })
+      .add("--placeholder-namespace", "-pn", "The namespace of the placeholder imports "
+                                              "(default: placeholder)",
+           Options::Arguments::One,
+           [&](Options* o, const std::string& argument) { placeholderNamespace = argument; })
+      .add("--emit-text", "-S", "Emit text instead of binary for the output files",
+           Options::Arguments::Zero,
+           [&](Options *o, const std::string& argument) { emitBinary = false; })
+      .add("--debuginfo", "-g", "Emit names section and debug info",
+           Options::Arguments::Zero,
+           [&](Options *o, const std::string& arguments) { debugInfo = true; })
+      .add("--verbose", "-v", "Report the sizes of the modules",
+           Options::Arguments::Zero,
+           [&](Options *o, const std::string& arguments) { verbose = true; })
+      .add_positional("INFILE", Options::Arguments::One,
+                      [](Options* o, const std::string& argument) {
+                        o->extra["infile"] = argument;
+                      });
+  options.parse(argc, argv);
+
+  Module primary;
+  {
+    if (options.debug) std::cerr << "reading...\n";
+    ModuleReader reader;
+    reader.setDebug(options.debug);
+    try {
+      reader.read(options.extra["infile"], primary);
+    } catch (ParseException& p) {
+      p.dump(std::cerr);
+      Fatal() << "error in parsing wasm input";
+    }
+  }
+
+  if (!WasmValidator().validate(primary)) {
+    WasmPrinter::printModule(&primary);
+    Fatal() << "error in validating input";
+  }
+
+  for (auto name : keep) {
+    auto* func = primary.getFunctionOrNull(name);
+    if (!func) {
+      std::cerr << "warning: function to keep not found: " << name << '\n';
+    }
+  }
+
+  size_t originalSize = verbose ? getBinarySize(primary) : 0;
+
+  Module secondary;
+  ModuleSplitter splitter(primary, secondary, keep, importNamespace, placeholderNamespace);
+  splitter.split();
+
+  if (!WasmValidator().validate(primary)) {
+    WasmPrinter::printModule(&primary);
+    Fatal() << "error in validating the primary module";
+  }
+  if (!WasmValidator().validate(secondary)) {
+    WasmPrinter::printModule(&secondary);
+    Fatal() << "error in validating the secondary module";
+  }
+
+  if (verbose) {
+    auto primarySize = getBinarySize(primary);
+    auto secondarySize = getBinarySize(secondary);
+    std::cerr << "moved " << splitter.cold.size() << " functions, "
+              << splitter.slots.size() << " of them called through the table\n"
+              << "original size:  " << originalSize << '\n'
+              << "primary size:   " << primarySize << '\n'
+              << "secondary size: " << secondarySize << '\n';
+  }
+
+  if (primaryOutput.size() > 0) {
+    writeModule(primary, primaryOutput, emitBinary, debugInfo);
+  }
+  if (secondaryOutput.size() > 0) {
+    writeModule(secondary, secondaryOutput, emitBinary, debugInfo);
+  }
+}
@@ -23,13 +23,14 @@
 #include "support/file.h"
 #include "wasm-s-parser.h"
 #include "wasm2js.h"
+#include "optimization-options.h"
 
 using namespace cashew;
 using namespace wasm;
 
 int main(int argc, const char *argv[]) {
   Wasm2JSBuilder::Flags builderFlags;
-  Options options("wasm2js", "Transform .wasm/.wast files to asm.js");
+  OptimizationOptions options("wasm2js", "Transform .wasm/.wast files to asm.js");
   options
       .add("--output", "-o", "Output file (stdout if not specified)",
            Options::Arguments::One,
@@ -77,7 +78,7 @@ int main(int argc, const char *argv[]) {
       reader.read(input, wasm, "");
 
       if (options.debug) std::cerr << "asming..." << std::endl;
-      Wasm2JSBuilder wasm2js(builderFlags);
+      Wasm2JSBuilder wasm2js(builderFlags, options.passOptions);
       asmjs = wasm2js.processWasm(&wasm);
 
     } else {
@@ -91,7 +92,7 @@ int main(int argc, const char *argv[]) {
       SExpressionWasmBuilder builder(wasm, *(*root)[0]);
 
       if (options.debug) std::cerr << "asming..." << std::endl;
-      Wasm2JSBuilder wasm2js(builderFlags);
+      Wasm2JSBuilder wasm2js(builderFlags, options.passOptions);
       asmjs = wasm2js.processWasm(&wasm);
 
       if (options.extra["asserts"] == "1") {
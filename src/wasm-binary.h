@@ -32,6 +32,7 @@
 #include "wasm-builder.h"
 #include "parsing.h"
 #include "wasm-validator.h"
+#include "pass.h"
 #include "ir/import-utils.h"
 
 namespace wasm {
@@ -77,6 +78,20 @@ struct LEB {
     } while (more);
   }
 
+  // returns the number of bytes write() would emit
+  size_t size() {
+    T temp = value;
+    size_t ret = 0;
+    bool more;
+    do {
+      uint8_t byte = temp & 127;
+      temp >>= 7;
+      more = hasMore(temp, byte);
+      ret++;
+    } while (more);
+    return ret;
+  }
+
   // @minimum: a minimum number of bytes to write, padding as necessary
   // returns the number of bytes written
   size_t writeAt(std::vector<uint8_t>* out, size_t at, size_t minimum = 0) {
@@ -680,11 +695,20 @@ public:
   } tableOfContents;
 
   void setNamesSection(bool set) { debugInfo = set; }
+  // Whether to write the code section (when not, the module is not valid,
+  // but the other sections are written as usual).
+  void setCodeSection(bool set) { codeSection = set; }
   void setSourceMap(std::ostream* set, std::string url) {
     sourceMap = set;
     sourceMapUrl = url;
   }
   void setSymbolMap(std::string set) { symbolMap = set; }
+  // Optimize Stack IR while writing functions that do not have it, with
+  // these options, like optimize-stack-ir would.
+  void setOptimizeStackIR(const PassOptions& options) {
+    optimizeStackIR = true;
+    stackIROptions = options;
+  }
 
   void write();
   void writeHeader();
@@ -754,9 +778,12 @@ private:
   bool debug;
 
   bool debugInfo = true;
+  bool codeSection = true;
   std::ostream* sourceMap = nullptr;
   std::string sourceMapUrl;
   std::string symbolMap;
+  bool optimizeStackIR = false;
+  PassOptions stackIROptions;
 
   MixedArena allocator;
 
@@ -0,0 +1,88 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+//
+// Exact sizes of functions and modules in the binary format, without
+// writing out the whole module.
+//
+// Function bodies are measured with the same StackWriter logic that
+// WasmBinaryWriter uses, so the sizes are exact. Bodies are measured in
+// parallel, and cached along with a hash of the function, so measuring a
+// module again after a few of its functions changed only measures those. That
+// makes it cheap to ask for the size of a module repeatedly, for example
+// when running passes to convergence.
+//
+// The indexes of functions, globals and types affect the size of the code
+// that refers to them. They are noted when the oracle is created and each
+// time the size of the code section or module is computed, and the cache is
+// cleared if they changed.
+//
+
+#ifndef wasm_wasm_encoded_size_h
+#define wasm_wasm_encoded_size_h
+
+#include <mutex>
+#include <unordered_map>
+
+#include "wasm.h"
+#include "wasm-binary.h"
+
+namespace wasm {
+
+class EncodedSizeOracle {
+public:
+  EncodedSizeOracle(Module& wasm);
+
+  // The size of a function body in the code section, not including the
+  // LEB of that size before it.
+  size_t getBodySize(Function* func);
+
+  // The size of the code section, including its header.
+  size_t getCodeSectionSize();
+
+  // The size of the module, as WasmBinaryWriter writes it by default.
+  size_t getModuleSize();
+
+  // The interface StackWriter uses to write references to module elements.
+  Module* getModule() { return &wasm; }
+  uint32_t getFunctionIndex(Name name) { return functionIndexes.at(name); }
+  uint32_t getGlobalIndex(Name name) { return globalIndexes.at(name); }
+  int32_t getFunctionTypeIndex(Name type) { return typeIndexes.at(type); }
+  void writeDebugLocation(const Function::DebugLocation& loc) {}
+  void writeDebugLocation(Expression* curr, Function* func) {}
+
+private:
+  Module& wasm;
+
+  std::unordered_map<Name, Index> functionIndexes, globalIndexes, typeIndexes;
+
+  struct CacheEntry {
+    uint64_t hash;
+    size_t size;
+  };
+
+  std::mutex cacheMutex;
+  std::unordered_map<Name, CacheEntry> cache;
+
+  void updateIndexes();
+  uint64_t hashFunction(Function* func);
+  // Measures a body, using a buffer that the caller reuses.
+  size_t measure(Function* func, BufferWithRandomAccess& buffer);
+};
+
+} // namespace wasm
+
+#endif // wasm_wasm_encoded_size_h
@@ -627,6 +627,95 @@ public:
     virtual void store16(Address addr, int16_t value) { WASM_UNREACHABLE(); }
     virtual void store32(Address addr, int32_t value) { WASM_UNREACHABLE(); }
     virtual void store64(Address addr, int64_t value) { WASM_UNREACHABLE(); }
+
+    // Atomic accesses. Narrow accesses zero-extend what they read, and
+    // rmw and cmpxchg return the value before the operation. The defaults
+    // use the loads and stores above, which is only atomic if no other
+    // thread can access the memory at the same time; interfaces that share
+    // a memory between threads must override these.
+    virtual Literal atomicLoad(Address addr, Index bytes, Type type) {
+      uint64_t value;
+      switch (bytes) {
+        case 1: value = load8u(addr); break;
+        case 2: value = load16u(addr); break;
+        case 4: value = load32u(addr); break;
+        case 8: value = load64u(addr); break;
+        default: WASM_UNREACHABLE();
+      }
+      return type == i32 ? Literal(uint32_t(value)) : Literal(value);
+    }
+    virtual void atomicStore(Address addr, Index bytes, Literal value) {
+      uint64_t bits = value.type == i32 ? uint32_t(value.geti32()) : value.geti64();
+      switch (bytes) {
+        case 1: store8(addr, bits); break;
+        case 2: store16(addr, bits); break;
+        case 4: store32(addr, bits); break;
+        case 8: store64(addr, bits); break;
+        default: WASM_UNREACHABLE();
+      }
+    }
+    virtual Literal atomicRMW(AtomicRMWOp op, Address addr, Index bytes, Literal value) {
+      auto loaded = atomicLoad(addr, bytes, value.type);
+      Literal computed;
+      switch (op) {
+        case Add:  computed = loaded.add(value);  break;
+        case Sub:  computed = loaded.sub(value);  break;
+        case And:  computed = loaded.and_(value); break;
+        case Or:   computed = loaded.or_(value);  break;
+        case Xor:  computed = loaded.xor_(value); break;
+        case Xchg: computed = value;              break;
+      }
+      atomicStore(addr, bytes, computed);
+      return loaded;
+    }
+    virtual Literal atomicCmpxchg(Address addr, Index bytes, Literal expected, Literal replacement) {
+      auto loaded = atomicLoad(addr, bytes, expected.type);
+      if (loaded == wrapToBytes(expected, bytes)) {
+        atomicStore(addr, bytes, replacement);
+      }
+      return loaded;
+    }
+    // Waits until woken if the memory holds the expected value, for at most
+    // timeout nanoseconds, or forever if it is negative. Returns 0 if woken,
+    // 1 if the value was not the expected one, and 2 if the wait timed out.
+    // By default no other thread can wake us, so waiting can only time out.
+    virtual int32_t atomicWait(Address addr, Literal expected, int64_t timeout) {
+      auto bytes = getTypeSize(expected.type);
+      if (atomicLoad(addr, bytes, expected.type) != expected) {
+        return 1;
+      }
+      if (timeout < 0) {
+        trap("wait would never be woken");
+      }
+      return 2;
+    }
+    // Wakes up to count waiters on an address, returning how many woke.
+    virtual uint32_t atomicWake(Address addr, uint32_t count) {
+      return 0;
+    }
+
+    // A shared memory can be grown by any of the instances that use it, so
+    // they ask the interface for its current size, in pages, instead of
+    // remembering it, and let the interface grow it atomically. Growing
+    // returns the old size, or -1 if the memory cannot grow by delta pages.
+    // The defaults are for a memory that only the calling instance uses, so
+    // the size it last saw is the current one.
+    virtual Address getSharedMemorySize(Address lastSeen) {
+      return lastSeen;
+    }
+    virtual Address growSharedMemory(Address lastSeen, Address delta, Address max) {
+      if (delta > max || lastSeen > max - delta) return Address(uint32_t(-1));
+      growMemory(lastSeen * Memory::kPageSize, (lastSeen + delta) * Memory::kPageSize);
+      return lastSeen;
+    }
+
+  protected:
+    static Literal wrapToBytes(Literal value, Index bytes) {
+      if (bytes == getTypeSize(value.type)) return value;
+      uint64_t mask = (uint64_t(1) << (bytes * 8)) - 1;
+      if (value.type == i32) return Literal(uint32_t(value.geti32() & mask));
+      return Literal(uint64_t(value.geti64() & mask));
+    }
   };
 
   SubType* self() {
@@ -832,7 +921,13 @@ public:
         if (flow.breaking()) return flow;
         NOTE_EVAL1(flow);
         auto addr = instance.getFinalAddress(curr, flow.value);
-        auto ret = instance.externalInterface->load(curr, addr);
+        Literal ret;
+        if (curr->isAtomic) {
+          instance.checkAtomicAddress(addr, curr->bytes);
+          ret = instance.externalInterface->atomicLoad(addr, curr->bytes, curr->type);
+        } else {
+          ret = instance.externalInterface->load(curr, addr);
+        }
         NOTE_EVAL1(addr);
         NOTE_EVAL1(ret);
         return ret;
@@ -846,7 +941,12 @@ public:
         auto addr = instance.getFinalAddress(curr, ptr.value);
         NOTE_EVAL1(addr);
         NOTE_EVAL1(value);
-        instance.externalInterface->store(curr, addr, value.value);
+        if (curr->isAtomic) {
+          instance.checkAtomicAddress(addr, curr->bytes);
+          instance.externalInterface->atomicStore(addr, curr->bytes, value.value);
+        } else {
+          instance.externalInterface->store(curr, addr, value.value);
+        }
         return Flow();
       }
 
@@ -860,18 +960,9 @@ public:
         auto addr = instance.getFinalAddress(curr, ptr.value);
         NOTE_EVAL1(addr);
         NOTE_EVAL1(value);
-        auto loaded = instance.doAtomicLoad(addr, curr->bytes, curr->type);
+        instance.checkAtomicAddress(addr, curr->bytes);
+        auto loaded = instance.externalInterface->atomicRMW(curr->op, addr, curr->bytes, value.value);
         NOTE_EVAL1(loaded);
-        auto computed = value.value;
-        switch (curr->op) {
-          case Add:  computed = computed.add(value.value); break;
-          case Sub:  computed = computed.sub(value.value); break;
-          case And:  computed = computed.and_(value.value); break;
-          case Or:   computed = computed.or_(value.value);  break;
-          case Xor:  computed = computed.xor_(value.value); break;
-          case Xchg: computed = value.value;               break;
-        }
-        instance.doAtomicStore(addr, curr->bytes, computed);
         return loaded;
       }
       Flow visitAtomicCmpxchg(AtomicCmpxchg *curr) {
@@ -887,11 +978,9 @@ public:
         NOTE_EVAL1(addr);
         NOTE_EVAL1(expected);
         NOTE_EVAL1(replacement);
-        auto loaded = instance.doAtomicLoad(addr, curr->bytes, curr->type);
+        instance.checkAtomicAddress(addr, curr->bytes);
+        auto loaded = instance.externalInterface->atomicCmpxchg(addr, curr->bytes, expected.value, replacement.value);
         NOTE_EVAL1(loaded);
-        if (loaded == expected.value) {
-          instance.doAtomicStore(addr, curr->bytes, replacement.value);
-        }
         return loaded;
       }
       Flow visitAtomicWait(AtomicWait *curr) {
@@ -906,15 +995,9 @@ public:
         NOTE_EVAL1(timeout);
         if (timeout.breaking()) return timeout;
         auto bytes = getTypeSize(curr->expectedType);
-        auto addr = instance.getFinalAddress(ptr.value, bytes);
-        auto loaded = instance.doAtomicLoad(addr, bytes, curr->expectedType);
-        NOTE_EVAL1(loaded);
-        if (loaded != expected.value) {
-          return Literal(int32_t(1)); // not equal
-        }
-        // TODO: add threads support!
-        //       for now, just assume we are woken up
-        return Literal(int32_t(0)); // woken up
+        auto addr = instance.getFinalAddress(ptr.value, curr->offset, bytes);
+        instance.checkAtomicAddress(addr, bytes);
+        return Literal(instance.externalInterface->atomicWait(addr, expected.value, timeout.value.geti64()));
       }
       Flow visitAtomicWake(AtomicWake *curr) {
         NOTE_ENTER("AtomicWake");
@@ -924,19 +1007,29 @@ public:
         auto count = this->visit(curr->wakeCount);
         NOTE_EVAL1(count);
         if (count.breaking()) return count;
-        // TODO: add threads support!
-        return Literal(int32_t(0)); // none woken up
+        auto addr = instance.getFinalAddress(ptr.value, curr->offset, 4);
+        instance.checkAtomicAddress(addr, 4);
+        return Literal(int32_t(instance.externalInterface->atomicWake(addr, count.value.geti32())));
       }
       Flow visitHost(Host *curr) {
         NOTE_ENTER("Host");
         switch (curr->op) {
-          case CurrentMemory: return Literal(int32_t(instance.memorySize));
+          case CurrentMemory: {
+            instance.updateSharedMemorySize();
+            return Literal(int32_t(instance.memorySize));
+          }
           case GrowMemory: {
             auto fail = Literal(int32_t(-1));
             Flow flow = this->visit(curr->operands[0]);
             if (flow.breaking()) return flow;
-            int32_t ret = instance.memorySize;
             uint32_t delta = flow.value.geti32();
+            if (instance.wasm.memory.shared) {
+              uint32_t old = instance.externalInterface->growSharedMemory(instance.memorySize, delta, instance.wasm.memory.max);
+              if (old == uint32_t(-1)) return fail;
+              instance.memorySize = old + delta;
+              return Literal(int32_t(old));
+            }
+            int32_t ret = instance.memorySize;
             if (delta > uint32_t(-1) /Memory::kPageSize) return fail;
             if (instance.memorySize >= uint32_t(-1) - delta) return fail;
             uint32_t newSize = instance.memorySize + delta;
@@ -1004,20 +1097,21 @@ protected:
 
   template<class LS>
   Address getFinalAddress(LS* curr, Literal ptr) {
-    Address memorySizeBytes = memorySize * Memory::kPageSize;
-    uint64_t addr = ptr.type == i32 ? ptr.geti32() : ptr.geti64();
-    trapIfGt(curr->offset, memorySizeBytes, "offset > memory");
-    trapIfGt(addr, memorySizeBytes - curr->offset, "final > memory");
-    addr += curr->offset;
-    trapIfGt(curr->bytes, memorySizeBytes, "bytes > memory");
-    checkLoadAddress(addr, curr->bytes);
-    return addr;
+    return getFinalAddress(ptr, curr->offset, curr->bytes);
   }
 
-  Address getFinalAddress(Literal ptr, Index bytes) {
-    Address memorySizeBytes = memorySize * Memory::kPageSize;
+  Address getFinalAddress(Literal ptr, Address offset, Index bytes) {
     uint64_t addr = ptr.type == i32 ? ptr.geti32() : ptr.geti64();
-    trapIfGt(addr, memorySizeBytes - bytes, "highest > memory");
+    if (uint64_t(offset) + addr + bytes > uint64_t(memorySize) * Memory::kPageSize) {
+      // Another instance may have grown a shared memory.
+      updateSharedMemorySize();
+    }
+    Address memorySizeBytes = memorySize * Memory::kPageSize;
+    trapIfGt(offset, memorySizeBytes, "offset > memory");
+    trapIfGt(addr, memorySizeBytes - offset, "final > memory");
+    addr += offset;
+    trapIfGt(bytes, memorySizeBytes, "bytes > memory");
+    checkLoadAddress(addr, bytes);
     return addr;
   }
 
@@ -1026,36 +1120,16 @@ protected:
     trapIfGt(addr, memorySizeBytes - bytes, "highest > memory");
   }
 
-  Literal doAtomicLoad(Address addr, Index bytes, Type type) {
-    checkLoadAddress(addr, bytes);
-    Const ptr;
-    ptr.value = Literal(int32_t(addr));
-    ptr.type = i32;
-    Load load;
-    load.bytes = bytes;
-    load.signed_ = true;
-    load.align = bytes;
-    load.isAtomic = true; // understatement
-    load.ptr = &ptr;
-    load.type = type;
-    return externalInterface->load(&load, addr);
+  void checkAtomicAddress(Address addr, Index bytes) {
+    if (addr & (bytes - 1)) {
+      externalInterface->trap("unaligned atomic operation");
+    }
   }
 
-  void doAtomicStore(Address addr, Index bytes, Literal toStore) {
-    Const ptr;
-    ptr.value = Literal(int32_t(addr));
-    ptr.type = i32;
-    Const value;
-    value.value = toStore;
-    value.type = toStore.type;
-    Store store;
-    store.bytes = bytes;
-    store.align = bytes;
-    store.isAtomic = true; // understatement
-    store.ptr = &ptr;
-    store.value = &value;
-    store.valueType = value.type;
-    return externalInterface->store(&store, addr, toStore);
+  void updateSharedMemorySize() {
+    if (wasm.memory.shared) {
+      memorySize = externalInterface->getSharedMemorySize(memorySize);
+    }
   }
 
   ExternalInterface* externalInterface;
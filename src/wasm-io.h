@@ -23,6 +23,7 @@
 
 #include "wasm.h"
 #include "parsing.h"
+#include "pass.h"
 #include "support/file.h"
 
 namespace wasm {
@@ -55,6 +56,8 @@ class ModuleWriter : public ModuleIO {
   std::string symbolMap;
   std::string sourceMapFilename;
   std::string sourceMapUrl;
+  bool optimizeStackIR = false;
+  PassOptions stackIROptions;
 
 public:
   void setBinary(bool binary_) { binary = binary_; }
@@ -62,6 +65,11 @@ public:
   void setSymbolMap(std::string symbolMap_) { symbolMap = symbolMap_; }
   void setSourceMapFilename(std::string sourceMapFilename_) { sourceMapFilename = sourceMapFilename_; }
   void setSourceMapUrl(std::string sourceMapUrl_) { sourceMapUrl = sourceMapUrl_; }
+  // See WasmBinaryWriter::setOptimizeStackIR.
+  void setOptimizeStackIR(const PassOptions& options) {
+    optimizeStackIR = true;
+    stackIROptions = options;
+  }
 
   // write text
   void writeText(Module& wasm, Output& output);
@@ -98,6 +98,10 @@ class StackWriter : public Visitor<StackWriter<Mode, Parent>> {
 public:
   StackWriter(Parent& parent, BufferWithRandomAccess& o, bool sourceMap=false, bool debug=false)
     : parent(parent), o(o), sourceMap(sourceMap), debug(debug), allocator(parent.getModule()->allocator) {}
+  // Allocates Stack IR (and the extra nodes it needs) in the given arena
+  // instead of the module's, for Stack IR that is not kept.
+  StackWriter(Parent& parent, BufferWithRandomAccess& o, MixedArena& allocator)
+    : parent(parent), o(o), sourceMap(false), debug(false), allocator(allocator) {}
 
   StackIR stackIR; // filled in Binaryen2Stack, read in Stack2Binary
 
@@ -211,11 +215,14 @@ public:
 template<typename Parent>
 class StackIRFunctionStackWriter : StackWriter<StackWriterMode::Stack2Binary, Parent> {
 public:
-  StackIRFunctionStackWriter(Function* funcInit, Parent& parent, BufferWithRandomAccess& o, bool debug=false) :
-    StackWriter<StackWriterMode::Stack2Binary, Parent>(parent, o, false, debug) {
+  StackIRFunctionStackWriter(Function* funcInit, Parent& parent, BufferWithRandomAccess& o, bool sourceMap=false, bool debug=false) :
+    StackIRFunctionStackWriter(funcInit, *funcInit->stackIR, parent, o, sourceMap, debug) {}
+
+  StackIRFunctionStackWriter(Function* funcInit, StackIR& stackIR, Parent& parent, BufferWithRandomAccess& o, bool sourceMap=false, bool debug=false) :
+    StackWriter<StackWriterMode::Stack2Binary, Parent>(parent, o, sourceMap, debug) {
     this->setFunction(funcInit);
     this->mapLocalsAndEmitHeader();
-    for (auto* inst : *funcInit->stackIR) {
+    for (auto* inst : stackIR) {
       if (!inst) continue; // a nullptr is just something we can skip
       switch (inst->op) {
         case StackInst::Basic:
@@ -248,6 +255,50 @@ public:
   }
 };
 
+// Optimizes Stack IR: removes unreachable code and unneeded blocks, and at
+// higher optimization levels uses values on the stack instead of locals.
+class StackIROptimizer {
+  Function* func;
+  PassOptions& passOptions;
+  StackIR& insts;
+
+public:
+  StackIROptimizer(Function* func, StackIR& insts, PassOptions& passOptions) :
+    func(func), passOptions(passOptions), insts(insts) {}
+
+  void run();
+
+private:
+  void dce();
+  void local2Stack();
+  void removeUnneededBlocks();
+
+  bool isControlFlowBarrier(StackInst* inst);
+  bool isControlFlowBegin(StackInst* inst);
+  bool isControlFlowEnd(StackInst* inst);
+  bool isControlFlow(StackInst* inst);
+  void removeAt(Index i);
+  Index getNumConsumedValues(StackInst* inst);
+};
+
+// Write out a function body with optimized Stack IR, generating it while
+// writing and not keeping it. This does the Stack IR optimizations on
+// functions that do not have Stack IR, like ones that passes modified after
+// it was generated, and avoids keeping Stack IR around until writing.
+template<typename Parent>
+class OptimizingFunctionStackWriter {
+public:
+  OptimizingFunctionStackWriter(Function* func, Parent& parent, BufferWithRandomAccess& o, PassOptions& passOptions, bool sourceMap=false, bool debug=false) {
+    MixedArena allocator;
+    BufferWithRandomAccess unused;
+    StackWriter<StackWriterMode::Binaryen2Stack, Parent> generator(parent, unused, allocator);
+    generator.setFunction(func);
+    generator.visitPossibleBlockContents(func->body);
+    StackIROptimizer(func, generator.stackIR, passOptions).run();
+    StackIRFunctionStackWriter<Parent>(func, generator.stackIR, parent, o, sourceMap, debug);
+  }
+};
+
 //
 // Implementations
 //
@@ -315,7 +366,10 @@ void StackWriter<Mode, Parent>::mapLocalsAndEmitHeader() {
 
 template<StackWriterMode Mode, typename Parent>
 void StackWriter<Mode, Parent>::visit(Expression* curr) {
-  if (Mode == StackWriterMode::Binaryen2Binary && sourceMap) {
+  // Each instruction we emit gets the location of the expression it came
+  // from. (Binaryen2Stack emits nothing, and the Stack IR it creates is
+  // written out with its origins' locations in Stack2Binary.)
+  if (Mode != StackWriterMode::Binaryen2Stack && sourceMap) {
     parent.writeDebugLocation(curr, func);
   }
   Visitor<StackWriter>::visit(curr);
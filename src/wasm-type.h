@@ -17,9 +17,13 @@
 #ifndef wasm_wasm_type_h
 #define wasm_wasm_type_h
 
+#include <cstdint>
+
 namespace wasm {
 
-enum Type {
+// Every expression has a type, so it is stored in 16 bits, which lets it
+// share a word with the expression's id.
+enum Type : uint16_t {
   none,
   i32,
   i64,
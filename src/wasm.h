@@ -152,7 +152,7 @@ enum AtomicRMWOp {
 
 class Expression {
 public:
-  enum Id {
+  enum Id : uint16_t {
     InvalidId = 0,
     BlockId,
     IfId,
@@ -182,6 +182,8 @@ public:
     AtomicWakeId,
     NumExpressionIds
   };
+  // _id and type fit in 32 bits together, so small fields in the node can
+  // fill the rest of the first word, before any pointers
   Id _id;
 
   Type type; // the type of the expression: its *output*, not necessarily its input(s)
@@ -394,10 +396,11 @@ public:
   Load() {}
   Load(MixedArena& allocator) {}
 
-  uint8_t bytes;
-  bool signed_;
+  // small fields are grouped ahead of the pointers to avoid padding
   Address offset;
   Address align;
+  uint8_t bytes;
+  bool signed_;
   bool isAtomic;
   Expression* ptr;
 
@@ -411,13 +414,14 @@ public:
   Store() : valueType(none) {}
   Store(MixedArena& allocator) : Store() {}
 
-  uint8_t bytes;
+  // small fields are grouped ahead of the pointers to avoid padding
   Address offset;
   Address align;
+  uint8_t bytes;
   bool isAtomic;
+  Type valueType; // the store never returns a value
   Expression* ptr;
   Expression* value;
-  Type valueType; // the store never returns a value
 
   void finalize();
 };
@@ -455,11 +459,12 @@ class AtomicWait : public SpecificExpression<Expression::AtomicWaitId> {
   AtomicWait() = default;
   AtomicWait(MixedArena& allocator) : AtomicWait() {}
 
+  // small fields are grouped ahead of the pointers to avoid padding
   Address offset;
+  Type expectedType;
   Expression* ptr;
   Expression* expected;
   Expression* timeout;
-  Type expectedType;
 
   void finalize();
 };
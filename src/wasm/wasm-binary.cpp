@@ -235,7 +235,7 @@ void WasmBinaryWriter::writeExpression(Expression* curr) {
 }
 
 void WasmBinaryWriter::writeFunctions() {
-  if (importInfo->getNumDefinedFunctions() == 0) return;
+  if (!codeSection || importInfo->getNumDefinedFunctions() == 0) return;
   if (debug) std::cerr << "== writeFunctions" << std::endl;
   auto start = startSection(BinaryConsts::Section::Code);
   o << U32LEB(importInfo->getNumDefinedFunctions());
@@ -245,10 +245,13 @@ void WasmBinaryWriter::writeFunctions() {
     size_t sizePos = writeU32LEBPlaceholder();
     size_t start = o.size();
     if (debug) std::cerr << "writing" << func->name << std::endl;
-    // Emit Stack IR if present, and if we can
-    if (func->stackIR && !sourceMap) {
+    // Emit Stack IR if present, or optimize it while writing if asked to
+    if (func->stackIR) {
       if (debug) std::cerr << "write Stack IR" << std::endl;
-      StackIRFunctionStackWriter<WasmBinaryWriter>(func, *this, o, debug);
+      StackIRFunctionStackWriter<WasmBinaryWriter>(func, *this, o, sourceMap, debug);
+    } else if (optimizeStackIR) {
+      if (debug) std::cerr << "write optimized Stack IR" << std::endl;
+      OptimizingFunctionStackWriter<WasmBinaryWriter>(func, *this, o, stackIROptions, sourceMap, debug);
     } else {
       if (debug) std::cerr << "write Binaryen IR" << std::endl;
       FunctionStackWriter<WasmBinaryWriter>(func, *this, o, sourceMap, debug);
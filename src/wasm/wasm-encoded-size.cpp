@@ -0,0 +1,170 @@
+/*
+ * Copyright 2019 WebAssembly Community Group participants
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wasm-encoded-size.h"
+#include "wasm-stack.h"
+#include "ir/module-utils.h"
+#include "ir/utils.h"
+#include "support/hash.h"
+#include "support/threads.h"
+
+namespace wasm {
+
+EncodedSizeOracle::EncodedSizeOracle(Module& wasm) : wasm(wasm) {
+  updateIndexes();
+}
+
+size_t EncodedSizeOracle::getBodySize(Function* func) {
+  auto hash = hashFunction(func);
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    auto iter = cache.find(func->name);
+    if (iter != cache.end() && iter->second.hash == hash) {
+      return iter->second.size;
+    }
+  }
+  BufferWithRandomAccess buffer;
+  auto size = measure(func, buffer);
+  std::lock_guard<std::mutex> lock(cacheMutex);
+  cache[func->name] = CacheEntry{hash, size};
+  return size;
+}
+
+size_t EncodedSizeOracle::getCodeSectionSize() {
+  updateIndexes();
+  std::vector<Function*> funcs;
+  ModuleUtils::iterDefinedFunctions(wasm, [&](Function* func) {
+    funcs.push_back(func);
+    // Create the entries now, so the workers do not modify the map.
+    cache.emplace(func->name, CacheEntry{0, 0});
+  });
+  if (funcs.empty()) return 0;
+  std::vector<size_t> sizes(funcs.size());
+  size_t num = ThreadPool::get()->size();
+  std::vector<std::function<ThreadWorkState ()>> doWorkers;
+  std::atomic<size_t> nextFunction;
+  nextFunction.store(0);
+  for (size_t i = 0; i < std::max(num, size_t(1)); i++) {
+    doWorkers.push_back([&]() {
+      BufferWithRandomAccess buffer;
+      while (1) {
+        auto index = nextFunction.fetch_add(1);
+        if (index >= funcs.size()) {
+          return ThreadWorkState::Finished;
+        }
+        auto* func = funcs[index];
+        auto hash = hashFunction(func);
+        auto& entry = cache.at(func->name);
+        if (entry.hash != hash || entry.size == 0) {
+          entry.hash = hash;
+          entry.size = measure(func, buffer);
+        }
+        sizes[index] = entry.size;
+      }
+    });
+  }
+  ThreadPool::get()->work(doWorkers);
+  // The section contents are the number of functions, then each body after
+  // the LEB of its size.
+  size_t size = U32LEB(funcs.size()).size();
+  for (auto bodySize : sizes) {
+    size += U32LEB(bodySize).size() + bodySize;
+  }
+  // The section id, then the LEB of the section size.
+  return 1 + U32LEB(size).size() + size;
+}
+
+size_t EncodedSizeOracle::getModuleSize() {
+  // Write everything but the code section. Note that creating the writer
+  // may add function types, so we do it first.
+  BufferWithRandomAccess buffer;
+  WasmBinaryWriter writer(&wasm, buffer);
+  writer.setCodeSection(false);
+  writer.write();
+  return buffer.size() + getCodeSectionSize();
+}
+
+void EncodedSizeOracle::updateIndexes() {
+  ModuleUtils::BinaryIndexes indexes(wasm);
+  std::unordered_map<Name, Index> newTypeIndexes;
+  for (Index i = 0; i < wasm.functionTypes.size(); i++) {
+    newTypeIndexes[wasm.functionTypes[i]->name] = i;
+  }
+  if (indexes.functionIndexes != functionIndexes ||
+      indexes.globalIndexes != globalIndexes ||
+      newTypeIndexes != typeIndexes) {
+    functionIndexes = std::move(indexes.functionIndexes);
+    globalIndexes = std::move(indexes.globalIndexes);
+    typeIndexes = std::move(newTypeIndexes);
+    cache.clear();
+  }
+}
+
+uint64_t EncodedSizeOracle::hashFunction(Function* func) {
+  // The body and the types of the locals determine what we write, except
+  // when there is Stack IR, which determines the order and which parts of
+  // the body are written.
+  uint64_t digest = ExpressionAnalyzer::hash(func->body);
+  digest = rehash(digest, uint64_t(func->params.size()));
+  for (auto type : func->params) {
+    digest = rehash(digest, uint64_t(type));
+  }
+  digest = rehash(digest, uint64_t(func->vars.size()));
+  for (auto type : func->vars) {
+    digest = rehash(digest, uint64_t(type));
+  }
+  if (func->stackIR) {
+    // Identify each origin by its position in the body.
+    struct Numberer : public PostWalker<Numberer, UnifiedExpressionVisitor<Numberer>> {
+      std::unordered_map<Expression*, uint64_t> ids;
+      void visitExpression(Expression* curr) {
+        ids[curr] = ids.size();
+      }
+    } numberer;
+    numberer.walk(func->body);
+    digest = rehash(digest, uint64_t(func->stackIR->size()));
+    for (auto* inst : *func->stackIR) {
+      if (!inst) {
+        digest = rehash(digest, uint64_t(-1));
+        continue;
+      }
+      digest = rehash(digest, uint64_t(inst->op));
+      digest = rehash(digest, uint64_t(inst->type));
+      auto iter = numberer.ids.find(inst->origin);
+      if (iter != numberer.ids.end()) {
+        digest = rehash(digest, iter->second);
+      } else {
+        // This was created when making the Stack IR, like an unreachable
+        // after a block that does not exit.
+        digest = rehash(digest, uint64_t(ExpressionAnalyzer::hash(inst->origin)));
+      }
+    }
+  }
+  return digest;
+}
+
+size_t EncodedSizeOracle::measure(Function* func, BufferWithRandomAccess& buffer) {
+  buffer.clear();
+  // Emit Stack IR if present, like WasmBinaryWriter.
+  if (func->stackIR) {
+    StackIRFunctionStackWriter<EncodedSizeOracle>(func, *this, buffer);
+  } else {
+    FunctionStackWriter<EncodedSizeOracle>(func, *this, buffer);
+  }
+  return buffer.size();
+}
+
+} // namespace wasm
@@ -100,6 +100,7 @@ void ModuleWriter::writeBinary(Module& wasm, Output& output) {
     writer.setSourceMap(sourceMapStream.get(), sourceMapUrl);
   }
   if (symbolMap.size() > 0) writer.setSymbolMap(symbolMap);
+  if (optimizeStackIR) writer.setOptimizeStackIR(stackIROptions);
   writer.write();
   buffer.writeTo(output);
   if (sourceMapStream) {
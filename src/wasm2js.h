@@ -23,6 +23,7 @@
 #define wasm_wasm2js_h
 
 #include <cmath>
+#include <limits>
 #include <numeric>
 
 #include "asmjs/shared-constants.h"
@@ -142,7 +143,9 @@ public:
     bool allowAsserts = false;
   };
 
-  Wasm2JSBuilder(Flags f) : flags(f) {}
+  // The optimize and shrink levels in the options determine how much we
+  // optimize the code after lowering it to what JS can express.
+  Wasm2JSBuilder(Flags f, PassOptions options = PassOptions()) : flags(f), options(options) {}
 
   Ref processWasm(Module* wasm, Name funcName = ASM_FUNC);
   Ref processFunction(Module* wasm, Function* func);
@@ -238,6 +241,18 @@ public:
     return ret;
   }
 
+  // Forgets the names of locals and labels, which are only visible inside the
+  // functions of a module, so that a later module (when there are several, as
+  // in tests) can use them at the top level.
+  void clearFunctionScopeNames() {
+    for (auto scope : { NameScope::Local, NameScope::Label }) {
+      for (auto& pair : mangledNames[(int) scope]) {
+        allMangledNames.erase(pair.second);
+      }
+      mangledNames[(int) scope].clear();
+    }
+  }
+
   void setStatement(Expression* curr) {
     willBeStatement.insert(curr);
   }
@@ -252,6 +267,7 @@ public:
 
 private:
   Flags flags;
+  PassOptions options;
 
   // How many temp vars we need
   std::vector<size_t> temps; // type => num temps
@@ -280,6 +296,7 @@ private:
   void addGlobal(Ref ast, Global* global);
   void setNeedsAlmostASM(const char *reason);
   void addMemoryGrowthFuncs(Ref ast);
+  void optimizeJS(Ref ast);
   bool isAssertHandled(Element& e);
   Ref makeAssertReturnFunc(SExpressionWasmBuilder& sexpBuilder,
                            Module* wasm,
@@ -305,21 +322,42 @@ private:
 };
 
 Ref Wasm2JSBuilder::processWasm(Module* wasm, Name funcName) {
-  PassRunner runner(wasm);
+  PassRunner runner(wasm, options);
   runner.add<AutoDrop>();
   // First up remove as many non-JS operations we can, including things like
   // 64-bit integer multiplication/division, `f32.nearest` instructions, etc.
   // This may inject intrinsics which use i64 so it needs to be run before the
   // i64-to-i32 lowering pass.
   runner.add("remove-non-js-ops");
-  // Currently the i64-to-32 lowering pass requires that `flatten` be run before
-  // it produce correct code. For some more details about this see #1480
-  runner.add("flatten");
   runner.add("i64-to-i32-lowering");
+  // Next, optimize the lowered code like any other wasm. None of the
+  // optimizations add operations JS cannot express.
+  if (options.optimizeLevel > 0) {
+    // Constants are especially worth propagating after the lowering. That
+    // finds the most on flat code, which is slow to optimize, so only do it
+    // when asked to.
+    if (options.optimizeLevel >= 3 || options.shrinkLevel >= 1) {
+      runner.add("flatten");
+      runner.add("simplify-locals-nonesting");
+      runner.add("precompute-propagate");
+    }
+    runner.addDefaultOptimizationPasses();
+  }
+  // Finally, get the code into the flat form that we translate, and undo
+  // some of the effects of flattening without losing that form.
   runner.add("flatten");
   runner.add("simplify-locals-notee-nostructure");
+  if (options.optimizeLevel > 0) {
+    runner.add("remove-unused-names");
+    runner.add("merge-blocks");
+    runner.add("reorder-locals");
+    runner.add("coalesce-locals");
+  }
   runner.add("reorder-locals");
   runner.add("vacuum");
+  if (options.optimizeLevel > 0) {
+    runner.add("remove-unused-module-elements");
+  }
   runner.setDebug(flags.debug);
   runner.run();
 
@@ -404,6 +442,9 @@ Ref Wasm2JSBuilder::processWasm(Module* wasm, Name funcName) {
   addTables(asmFunc[3], wasm);
   // memory XXX
   addExports(asmFunc[3], wasm);
+  if (options.optimizeLevel > 0) {
+    optimizeJS(ret);
+  }
   return ret;
 }
 
@@ -2242,6 +2283,104 @@ Ref Wasm2JSBuilder::makeAssertTrapFunc(SExpressionWasmBuilder& sexpBuilder,
   return outerFunc;
 }
 
+// Cleans up redundant code in the JS, that we emit because we translate each
+// wasm expression by itself: double coercions, coercions of integer
+// constants, and assignments of a variable to itself. All of these keep the
+// code valid asm.js.
+void Wasm2JSBuilder::optimizeJS(Ref ast) {
+  // Note the slots of all the nodes, parents before children. Visiting them
+  // in reverse then visits children first, and lets us replace a node by
+  // writing to its slot. Assignments are not arrays, so we look inside them
+  // ourselves.
+  std::vector<Ref*> slots;
+  std::vector<Ref*> work;
+  work.push_back(&ast);
+  while (!work.empty()) {
+    auto* slot = work.back();
+    work.pop_back();
+    Ref node = *slot;
+    if (!node) continue;
+    if (node->isAssign()) {
+      work.push_back(&node->asAssign()->target());
+      work.push_back(&node->asAssign()->value());
+    } else if (node->isAssignName()) {
+      work.push_back(&node->asAssignName()->value());
+    } else if (node->isArray()) {
+      // Nodes start with their type; other arrays are lists of nodes.
+      if (node->size() > 0 && !!node[0] && node[0]->isString()) {
+        slots.push_back(slot);
+      }
+      for (auto& child : node->getArray()) {
+        work.push_back(&child);
+      }
+    }
+  }
+  auto isOrZero = [](Ref node) {
+    return node[1] == OR && node[3]->isNumber() && node[3]->getNumber() == 0;
+  };
+  auto isSignedInteger = [](Ref node) {
+    if (node->isNumber()) {
+      auto num = node->getNumber();
+      return num >= 0 && num <= double(std::numeric_limits<int32_t>::max()) &&
+             std::floor(num) == num;
+    }
+    // The result of a bitwise operation is already a signed integer.
+    return node->isArray() && node->size() == 4 && node[0] == BINARY &&
+           (node[1] == OR || node[1] == AND || node[1] == XOR ||
+            node[1] == LSHIFT || node[1] == RSHIFT);
+  };
+  auto isSelfAssign = [](Ref node) {
+    if (!node->isAssignName()) return false;
+    auto* assign = node->asAssignName();
+    return assign->value()->isString() &&
+           assign->value()->getIString() == assign->target();
+  };
+  // Statements are also plain nodes in blocks and function bodies.
+  auto removeSelfAssigns = [&](Ref list) {
+    auto& array = list->getArray();
+    size_t skip = 0;
+    for (size_t i = 0; i < array.size(); i++) {
+      if (isSelfAssign(array[i])) {
+        skip++;
+      } else {
+        array[i - skip] = array[i];
+      }
+    }
+    array.resize(array.size() - skip);
+  };
+  for (auto iter = slots.rbegin(); iter != slots.rend(); ++iter) {
+    Ref& node = **iter;
+    // Lists of names (like parameters) look like nodes too, so check the
+    // shape of each node before looking inside it.
+    auto size = node->size();
+    if (node[0] == BINARY && size == 4) {
+      // (x | 0) | 0 => x | 0, and 1 | 0 => 1
+      if (isOrZero(node) && isSignedInteger(node[2])) {
+        node = node[2];
+      }
+    } else if (node[0] == UNARY_PREFIX && size == 3) {
+      // +(+x) => +x
+      if (node[1] == PLUS && node[2]->isArray() && node[2]->size() == 3 &&
+          node[2][0] == UNARY_PREFIX && node[2][1] == PLUS) {
+        node = node[2];
+      }
+    } else if (node[0] == CALL && size == 3 && node[2]->isArray()) {
+      // Math_fround(Math_fround(x)) => Math_fround(x)
+      if (node[1] == MATH_FROUND && node[2]->size() == 1) {
+        Ref arg = node[2][0];
+        if (arg->isArray() && arg->size() == 3 && arg[0] == CALL &&
+            arg[1] == MATH_FROUND) {
+          node = arg;
+        }
+      }
+    } else if (node[0] == BLOCK && size == 2 && node[1]->isArray()) {
+      removeSelfAssigns(node[1]);
+    } else if (node[0] == DEFUN && size == 4 && node[3]->isArray()) {
+      removeSelfAssigns(node[3]);
+    }
+  }
+}
+
 void Wasm2JSBuilder::setNeedsAlmostASM(const char *reason) {
   if (!almostASM) {
     almostASM = true;
@@ -2429,6 +2568,7 @@ Ref Wasm2JSBuilder::processAsserts(Module* wasm,
       asmModule = Name(moduleNameS.str().c_str());
       Module wasm;
       SExpressionWasmBuilder builder(wasm, e);
+      clearFunctionScopeNames();
       flattenAppend(ret, processWasm(&wasm, funcName));
       makeHelpers(ret, funcName, asmModule, false);
       continue;
@@ -0,0 +1,253 @@
+// test the dense bitsets and the bitset dataflow solver, against the sparse
+// liveness flow and a simple fixed point
+
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <string>
+
+#include <wasm.h>
+#include <wasm-builder.h>
+#include <wasm-s-parser.h>
+#include <cfg/liveness-traversal.h>
+#include <support/dense_bitset.h>
+
+using namespace wasm;
+
+static const char* moduleText = R"(
+(module
+  (func $straight (param $x i32) (result i32)
+    (local $y i32)
+    (set_local $y (i32.add (get_local $x) (i32.const 1)))
+    (get_local $y)
+  )
+  (func $diamond (param $x i32) (param $y i32) (result i32)
+    (local $z i32)
+    (if (get_local $x)
+      (set_local $z (get_local $y))
+      (set_local $y (i32.const 2))
+    )
+    (i32.add (get_local $y) (get_local $z))
+  )
+  (func $loop (param $n i32) (result i32)
+    (local $i i32)
+    (local $sum i32)
+    (local $unused i32)
+    (loop $top
+      (set_local $sum (i32.add (get_local $sum) (get_local $i)))
+      (set_local $i (i32.add (get_local $i) (i32.const 1)))
+      (br_if $top (i32.lt_u (get_local $i) (get_local $n)))
+    )
+    (get_local $sum)
+  )
+  (func $nested-loops (param $n i32) (result i32)
+    (local $i i32)
+    (local $j i32)
+    (local $t i32)
+    (loop $outer
+      (set_local $j (i32.const 0))
+      (loop $inner
+        (set_local $t (i32.add (get_local $t) (get_local $j)))
+        (set_local $j (i32.add (get_local $j) (i32.const 1)))
+        (br_if $inner (i32.lt_u (get_local $j) (get_local $i)))
+      )
+      (set_local $i (i32.add (get_local $i) (i32.const 1)))
+      (br_if $outer (i32.lt_u (get_local $i) (get_local $n)))
+    )
+    (get_local $t)
+  )
+  (func $switch (param $x i32) (result i32)
+    (local $a i32)
+    (local $b i32)
+    (block $2
+      (block $1
+        (block $0
+          (br_table $0 $1 $2 (get_local $x))
+        )
+        (set_local $a (i32.const 1))
+        (br $2)
+      )
+      (set_local $b (get_local $a))
+    )
+    (i32.add (get_local $a) (get_local $b))
+  )
+  (func $unreachable (param $x i32) (result i32)
+    (local $y i32)
+    (if (get_local $x)
+      (block
+        (set_local $y (i32.const 1))
+        (return (get_local $y))
+      )
+    )
+    (unreachable)
+  )
+)
+)";
+
+// A function with many locals (more than fit in a word) and a loop full of
+// branches, built from a simple pseudo-random sequence.
+static Function* makeBigFunction(Module& wasm) {
+  Builder builder(wasm);
+  const Index numLocals = 150;
+  std::vector<Type> params = { i32 };
+  std::vector<Type> vars(numLocals - 1, i32);
+  uint32_t state = 12345;
+  auto next = [&](Index limit) {
+    state = state * 1103515245 + 12345;
+    return Index((state >> 16) % limit);
+  };
+  auto* body = builder.makeBlock();
+  for (Index i = 0; i < 40; i++) {
+    auto kind = next(3);
+    auto* arm = builder.makeBlock();
+    if (kind == 1) {
+      arm->name = Name(std::string("skip") + std::to_string(i));
+    }
+    for (Index j = 0; j < 4; j++) {
+      if (kind == 1 && j == 2) {
+        arm->list.push_back(builder.makeBreak(arm->name, nullptr,
+                                              builder.makeGetLocal(next(numLocals), i32)));
+      }
+      arm->list.push_back(builder.makeSetLocal(next(numLocals),
+        builder.makeBinary(AddInt32, builder.makeGetLocal(next(numLocals), i32),
+                                     builder.makeGetLocal(next(numLocals), i32))));
+    }
+    arm->finalize();
+    if (kind == 0) {
+      body->list.push_back(builder.makeIf(builder.makeGetLocal(next(numLocals), i32), arm));
+    } else if (kind == 1) {
+      body->list.push_back(arm);
+    } else {
+      body->list.push_back(arm);
+      body->list.push_back(builder.makeBreak("top", nullptr,
+                                             builder.makeGetLocal(next(numLocals), i32)));
+    }
+  }
+  body->finalize();
+  auto* loop = builder.makeLoop("top", body);
+  auto* func = builder.makeFunction("big", std::move(params), none, std::move(vars),
+    builder.makeBlock(loop));
+  wasm.addFunction(func);
+  return func;
+}
+
+struct DataflowChecker : public LivenessWalker<DataflowChecker, Visitor<DataflowChecker>> {
+  void doWalkFunction(Function* func) {
+    // this flows with dense bitsets, as our functions are small
+    LivenessWalker<DataflowChecker, Visitor<DataflowChecker>>::doWalkFunction(func);
+    std::vector<BasicBlock*> blocks;
+    for (auto& block : basicBlocks) {
+      if (liveBlocks.count(block.get())) {
+        blocks.push_back(block.get());
+      }
+    }
+    std::cout << "func " << func->name << ": " << blocks.size() << " blocks, "
+              << numLocals << " locals\n";
+    checkLiveness(blocks);
+    checkForward(blocks);
+  }
+
+  // flows the sparse sets as well, and checks that they agree
+  void checkLiveness(std::vector<BasicBlock*>& blocks) {
+    std::vector<LocalSet> denseStarts, denseEnds;
+    size_t numLive = 0;
+    for (auto* block : blocks) {
+      denseStarts.push_back(block->contents.start);
+      denseEnds.push_back(block->contents.end);
+      numLive += block->contents.start.size();
+      block->contents.start.clear();
+      block->contents.end.clear();
+    }
+    flowLivenessSparse();
+    for (Index i = 0; i < blocks.size(); i++) {
+      assert(blocks[i]->contents.start == denseStarts[i]);
+      assert(blocks[i]->contents.end == denseEnds[i]);
+    }
+    std::cout << "  liveness: dense and sparse agree (" << numLive << " live at block starts)\n";
+  }
+
+  // solves a forward problem, which locals may have been written on the way
+  // to each block, and checks it against a simple fixed point
+  void checkForward(std::vector<BasicBlock*>& blocks) {
+    BitsetDataflow<BasicBlock> flow(blocks, numLocals);
+    std::vector<std::set<Index>> written(blocks.size());
+    for (Index i = 0; i < blocks.size(); i++) {
+      for (auto& action : blocks[i]->contents.actions) {
+        if (action.isSet()) {
+          flow.gen[i].insert(action.index);
+          written[i].insert(action.index);
+        }
+      }
+    }
+    flow.solve(entry, BitsetDataflow<BasicBlock>::Forward);
+    std::vector<std::set<Index>> starts(blocks.size()), ends(blocks.size());
+    bool changed = true;
+    while (changed) {
+      changed = false;
+      for (Index i = 0; i < blocks.size(); i++) {
+        for (auto* pred : blocks[i]->in) {
+          auto& predEnd = ends[flow.getIndex(pred)];
+          starts[i].insert(predEnd.begin(), predEnd.end());
+        }
+        auto end = starts[i];
+        end.insert(written[i].begin(), written[i].end());
+        if (end != ends[i]) {
+          ends[i] = end;
+          changed = true;
+        }
+      }
+    }
+    size_t numWritten = 0;
+    for (Index i = 0; i < blocks.size(); i++) {
+      std::set<Index> start, end;
+      flow.start[i].forEach([&](Index index) { start.insert(index); });
+      flow.end[i].forEach([&](Index index) { end.insert(index); });
+      assert(start == starts[i]);
+      assert(end == ends[i]);
+      numWritten += end.size();
+    }
+    std::cout << "  forward: matches the fixed point (" << numWritten << " written at block ends)\n";
+  }
+};
+
+static void testDenseBitset() {
+  DenseBitset a(130), b(130), gen(130), kill(130);
+  a.insert(0);
+  a.insert(64);
+  a.insert(129);
+  assert(a.has(64) && !a.has(63) && !a.empty());
+  b.insert(1);
+  b.insert(64);
+  assert(b.merge(a));
+  assert(!b.merge(a));
+  std::vector<Index> elements;
+  b.forEach([&](Index x) { elements.push_back(x); });
+  assert((elements == std::vector<Index>{ 0, 1, 64, 129 }));
+  // out = gen | (in & ~kill)
+  gen.insert(100);
+  kill.insert(64);
+  kill.insert(100);
+  DenseBitset out(130);
+  assert(out.transfer(gen, b, kill));
+  assert(!out.transfer(gen, b, kill));
+  elements.clear();
+  out.forEach([&](Index x) { elements.push_back(x); });
+  assert((elements == std::vector<Index>{ 0, 1, 100, 129 }));
+  b.erase(129);
+  assert(!b.has(129) && b != a);
+  assert(DenseBitset::numWords(64) == 1 && DenseBitset::numWords(65) == 2);
+  std::cout << "dense bitsets ok\n";
+}
+
+int main() {
+  testDenseBitset();
+  Module wasm;
+  std::string text = moduleText;
+  SExpressionParser parser(const_cast<char*>(text.c_str()));
+  SExpressionWasmBuilder builder(wasm, *(*parser.root)[0]);
+  makeBigFunction(wasm);
+  for (auto& func : wasm.functions) {
+    DataflowChecker checker;
+    checker.walkFunctionInModule(func.get(), &wasm);
+  }
+}
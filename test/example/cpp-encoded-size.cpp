@@ -0,0 +1,145 @@
+// test that the encoded size oracle agrees with the size of the binary that
+// WasmBinaryWriter writes, before and after optimizing with Stack IR
+
+#include <cassert>
+#include <iostream>
+#include <string>
+
+#include <wasm.h>
+#include <wasm-binary.h>
+#include <wasm-builder.h>
+#include <wasm-encoded-size.h>
+#include <wasm-s-parser.h>
+#include <pass.h>
+
+using namespace wasm;
+
+static const char* moduleText = R"(
+(module
+  (type $ii (func (param i32) (result i32)))
+  (import "env" "log" (func $log (param i32)))
+  (import "env" "base" (global $base i32))
+  (global $counter (mut i32) (i32.const 0))
+  (memory $0 1 1)
+  (data (i32.const 16) "hello, world")
+  (table 2 2 anyfunc)
+  (elem (i32.const 0) $load $store)
+  (export "store" (func $store))
+  (func $load (type $ii) (param $x i32) (result i32)
+    (i32.add
+      (i32.load offset=4 (get_local $x))
+      (i32.load8_s offset=1000 align=1 (get_local $x))
+    )
+  )
+  (func $store (type $ii) (param $x i32) (result i32)
+    (local $y i64)
+    (local $z f64)
+    (i64.store offset=70000 (get_local $x) (i64.const -1234567890123))
+    (set_local $z (f64.const 3.14159))
+    (f64.store (get_local $x) (get_local $z))
+    (set_global $counter (i32.add (get_global $counter) (get_global $base)))
+    (call $log (get_local $x))
+    (call_indirect (type $ii) (get_local $x) (i32.const 0))
+  )
+  (func $control (param $x i32) (result i32)
+    (block $out
+      (block $a
+        (block $b
+          (br_table $a $b $out (get_local $x))
+        )
+        (loop $top
+          (br_if $top (i32.eqz (get_local $x)))
+        )
+        (return (i32.const 1))
+      )
+      (if (get_local $x)
+        (drop (call $load (get_local $x)))
+        (unreachable)
+      )
+    )
+    (i32.const 0)
+  )
+)
+)";
+
+static size_t writtenSize(Module& wasm) {
+  BufferWithRandomAccess buffer;
+  WasmBinaryWriter writer(&wasm, buffer);
+  writer.write();
+  return buffer.size();
+}
+
+static void check(Module& wasm, const char* what) {
+  EncodedSizeOracle oracle(wasm);
+  size_t expected = writtenSize(wasm);
+  size_t size = oracle.getModuleSize();
+  assert(size == expected);
+  // asking again uses the cached bodies
+  assert(oracle.getModuleSize() == expected);
+  std::cout << what << ": oracle and writer agree (" << size << " bytes)\n";
+}
+
+// Adds enough functions that calls to the last ones need two bytes for the
+// index, and sizes of the bodies need more than one.
+static void addManyFunctions(Module& wasm) {
+  Builder builder(wasm);
+  for (Index i = 0; i < 200; i++) {
+    auto* body = builder.makeBlock();
+    for (Index j = 0; j < 30; j++) {
+      body->list.push_back(builder.makeSetLocal(0,
+        builder.makeBinary(MulInt32, builder.makeGetLocal(0, i32),
+                                     builder.makeConst(Literal(int32_t(i * 1000 + j))))));
+    }
+    if (i > 0) {
+      auto* call = builder.makeCall(Name(std::string("f") + std::to_string(i - 1)),
+                                    { builder.makeGetLocal(0, i32) }, i32);
+      body->list.push_back(builder.makeDrop(call));
+    }
+    body->list.push_back(builder.makeGetLocal(0, i32));
+    body->finalize();
+    std::vector<Type> params = { i32 }, vars;
+    wasm.addFunction(builder.makeFunction(Name(std::string("f") + std::to_string(i)),
+                                          std::move(params), i32, std::move(vars), body));
+  }
+  auto* export_ = new Export;
+  export_->name = export_->value = "f199";
+  export_->kind = ExternalKind::Function;
+  wasm.addExport(export_);
+}
+
+int main() {
+  Module wasm;
+  std::string text = moduleText;
+  SExpressionParser parser(const_cast<char*>(text.c_str()));
+  SExpressionWasmBuilder builder(wasm, *(*parser.root)[0]);
+  check(wasm, "small module");
+
+  addManyFunctions(wasm);
+  check(wasm, "many functions");
+
+  // a function that changes after it was measured is measured again
+  {
+    EncodedSizeOracle oracle(wasm);
+    size_t before = oracle.getModuleSize();
+    auto* func = wasm.getFunction("f100");
+    auto* body = func->body->cast<Block>();
+    body->list[0] = Builder(wasm).makeNop();
+    size_t after = oracle.getModuleSize();
+    assert(after < before);
+    assert(after == writtenSize(wasm));
+    std::cout << "after a change: oracle and writer agree (" << after << " bytes)\n";
+  }
+
+  PassRunner runner(&wasm);
+  runner.options.optimizeLevel = 3;
+  runner.addDefaultOptimizationPasses();
+  runner.run();
+  bool hasStackIR = false;
+  for (auto& func : wasm.functions) {
+    if (func->stackIR) {
+      hasStackIR = true;
+    }
+  }
+  assert(hasStackIR);
+  check(wasm, "after -O3, with Stack IR");
+}
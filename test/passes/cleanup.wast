@@ -0,0 +1,103 @@
+(module
+  (memory 256 256)
+  (type $0 (func (param i32) (result i32)))
+  (type $1 (func))
+  (func $unused-names (type $0) (param $x i32) (result i32)
+    (block $topmost (result i32)
+      (nop)
+      (i32.const 0)
+    )
+  )
+  (func $names-after-vacuum (type $1)
+    (block $out
+      (block $in
+        (drop
+          (i32.const 1)
+        )
+        (br_if $out
+          (i32.const 2)
+        )
+      )
+    )
+    (block $unused
+      (nop)
+      (call $names-after-vacuum)
+    )
+  )
+  (func $loops (type $1)
+    (loop $in
+      (call $loops)
+    )
+    (loop $in2
+      (nop)
+    )
+    (loop $in3
+      (br_if $in3
+        (i32.const 1)
+      )
+    )
+    (block $out
+      (loop $in4
+        (br_if $out
+          (i32.const 1)
+        )
+        (br $in4)
+      )
+    )
+  )
+  (func $merges (type $1)
+    (block $a
+      (block $b
+        (call $merges)
+        (br_if $a
+          (i32.const 1)
+        )
+        (call $merges)
+        (br $b)
+      )
+    )
+    (block $c
+      (block $d
+        (call $merges)
+        (br_table $c $d
+          (i32.const 3)
+        )
+      )
+    )
+    (block $e
+      (block $f
+        (call $merges)
+        (drop
+          (i32.const 4)
+        )
+        (br_if $e
+          (i32.const 5)
+        )
+        (br_if $f
+          (i32.const 6)
+        )
+      )
+    )
+  )
+  (func $br_table_unreachable (result i32)
+    (block $a (result i32)
+      (block $b (result i32)
+        (br_table $a $b
+          (unreachable)
+          (unreachable)
+        )
+      )
+    )
+  )
+  (func $drop-block (type $0) (param $x i32) (result i32)
+    (drop
+      (block $unused (result i32)
+        (set_local $x
+          (i32.const 7)
+        )
+        (i32.const 8)
+      )
+    )
+    (get_local $x)
+  )
+)
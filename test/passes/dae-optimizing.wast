@@ -0,0 +1,24 @@
+(module
+  (global $global (mut i32) (i32.const 0))
+  (func $returns-flag (param $x i32) (result i32)
+    (set_global $global (get_local $x))
+    (i32.const 1)
+  )
+  (func $caller (param $x i32) (result i32)
+    (i32.add
+      (call $returns-flag (get_local $x))
+      (i32.const 10)
+    )
+  )
+  (func $computes (param $x i32) (result i32)
+    (set_global $global (i32.const 2))
+    (i32.mul (get_local $x) (get_local $x))
+  )
+  (func $wrapper (param $x i32) (result i32)
+    (call $computes (get_local $x))
+  )
+  (func $wrapper-caller (param $x i32)
+    (drop (call $wrapper (get_local $x)))
+    (drop (call $wrapper (i32.const 5)))
+  )
+)
@@ -83,5 +83,59 @@
     (call $a12 (i32.const 1))
     (call $a12 (i32.const 2))
   )
+  (func $r1 (result i32) ;; result always dropped
+    (if (i32.const 0)
+      (return (i32.const 1))
+    )
+    (i32.const 2)
+  )
+  (func $r1-caller
+    (drop (call $r1))
+    (drop (call $r1))
+  )
+  (func $r2 (result i32) ;; result used, and different values
+    (if (i32.const 0)
+      (return (i32.const 1))
+    )
+    (i32.const 2)
+  )
+  (func $r2-caller (result i32)
+    (drop (call $r2))
+    (call $r2)
+  )
+  (func $r3 (param $x i32) (result i32) ;; always the same constant
+    (if (get_local $x)
+      (return (i32.const 7))
+    )
+    (i32.const 7)
+  )
+  (func $r3-caller (result i32)
+    (i32.add
+      (call $r3 (i32.const 0))
+      (call $r3 (i32.const 1))
+    )
+  )
+  (func $r4 (result i32) ;; exported, do not optimize
+    (i32.const 7)
+  )
+  (func $r4-caller (result i32)
+    (call $r4)
+  )
+  (func $r5 (result i32) ;; the dropped call is in return position
+    (call $r1)
+  )
+  (func $r5-caller
+    (drop (call $r5))
+  )
+  (func $r6 (param $x i32) (param $y i32) ;; unused params
+    (nop)
+  )
+  (func $r7 (result i32) ;; always the same constant
+    (i32.const 7)
+  )
+  (func $r6-caller (param $z i32)
+    ;; removing the first param moves the call to $r7
+    (call $r6 (get_local $z) (call $r7))
+  )
+  (export "r4" (func $r4))
 )
-
@@ -0,0 +1,34 @@
+(module
+  (func $small (result i32)
+    (local $x i32)
+    (set_local $x
+      (i32.const 1)
+    )
+    (i32.add
+      (get_local $x)
+      (i32.const 2)
+    )
+  )
+  (func $large (result i32)
+    (local $x i32)
+    (set_local $x
+      (i32.const 1)
+    )
+    (drop
+      (i32.add
+        (i32.const 3)
+        (i32.const 4)
+      )
+    )
+    (drop
+      (i32.mul
+        (i32.const 5)
+        (i32.const 6)
+      )
+    )
+    (i32.add
+      (get_local $x)
+      (i32.const 2)
+    )
+  )
+)
@@ -68,3 +68,86 @@
  )
 )
 
+(module
+  (type $ii (func (param i32) (result i32)))
+  (type $fi (func (param f32) (result i32)))
+  (table 2 2 anyfunc)
+  (elem (i32.const 0) $match $other)
+  (func $match (param $x i32) (result i32)
+    (get_local $x)
+  )
+  (func $other (param $x f32) (result i32)
+    (i32.const 0)
+  )
+  (func $caller (param $x i32) (result i32)
+    (drop ;; known target with the right signature: a direct call
+      (call_indirect (type $ii)
+        (i32.const 1)
+        (i32.const 0)
+      )
+    )
+    (drop ;; known target with the wrong signature: a direct call to the thunk
+      (call_indirect (type $ii)
+        (i32.const 2)
+        (i32.const 1)
+      )
+    )
+    (call_indirect (type $fi) ;; unknown target
+      (f32.const 3)
+      (get_local $x)
+    )
+  )
+)
+(module
+  (type $ii (func (param i32) (result i32)))
+  (table 2 2 anyfunc)
+  (elem (i32.const 0) $a $b)
+  (func $a (param $x i32) (result i32)
+    (get_local $x)
+  )
+  (func $b (param $x i32) (result i32)
+    ;; all signatures match, so nothing needs to be emulated
+    (call_indirect (type $ii)
+      (get_local $x)
+      (get_local $x)
+    )
+  )
+)
+(module
+  (type $ii (func (param i32) (result i32)))
+  (table 2 2 anyfunc)
+  (elem (i32.const 0) $a $b)
+  (export "table" (table 0))
+  (func $a (param $x i32) (result i32)
+    (get_local $x)
+  )
+  (func $b (param $x i32) (result i32)
+    ;; the table is exported, so its contents are not known
+    (call_indirect (type $ii)
+      (get_local $x)
+      (i32.const 0)
+    )
+  )
+)
+(module
+ (type $0 (func (param i64)))
+ (type $1 (func (param f32) (result i64)))
+ (global $global$0 (mut i32) (i32.const 10))
+ (import "env" "table" (table 42 42 anyfunc))
+ (export "func_106" (func $0))
+ (func $0 (; 0 ;) (type $1) (param $0 f32) (result i64)
+  (block $label$1 (result i64)
+   (loop $label$2
+    (set_global $global$0
+     (i32.const 0)
+    )
+    (call_indirect (type $0) ;; unreachable operand, with an unknown table
+     (br $label$1
+      (i64.const 4294967295)
+     )
+     (i32.const 18)
+    )
+   )
+  )
+ )
+)
@@ -0,0 +1,98 @@
+(module
+  (type $0 (func))
+  (type $1 (func (result i32)))
+  (import "env" "import" (func $import))
+  (memory $0 1)
+  (global $global (mut i32) (i32.const 0))
+  (func $reads-memory (result i32)
+    (i32.load (i32.const 8))
+  )
+  (func $reads-global (result i32)
+    (get_global $global)
+  )
+  (func $writes-global
+    (set_global $global (i32.const 1))
+  )
+  (func $pure (result i32)
+    (local $x i32)
+    (set_local $x (i32.const 10))
+    (return (i32.add (get_local $x) (i32.const 1)))
+  )
+  (func $calls-pure (result i32)
+    (call $pure)
+  )
+  (func $calls-import (result i32)
+    (call $import)
+    (i32.const 0)
+  )
+  (func $traps (result i32)
+    (unreachable)
+  )
+  (func $loops (result i32)
+    (loop $l
+      (br_if $l (i32.const 1))
+    )
+    (i32.const 0)
+  )
+  (func $recursive (result i32)
+    (call $recursive)
+  )
+  (func $mutual-a (result i32)
+    (call $mutual-b)
+  )
+  (func $mutual-b (result i32)
+    (call $mutual-a)
+  )
+  (func $hoist-memory-read (param $p i32)
+    (local $x i32)
+    ;; the call only reads memory, and nothing in the loop writes it
+    (loop $l
+      (set_local $x (call $reads-memory))
+      (br_if $l (get_local $p))
+    )
+  )
+  (func $no-hoist-memory-read-with-store (param $p i32)
+    (local $x i32)
+    (loop $l
+      (set_local $x (call $reads-memory))
+      (i32.store (i32.const 8) (get_local $x))
+      (br_if $l (get_local $p))
+    )
+  )
+  (func $no-hoist-global-read-with-write (param $p i32)
+    (local $x i32)
+    (loop $l
+      (set_local $x (call $reads-global))
+      (call $writes-global)
+      (br_if $l (get_local $p))
+    )
+  )
+  (func $hoist-pure-across-global-write (param $p i32)
+    (local $x i32)
+    (loop $l
+      (set_local $x (call $calls-pure))
+      (call $writes-global)
+      (br_if $l (get_local $p))
+    )
+  )
+  (func $no-hoist-import-call (param $p i32)
+    (local $x i32)
+    (loop $l
+      (set_local $x (call $calls-import))
+      (br_if $l (get_local $p))
+    )
+  )
+  (func $drop-pure-calls
+    (drop (call $pure))
+    (drop (call $calls-pure))
+    (drop (call $reads-global))
+    ;; these remain
+    (drop (call $reads-memory)) ;; the load may trap
+    (drop (call $calls-import))
+    (drop (call $traps))
+    (drop (call $loops))
+    (drop (call $recursive))
+    (drop (call $mutual-a))
+    (call $writes-global)
+  )
+)
@@ -0,0 +1,10 @@
+(module
+  (func $f (result i32)
+    (i32.const 1)
+  )
+  (func $g
+    ;; $f has no effects, but log-execution makes it call an import, so
+    ;; this must not be removed
+    (drop (call $f))
+  )
+)
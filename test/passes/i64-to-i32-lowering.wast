@@ -3,5 +3,25 @@
   (func $defined (result i64)
     (i64.add (i64.const 1) (i64.const 2))
   )
+  (func $nested (param $x i64) (param $y i64) (result i64)
+    ;; the temps of the right side must not be reused for the left side
+    (i64.add
+      (get_local $x)
+      (i64.add
+        (get_local $y)
+        (i64.extend_u/i32 (i32.wrap/i64 (get_local $y)))
+      )
+    )
+  )
+  (func $select (param $x i64) (param $y i64) (param $c i32) (result i64)
+    (select (get_local $x) (get_local $y) (get_local $c))
+  )
+  (func $br-if-value (param $x i64) (param $c i32) (result i64)
+    (block $b (result i64)
+      (i64.add
+        (br_if $b (get_local $x) (get_local $c))
+        (i64.const 1)
+      )
+    )
+  )
 )
-
@@ -0,0 +1,32 @@
+(module
+  (import "env" "imported" (func $imported (param i32)))
+  (memory 1)
+  (func $a1 (param $x i32) (result i32)
+    (i32.store (i32.const 16) (i32.add (get_local $x) (i32.const 1)))
+    (i32.store (i32.const 20) (i32.mul (get_local $x) (i32.const 3)))
+    (i32.load (i32.const 24))
+  )
+  (func $b1 (param $x f64) (result f64)
+    (f64.add (f64.mul (get_local $x) (f64.const 1.5)) (f64.sqrt (get_local $x)))
+  )
+  (func $a2 (param $x i32) (result i32)
+    (i32.store (i32.const 16) (i32.add (get_local $x) (i32.const 1)))
+    (i32.store (i32.const 20) (i32.mul (get_local $x) (i32.const 3)))
+    (i32.load (i32.const 28))
+  )
+  (func $b2 (param $x f64) (result f64)
+    (f64.add (f64.mul (get_local $x) (f64.const 1.5)) (f64.sqrt (get_local $x)))
+  )
+  (func $a3 (param $x i32) (result i32)
+    (i32.store (i32.const 16) (i32.add (get_local $x) (i32.const 1)))
+    (i32.store (i32.const 20) (i32.mul (get_local $x) (i32.const 3)))
+    (call $imported (get_local $x))
+    (i32.load (i32.const 24))
+  )
+  (func $c (param $x i64) (result i64)
+    (i64.rotl (i64.xor (get_local $x) (i64.const 123456789)) (i64.const 7))
+  )
+  (func $b3 (param $x f64) (result f64)
+    (f64.add (f64.mul (get_local $x) (f64.const 2.5)) (f64.sqrt (get_local $x)))
+  )
+)
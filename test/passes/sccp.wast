@@ -0,0 +1,100 @@
+(module
+  (import "env" "get" (func $get (result i32)))
+  (func $if-not-taken (result i32)
+    (local $x i32)
+    (set_local $x (i32.const 1))
+    (if (i32.eqz (get_local $x))
+      (set_local $x (i32.const 2))
+    )
+    (get_local $x)
+  )
+  (func $if-taken (result i32)
+    (local $x i32)
+    (set_local $x (i32.const 1))
+    (if (get_local $x)
+      (set_local $x (i32.const 2))
+      (set_local $x (i32.const 3))
+    )
+    (get_local $x)
+  )
+  (func $merge-same (param $p i32) (result i32)
+    (local $x i32)
+    (if (get_local $p)
+      (set_local $x (i32.const 7))
+      (set_local $x (i32.const 7))
+    )
+    (i32.add (get_local $x) (i32.const 1))
+  )
+  (func $merge-different (param $p i32) (result i32)
+    (local $x i32)
+    (if (get_local $p)
+      (set_local $x (i32.const 7))
+      (set_local $x (i32.const 8))
+    )
+    (get_local $x)
+  )
+  (func $loop (result i32)
+    ;; $x is constant in the loop, as the only other value reaching the loop
+    ;; top comes from an arm that is never taken
+    (local $x i32)
+    (local $i i32)
+    (set_local $x (i32.const 5))
+    (loop $l
+      (if (i32.ne (get_local $x) (i32.const 5))
+        (set_local $x (i32.const 6))
+      )
+      (set_local $i (i32.add (get_local $i) (i32.const 1)))
+      (br_if $l (i32.lt_u (get_local $i) (get_local $x)))
+    )
+    (get_local $x)
+  )
+  (func $br-if (result i32)
+    (local $x i32)
+    (block $out
+      (br_if $out (get_local $x))
+      (set_local $x (i32.const 1))
+      (br_if $out (get_local $x))
+      (set_local $x (i32.const 2))
+    )
+    (get_local $x)
+  )
+  (func $br-if-value (result i32)
+    (local $x i32)
+    (block $out (result i32)
+      (drop (br_if $out (i32.const 1) (get_local $x)))
+      (i32.const 2)
+    )
+  )
+  (func $side-effects (result i32)
+    (local $x i32)
+    (set_local $x (i32.const 1))
+    (if (i32.or (get_local $x) (call $get))
+      (set_local $x (i32.const 2))
+    )
+    (if (tee_local $x (i32.const 0))
+      (set_local $x (i32.const 3))
+    )
+    (get_local $x)
+  )
+  (func $unknown (param $p i32) (result i32)
+    (local $x i32)
+    (set_local $x (call $get))
+    (if (get_local $x)
+      (set_local $x (get_local $p))
+    )
+    (get_local $x)
+  )
+  (func $nested-condition (param $p i32) (result i32)
+    ;; the condition has code that is never run, which reads a local
+    (local $x i32)
+    (if
+      (if (result i32)
+        (get_local $x)
+        (get_local $p)
+        (i32.const 1)
+      )
+      (set_local $x (i32.const 2))
+    )
+    (get_local $x)
+  )
+)
@@ -0,0 +1,48 @@
+(module
+  (type $0 (func (param i32 i32) (result i32)))
+  (import "env" "log" (func $log (param i32)))
+  (memory $0 1)
+  (export "dispatch" (func $dispatch))
+  (func $dispatch (param $op i32) (param $x i32) (result i32)
+    (block $c
+      (block $b
+        (block $a
+          (br_table $a $b $c (get_local $op))
+        )
+        (return (i32.add (get_local $x) (i32.const 1)))
+      )
+      (return (i32.mul (get_local $x) (i32.const 3)))
+    )
+    (i32.div_s (get_local $x) (i32.const 7))
+  )
+  (func $logs (param $x i32)
+    (call $log (get_local $x))
+  )
+  (func $hot (param $p i32) (result i32)
+    (local $sum i32)
+    (loop $l
+      ;; a hot group of calls, passing the same constant op
+      (set_local $sum
+        (i32.add
+          (get_local $sum)
+          (call $dispatch (i32.const 1) (get_local $p))
+        )
+      )
+      ;; hot, but specializing does not help
+      (call $logs (i32.const 5))
+      (br_if $l (get_local $p))
+    )
+    (get_local $sum)
+  )
+  (func $cold (param $p i32) (result i32)
+    ;; called only once, outside of a loop
+    (call $dispatch (i32.const 2) (get_local $p))
+  )
+  (func $not-constant (param $p i32) (result i32)
+    (loop $l
+      (drop (call $dispatch (get_local $p) (get_local $p)))
+      (br_if $l (get_local $p))
+    )
+    (i32.const 0)
+  )
+)
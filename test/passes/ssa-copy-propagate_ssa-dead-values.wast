@@ -0,0 +1,68 @@
+(module
+  (import "env" "foo" (func $foo (param i32) (result i32)))
+  (func $copy (param $x i32) (result i32)
+    (local $y i32)
+    (set_local $y (get_local $x))
+    (i32.add (get_local $y) (get_local $y))
+  )
+  (func $copy-chain (param $x i32) (result i32)
+    (local $y i32)
+    (local $z i32)
+    (set_local $y (get_local $x))
+    (set_local $z (get_local $y))
+    (get_local $z)
+  )
+  (func $copy-tee (param $x i32) (result i32)
+    (local $y i32)
+    (local $z i32)
+    (set_local $z (tee_local $y (i32.add (get_local $x) (i32.const 1))))
+    (i32.mul (get_local $z) (get_local $y))
+  )
+  (func $source-overwritten (param $x i32) (result i32)
+    (local $y i32)
+    (set_local $y (get_local $x))
+    (set_local $x (i32.const 5))
+    (i32.add (get_local $y) (get_local $x))
+  )
+  (func $source-merged (param $x i32) (param $c i32) (result i32)
+    (local $y i32)
+    (set_local $y (get_local $x))
+    (if (get_local $c)
+      (set_local $x (i32.const 5))
+    )
+    (get_local $y) ;; $x may have changed
+  )
+  (func $copy-of-phi (param $x i32) (param $c i32) (result i32)
+    (local $y i32)
+    (if (get_local $c)
+      (set_local $x (i32.const 5))
+    )
+    (set_local $y (get_local $x))
+    (get_local $y) ;; $x is the same merged value
+  )
+  (func $dead-loop-counter (param $x i32) (result i32)
+    (local $i i32)
+    (local $j i32)
+    (loop $loop
+      (set_local $i (i32.add (get_local $i) (i32.const 1)))
+      (set_local $j (i32.add (get_local $j) (get_local $i)))
+      (br_if $loop (i32.lt_u (get_local $i) (get_local $x)))
+    )
+    (get_local $x) ;; $j is never read outside of its own computation
+  )
+  (func $dead-with-effects (param $x i32)
+    (local $y i32)
+    (set_local $y (call $foo (get_local $x)))
+    (set_local $y (i32.div_s (get_local $x) (get_local $x)))
+  )
+  (func $dead-tee (param $x i32) (result i32)
+    (local $y i32)
+    (i32.add (tee_local $y (get_local $x)) (i32.const 1))
+  )
+  (func $unreachable-use (param $x i32)
+    (local $y i32)
+    (set_local $y (get_local $x))
+    (return)
+    (drop (get_local $y))
+  )
+)
@@ -0,0 +1,16 @@
+(module
+  (global $g (mut i64) (i64.const 0))
+  (global $h (mut i32) (i32.const 1))
+  (memory $0 1)
+  (func $a (result i32)
+    (set_global $h (i32.add (get_global $h) (i32.const 2)))
+    (i32.load (get_global $h))
+  )
+  (func $b (result i64)
+    (drop (call $a))
+    (i64.add (get_global $g) (i64.const 1))
+  )
+  (func $c
+    (drop (call $b))
+  )
+)
@@ -0,0 +1,69 @@
+(module
+  (memory (shared 1 1))
+  (data (i32.const 0) "\ff\ff\ff\ff\ff\ff\ff\ff")
+
+  (func (export "load8_u") (result i32) (i32.atomic.load8_u (i32.const 0)))
+  (func (export "load16_u") (result i32) (i32.atomic.load16_u (i32.const 0)))
+  (func (export "i64.load32_u") (result i64) (i64.atomic.load32_u (i32.const 0)))
+  (func (export "load-unaligned") (result i32) (i32.atomic.load (i32.const 1)))
+  (func (export "load-offset") (result i32) (i32.atomic.load offset=4 (i32.const 0)))
+
+  (func (export "store8") (param i32) (i32.atomic.store8 (i32.const 16) (get_local 0)))
+  (func (export "store-unaligned") (i32.atomic.store (i32.const 18) (i32.const 0)))
+  (func (export "load16") (result i32) (i32.atomic.load16_u (i32.const 16)))
+
+  (func (export "add") (param i32) (result i32) (i32.atomic.rmw.add (i32.const 32) (get_local 0)))
+  (func (export "sub") (param i32) (result i32) (i32.atomic.rmw.sub (i32.const 32) (get_local 0)))
+  (func (export "xchg") (param i32) (result i32) (i32.atomic.rmw.xchg (i32.const 32) (get_local 0)))
+  (func (export "add8") (param i32) (result i32) (i32.atomic.rmw8_u.add (i32.const 32) (get_local 0)))
+  (func (export "get") (result i32) (i32.atomic.load (i32.const 32)))
+  (func (export "i64.add") (param i64) (result i64) (i64.atomic.rmw.add (i32.const 40) (get_local 0)))
+  (func (export "i64.get") (result i64) (i64.atomic.load (i32.const 40)))
+
+  (func (export "cmpxchg8") (param i32 i32) (result i32)
+    (i32.atomic.rmw8_u.cmpxchg (i32.const 48) (get_local 0) (get_local 1)))
+  (func (export "get8") (result i32) (i32.atomic.load8_u (i32.const 48)))
+
+  (func (export "wait") (param i32 i64) (result i32)
+    (i32.wait (i32.const 64) (get_local 0) (get_local 1)))
+  (func (export "wait-unaligned") (result i32)
+    (i32.wait (i32.const 66) (i32.const 0) (i64.const 0)))
+  (func (export "wake") (result i32) (wake (i32.const 64) (i32.const 1)))
+)
+
+;; narrow atomic loads zero-extend
+(assert_return (invoke "load8_u") (i32.const 255))
+(assert_return (invoke "load16_u") (i32.const 65535))
+(assert_return (invoke "i64.load32_u") (i64.const 4294967295))
+(assert_return (invoke "load-offset") (i32.const -1))
+(assert_trap (invoke "load-unaligned") "unaligned atomic operation")
+
+(invoke "store8" (i32.const 0x1234))
+(assert_return (invoke "load16") (i32.const 0x34))
+(assert_trap (invoke "store-unaligned") "unaligned atomic operation")
+
+;; rmw operations return the old value
+(assert_return (invoke "add" (i32.const 5)) (i32.const 0))
+(assert_return (invoke "add" (i32.const 7)) (i32.const 5))
+(assert_return (invoke "sub" (i32.const 2)) (i32.const 12))
+(assert_return (invoke "xchg" (i32.const 0xff)) (i32.const 10))
+(assert_return (invoke "add8" (i32.const 1)) (i32.const 0xff))
+(assert_return (invoke "get") (i32.const 0))
+(assert_return (invoke "i64.add" (i64.const 0x100000000)) (i64.const 0))
+(assert_return (invoke "i64.add" (i64.const 1)) (i64.const 0x100000000))
+(assert_return (invoke "i64.get") (i64.const 0x100000001))
+
+;; the expected value is wrapped to the size of the access
+(assert_return (invoke "cmpxchg8" (i32.const 0x100) (i32.const 7)) (i32.const 0))
+(assert_return (invoke "get8") (i32.const 7))
+(assert_return (invoke "cmpxchg8" (i32.const 6) (i32.const 9)) (i32.const 7))
+(assert_return (invoke "get8") (i32.const 7))
+
+;; with nothing else to wake it, a wait can only be not-equal or time out
+(assert_return (invoke "wait" (i32.const 1) (i64.const -1)) (i32.const 1))
+(assert_return (invoke "wait" (i32.const 0) (i64.const 0)) (i32.const 2))
+(assert_return (invoke "wait" (i32.const 0) (i64.const 1000)) (i32.const 2))
+(assert_trap (invoke "wait" (i32.const 0) (i64.const -1)) "wait would never be woken")
+(assert_trap (invoke "wait-unaligned") "unaligned atomic operation")
+(assert_return (invoke "wake") (i32.const 0))
+
@@ -0,0 +1,39 @@
+(module
+  (type $ii (func (param i32) (result i32)))
+  (import "env" "log" (func $log (param i32)))
+  (import "env" "base" (global $base i32))
+  (memory $0 1)
+  (table 2 2 anyfunc)
+  (elem (i32.const 0) $tabled $hot)
+  (global $counter (mut i32) (i32.const 0))
+  (export "main" (func $main))
+  (export "exported-cold" (func $exported-cold))
+  (start $start)
+  (func $start
+    (set_global $counter (get_global $base))
+  )
+  (func $main (param $x i32) (result i32)
+    (if (get_local $x)
+      (return (call $cold (get_local $x)))
+    )
+    (call $hot (get_local $x))
+  )
+  (func $hot (param $x i32) (result i32)
+    (i32.add (get_local $x) (i32.const 1))
+  )
+  (func $cold (param $x i32) (result i32)
+    (call $log (get_local $x))
+    (set_global $counter (i32.add (get_global $counter) (i32.const 1)))
+    (i32.store (i32.const 8) (get_local $x))
+    (call $cold-helper (call $hot (get_local $x)))
+  )
+  (func $cold-helper (param $x i32) (result i32)
+    (call_indirect (type $ii) (get_local $x) (i32.const 1))
+  )
+  (func $exported-cold (result i32)
+    (i32.const 42)
+  )
+  (func $tabled (param $x i32) (result i32)
+    (get_local $x)
+  )
+)
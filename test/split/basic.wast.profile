@@ -0,0 +1,3 @@
+# functions that ran during startup
+main
+hot
@@ -129,7 +129,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $13() {
-  var $0 = 0, $1_1 = 0, $2_1 = 0, $5_1 = 0, $9_1 = 0, $10_1 = 0, $13_1 = 0, $14_1 = 0;
+  var $0 = 0, $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0;
   $0 = 0;
   $1_1 = $0;
   block : {
@@ -139,22 +139,22 @@ function asmFunc(global, env, buffer) {
    };
   };
   $0 = $1_1 + $2_1 | 0;
-  $5_1 = $0;
-  $0 = $5_1 + 2 | 0;
-  $9_1 = $0;
+  $3_1 = $0;
+  $0 = $3_1 + 2 | 0;
+  $4_1 = $0;
   block50 : {
-   $10_1 = 4;
+   $5_1 = 4;
    break block50;
   };
-  $0 = $9_1 + $10_1 | 0;
-  $13_1 = $0;
+  $0 = $4_1 + $5_1 | 0;
+  $6_1 = $0;
   block51 : {
    block52 : {
-    $14_1 = 8;
+    $7_1 = 8;
     break block51;
    };
   };
-  $0 = $13_1 + $14_1 | 0;
+  $0 = $6_1 + $7_1 | 0;
   return $0 | 0;
  }
  
@@ -51,17 +51,14 @@ function asmFunc(global, env, buffer) {
  }
  
  function $6() {
-  var i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0;
+  var i64toi32_i32$0 = 0, $1_1 = 0;
   block : {
    i64toi32_i32$0 = 0;
-   $0 = 2;
-   $0$hi = i64toi32_i32$0;
+   $1_1 = 2;
    break block;
   };
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $0 | 0;
+  return $1_1 | 0;
  }
  
  function $7() {
@@ -111,7 +108,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $13() {
-  var $0 = 0, $1_1 = 0, $3_1 = 0;
+  var $0 = 0, $1_1 = 0;
   block : {
    loop_in : do {
     $0 = 3;
@@ -123,7 +120,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $14() {
-  var $0 = 0, $1_1 = 0, $3_1 = 0;
+  var $0 = 0, $1_1 = 0;
   block : {
    loop_in : do {
     dummy();
@@ -202,17 +199,14 @@ function asmFunc(global, env, buffer) {
  }
  
  function $23() {
-  var i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0;
+  var i64toi32_i32$0 = 0, $1_1 = 0;
   block : {
    i64toi32_i32$0 = 0;
-   $0 = 7;
-   $0$hi = i64toi32_i32$0;
+   $1_1 = 7;
    break block;
   };
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $0 | 0;
+  return $1_1 | 0;
  }
  
  function $24() {
@@ -227,35 +221,35 @@ function asmFunc(global, env, buffer) {
  function $25($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $3_1 = 0, $5_1 = 0;
+  var $2_1 = 0, $3_1 = 0;
   block : {
    if ($0) {
-    $3_1 = 3;
+    $2_1 = 3;
     break block;
-   } else $5_1 = $1_1;
-   $3_1 = $5_1;
+   } else $3_1 = $1_1;
+   $2_1 = $3_1;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $26($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $4_1 = 0, $5_1 = 0;
+  var $2_1 = 0, $3_1 = 0;
   block : {
-   if ($0) $5_1 = $1_1; else {
-    $4_1 = 4;
+   if ($0) $3_1 = $1_1; else {
+    $2_1 = 4;
     break block;
    }
-   $4_1 = $5_1;
+   $2_1 = $3_1;
   };
-  return $4_1 | 0;
+  return $2_1 | 0;
  }
  
  function $27($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0;
+  var $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    $2_1 = 5;
    break block;
@@ -266,7 +260,7 @@ function asmFunc(global, env, buffer) {
  function $28($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0;
+  var $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    $2_1 = $0;
    $3_1 = 6;
@@ -355,12 +349,12 @@ function asmFunc(global, env, buffer) {
  }
  
  function $38() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 17;
+   $0 = 17;
    break block;
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $39() {
@@ -373,17 +367,14 @@ function asmFunc(global, env, buffer) {
  }
  
  function $40() {
-  var i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0;
+  var i64toi32_i32$0 = 0, $1_1 = 0;
   block : {
    i64toi32_i32$0 = 0;
-   $0 = 30;
-   $0$hi = i64toi32_i32$0;
+   $1_1 = 30;
    break block;
   };
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $0 | 0;
+  return $1_1 | 0;
  }
  
  function $41() {
@@ -441,17 +432,14 @@ function asmFunc(global, env, buffer) {
  }
  
  function $47() {
-  var i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0;
+  var i64toi32_i32$2 = 0, $1_1 = 0;
   block : {
-   i64toi32_i32$0 = 0;
-   $0 = 45;
-   $0$hi = i64toi32_i32$0;
+   i64toi32_i32$2 = 0;
+   $1_1 = 45;
    break block;
   };
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $0 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return $1_1 | 0;
  }
  
  function $48() {
@@ -521,7 +509,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $55() {
-  var $0 = 0, $1_1 = 0;
+  var $0 = 0;
   block : {
    $0 = 8;
    break block;
@@ -565,46 +553,35 @@ function asmFunc(global, env, buffer) {
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10_1 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, $10_1 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   if (((var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0) == (0 | 0)) {
-   i64toi32_i32$0 = var$0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = var$0;
-   i64toi32_i32$1 = 4294967295;
-   i64toi32_i32$3 = 4294967295;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$2 = i64toi32_i32$2;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$0) + 32 | 0; else $10_1 = i64toi32_i32$3;
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
+   i64toi32_i32$1 = 0;
    i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
+   i64toi32_i32$4 = var$0$hi;
+   i64toi32_i32$3 = var$0;
+   i64toi32_i32$6 = 4294967295;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 4294967295 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$7;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$4 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$8 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$2 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$8 = 0;
+   if ((i64toi32_i32$4 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $10_1 = i64toi32_i32$4;
    i64toi32_i32$3 = $10_1;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   i64toi32_i32$0 = i64toi32_i32$1;
+   i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2;
    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$4 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$4 | 0;
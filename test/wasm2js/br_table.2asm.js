@@ -42,9 +42,9 @@ function asmFunc(global, env, buffer) {
  }
  
  function $5() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 1;
+   $0 = 1;
    switch (0 | 0) {
    case 0:
     break block;
@@ -52,33 +52,44 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $6() {
-  var i64toi32_i32$0 = 0, $1_1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $3_1 = 0, i64toi32_i32$2 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0;
   block : {
-   i64toi32_i32$0 = 0;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   $1_1 = 2;
-   $1$hi = i64toi32_i32$0;
-   switch (0 | 0) {
-   case 0:
-    break block;
-   default:
+   $i64toi32_block_1 : {
+    $i64toi32_block_0 : {
+     i64toi32_i32$0 = 0;
+     $3_1 = 2;
+     $5_1 = $3_1;
+     $6_1 = $3_1;
+     switch (0 | 0) {
+     case 0:
+      break $i64toi32_block_0;
+     default:
+      break $i64toi32_block_1;
+     };
+    };
+    i64toi32_i32$1 = $5_1;
+    i64toi32_i32$2 = i64toi32_i32$0;
+    $4_1 = i64toi32_i32$1;
     break block;
    };
+   i64toi32_i32$1 = $6_1;
+   i64toi32_i32$2 = i64toi32_i32$0;
+   $4_1 = i64toi32_i32$1;
+   break block;
   };
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $1_1 | 0;
+  i64toi32_i32$0 = $4_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $7() {
-  var $1_1 = Math_fround(0);
+  var $0 = Math_fround(0);
   block : {
-   $1_1 = Math_fround(3.0);
+   $0 = Math_fround(3.0);
    switch (0 | 0) {
    case 0:
     break block;
@@ -86,13 +97,13 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return Math_fround($1_1);
+  return Math_fround($0);
  }
  
  function $8() {
-  var $1_1 = 0.0;
+  var $0 = 0.0;
   block : {
-   $1_1 = 4.0;
+   $0 = 4.0;
    switch (0 | 0) {
    case 0:
     break block;
@@ -100,7 +111,7 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return +$1_1;
+  return +$0;
  }
  
  function $9($0) {
@@ -110,15 +121,15 @@ function asmFunc(global, env, buffer) {
  
  function $10($0) {
   $0 = $0 | 0;
-  var $3_1 = 0;
+  var $1_1 = 0;
   block : {
-   $3_1 = 33;
+   $1_1 = 33;
    switch ($0 | 0) {
    default:
     break block;
    };
   };
-  return $3_1 | 0;
+  return $1_1 | 0;
  }
  
  function $11($0) {
@@ -139,12 +150,12 @@ function asmFunc(global, env, buffer) {
  
  function $12($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0;
   block : {
    block1 : {
-    $2_1 = 33;
-    $3_1 = $2_1;
-    $4_1 = $2_1;
+    $1_1 = 33;
+    $2_1 = $1_1;
+    $3_1 = $1_1;
     switch ($0 | 0) {
     case 0:
      break block1;
@@ -152,9 +163,9 @@ function asmFunc(global, env, buffer) {
      break block;
     };
    };
-   $3_1 = 32;
+   $2_1 = 32;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $13($0) {
@@ -190,18 +201,18 @@ function asmFunc(global, env, buffer) {
  
  function $14($0) {
   $0 = $0 | 0;
-  var $1_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0, $8_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0;
   block : {
    block6 : {
     block7 : {
      block8 : {
       block9 : {
-       $3_1 = 200;
-       $4_1 = $3_1;
-       $5_1 = $3_1;
-       $6_1 = $3_1;
-       $7_1 = $3_1;
-       $8_1 = $3_1;
+       $2_1 = 200;
+       $3_1 = $2_1;
+       $4_1 = $2_1;
+       $5_1 = $2_1;
+       $6_1 = $2_1;
+       $7_1 = $2_1;
        switch ($0 | 0) {
        case 0:
         break block6;
@@ -215,19 +226,19 @@ function asmFunc(global, env, buffer) {
         break block;
        };
       };
-      $1_1 = $8_1;
+      $1_1 = $7_1;
       return $1_1 + 10 | 0 | 0;
      };
-     $1_1 = $7_1;
+     $1_1 = $6_1;
      return $1_1 + 11 | 0 | 0;
     };
-    $1_1 = $6_1;
+    $1_1 = $5_1;
     return $1_1 + 12 | 0 | 0;
    };
-   $1_1 = $5_1;
+   $1_1 = $4_1;
    return $1_1 + 13 | 0 | 0;
   };
-  $1_1 = $4_1;
+  $1_1 = $3_1;
   return $1_1 + 14 | 0 | 0;
  }
  
@@ -49508,10 +49519,10 @@ function asmFunc(global, env, buffer) {
  }
  
  function $19() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
    dummy();
-   $1_1 = 2;
+   $0 = 2;
    switch (0 | 0) {
    case 0:
     break block;
@@ -49521,14 +49532,14 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $20() {
-  var $1_1 = 0, $2_1 = 0, $4_1 = 0;
+  var $0 = 0, $1_1 = 0;
   fake_return_waka123 : {
    loop_in : do {
-    $1_1 = 3;
+    $0 = 3;
     switch (0 | 0) {
     case 0:
      break fake_return_waka123;
@@ -49538,15 +49549,15 @@ function asmFunc(global, env, buffer) {
     break loop_in;
    } while (1);
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $21() {
-  var $1_1 = 0, $2_1 = 0, $4_1 = 0;
+  var $0 = 0, $1_1 = 0;
   fake_return_waka123 : {
    loop_in : do {
     dummy();
-    $1_1 = 4;
+    $0 = 4;
     switch (4294967295 | 0) {
     case 0:
      break fake_return_waka123;
@@ -49558,15 +49569,15 @@ function asmFunc(global, env, buffer) {
     break loop_in;
    } while (1);
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $22() {
-  var $1_1 = 0;
+  var $0 = 0;
   fake_return_waka123 : {
    loop_in : do {
     dummy();
-    $1_1 = 5;
+    $0 = 5;
     switch (1 | 0) {
     case 0:
      break fake_return_waka123;
@@ -49578,7 +49589,7 @@ function asmFunc(global, env, buffer) {
     break loop_in;
    } while (1);
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $23() {
@@ -49595,21 +49606,21 @@ function asmFunc(global, env, buffer) {
  }
  
  function $25() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 8;
+   $0 = 8;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $26() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 9;
+   $0 = 9;
    switch (0 | 0) {
    case 0:
     break block;
@@ -49617,7 +49628,7 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $27() {
@@ -49625,86 +49636,88 @@ function asmFunc(global, env, buffer) {
  }
  
  function $28() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 10;
+   $0 = 10;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $29() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 11;
+   $0 = 11;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $30() {
-  var i64toi32_i32$0 = 0, $1_1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, $2_1 = 0, i64toi32_i32$2 = 0, $3_1 = 0;
   block : {
-   i64toi32_i32$0 = 0;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   $1_1 = 7;
-   $1$hi = i64toi32_i32$0;
-   switch (0 | 0) {
-   default:
-    break block;
+   $i64toi32_block_0 : {
+    i64toi32_i32$0 = 0;
+    $2_1 = 7;
+    switch (0 | 0) {
+    default:
+     break $i64toi32_block_0;
+    };
    };
+   i64toi32_i32$2 = i64toi32_i32$0;
+   $3_1 = $2_1;
+   break block;
   };
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $1_1 | 0;
+  i64toi32_i32$0 = $3_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $31() {
-  var $1_1 = 0, $2_1 = 0;
+  var $0 = 0, $1_1 = 0;
   if_ : {
-   $1_1 = 2;
+   $0 = 2;
    switch (0 | 0) {
    default:
     break if_;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $32($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $4_1 = 0, $6_1 = 0;
+  var $2_1 = 0, $3_1 = 0;
   block : {
    if ($0) {
-    $4_1 = 3;
+    $2_1 = 3;
     switch (0 | 0) {
     default:
      break block;
     };
-   } else $6_1 = $1_1;
-   $4_1 = $6_1;
+   } else $3_1 = $1_1;
+   $2_1 = $3_1;
   };
-  return $4_1 | 0;
+  return $2_1 | 0;
  }
  
  function $33($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0;
+  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0;
   block : {
    if_ : {
-    if ($0) $7_1 = $1_1; else {
-     $4_1 = 4;
-     $5_1 = $4_1;
-     $6_1 = $4_1;
+    if ($0) $5_1 = $1_1; else {
+     $2_1 = 4;
+     $3_1 = $2_1;
+     $4_1 = $2_1;
      switch (0 | 0) {
      case 0:
       break block;
@@ -49712,52 +49725,52 @@ function asmFunc(global, env, buffer) {
       break if_;
      };
     }
-    $6_1 = $7_1;
+    $4_1 = $5_1;
    };
-   $5_1 = $6_1;
+   $3_1 = $4_1;
   };
-  return $5_1 | 0;
+  return $3_1 | 0;
  }
  
  function $34($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0;
+  var $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
-   $3_1 = 5;
+   $2_1 = 5;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $35($0, $1_1) {
   $0 = $0 | 0;
   $1_1 = $1_1 | 0;
-  var $2_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0;
+  var $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    $2_1 = $0;
-   $4_1 = 6;
+   $3_1 = 6;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $4_1 | 0;
+  return $3_1 | 0;
  }
  
  function $36() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 7;
+   $0 = 7;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function f($0, $1_1, $2_1) {
@@ -49768,195 +49781,197 @@ function asmFunc(global, env, buffer) {
  }
  
  function $38() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 12;
+   $0 = 12;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $39() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 13;
+   $0 = 13;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $40() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 14;
+   $0 = 14;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $41() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 20;
+   $0 = 20;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $42() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 21;
+   $0 = 21;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $43() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 22;
+   $0 = 22;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $44() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 23;
+   $0 = 23;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $45() {
-  var $2_1 = 0;
+  var $0 = 0;
   block : {
-   $2_1 = 17;
+   $0 = 17;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $2_1 | 0;
+  return $0 | 0;
  }
  
  function $46() {
-  var $1_1 = Math_fround(0);
+  var $0 = Math_fround(0);
   block : {
-   $1_1 = Math_fround(1.7000000476837158);
+   $0 = Math_fround(1.7000000476837158);
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return Math_fround($1_1);
+  return Math_fround($0);
  }
  
  function $47() {
-  var i64toi32_i32$0 = 0, $1_1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, $2_1 = 0, i64toi32_i32$2 = 0, $3_1 = 0;
   block : {
-   i64toi32_i32$0 = 0;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   $1_1 = 30;
-   $1$hi = i64toi32_i32$0;
-   switch (1 | 0) {
-   default:
-    break block;
+   $i64toi32_block_0 : {
+    i64toi32_i32$0 = 0;
+    $2_1 = 30;
+    switch (1 | 0) {
+    default:
+     break $i64toi32_block_0;
+    };
    };
+   i64toi32_i32$2 = i64toi32_i32$0;
+   $3_1 = $2_1;
+   break block;
   };
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $1_1 | 0;
+  i64toi32_i32$0 = $3_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $48() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 30;
+   $0 = 30;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $49() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 31;
+   $0 = 31;
    switch (1 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $50() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 32;
+   $0 = 32;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $51() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 33;
+   $0 = 33;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $52() {
-  var $1_1 = Math_fround(0);
+  var $0 = Math_fround(0);
   block : {
-   $1_1 = Math_fround(3.4000000953674316);
+   $0 = Math_fround(3.4000000953674316);
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return Math_fround($1_1);
+  return Math_fround($0);
  }
  
  function $53() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 3;
+   $0 = 3;
    switch (0 | 0) {
    case 0:
     break block;
@@ -49964,43 +49979,44 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $54() {
-  var i64toi32_i32$0 = 0, $1_1 = 0, $1$hi = 0;
+  var i64toi32_i32$2 = 0, $2_1 = 0, i64toi32_i32$4 = 0, $3_1 = 0;
   block : {
-   i64toi32_i32$0 = 0;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   $1_1 = 45;
-   $1$hi = i64toi32_i32$0;
-   switch (0 | 0) {
-   default:
-    break block;
+   $i64toi32_block_0 : {
+    i64toi32_i32$2 = 0;
+    $2_1 = 45;
+    switch (0 | 0) {
+    default:
+     break $i64toi32_block_0;
+    };
    };
+   i64toi32_i32$4 = i64toi32_i32$2;
+   $3_1 = $2_1;
+   break block;
   };
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $1_1 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return $3_1 | 0;
  }
  
  function $55() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 44;
+   $0 = 44;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $56() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 43;
+   $0 = 43;
    switch (0 | 0) {
    case 0:
     break block;
@@ -50008,55 +50024,55 @@ function asmFunc(global, env, buffer) {
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $57() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 42;
+   $0 = 42;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $58() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 41;
+   $0 = 41;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $59() {
-  var $1_1 = 0;
+  var $0 = 0;
   block : {
-   $1_1 = 40;
+   $0 = 40;
    switch (0 | 0) {
    default:
     break block;
    };
   };
-  return $1_1 | 0;
+  return $0 | 0;
  }
  
  function $60($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    block11 : {
     block12 : {
-     $2_1 = 16;
-     $3_1 = $2_1;
-     $4_1 = $2_1;
-     $5_1 = $2_1;
+     $1_1 = 16;
+     $2_1 = $1_1;
+     $3_1 = $1_1;
+     $4_1 = $1_1;
      switch ($0 | 0) {
      case 0:
       break block12;
@@ -50066,23 +50082,23 @@ function asmFunc(global, env, buffer) {
       break block;
      };
     };
-    $4_1 = 2 + $5_1 | 0;
+    $3_1 = 2 + $4_1 | 0;
    };
-   $3_1 = 1 + $4_1 | 0;
+   $2_1 = 1 + $3_1 | 0;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $61($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    block13 : {
     block14 : {
-     $2_1 = 8;
-     $3_1 = $2_1;
-     $4_1 = $2_1;
-     $5_1 = $2_1;
+     $1_1 = 8;
+     $2_1 = $1_1;
+     $3_1 = $1_1;
+     $4_1 = $1_1;
      switch ($0 | 0) {
      case 0:
       break block;
@@ -50092,23 +50108,23 @@ function asmFunc(global, env, buffer) {
       break block14;
      };
     };
-    $4_1 = 16;
+    $3_1 = 16;
    };
-   $3_1 = 1 + $4_1 | 0;
+   $2_1 = 1 + $3_1 | 0;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $62($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    block15 : {
     block16 : {
-     $2_1 = 8;
-     $3_1 = $2_1;
-     $4_1 = $2_1;
-     $5_1 = $2_1;
+     $1_1 = 8;
+     $2_1 = $1_1;
+     $3_1 = $1_1;
+     $4_1 = $1_1;
      switch ($0 | 0) {
      case 0:
       break block16;
@@ -50118,21 +50134,21 @@ function asmFunc(global, env, buffer) {
       break block;
      };
     };
-    $4_1 = 16;
+    $3_1 = 16;
    };
-   $3_1 = 1 + $4_1 | 0;
+   $2_1 = 1 + $3_1 | 0;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $63($0) {
   $0 = $0 | 0;
-  var $4_1 = 0, $2_1 = 0, $3_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0;
   block : {
    block17 : {
     $2_1 = 8;
     $3_1 = $2_1;
-    $4_1 = $2_1;
+    $1_1 = $2_1;
     switch ($0 | 0) {
     case 0:
      break block17;
@@ -50142,21 +50158,21 @@ function asmFunc(global, env, buffer) {
      break block17;
     };
    };
-   $3_1 = 1 + $4_1 | 0;
+   $3_1 = 1 + $1_1 | 0;
   };
   return $3_1 | 0;
  }
  
  function $64($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0;
   block : {
    block18 : {
     block19 : {
-     $2_1 = 8;
-     $3_1 = $2_1;
-     $4_1 = $2_1;
-     $5_1 = $2_1;
+     $1_1 = 8;
+     $2_1 = $1_1;
+     $3_1 = $1_1;
+     $4_1 = $1_1;
      switch ($0 | 0) {
      case 0:
       break block19;
@@ -50166,21 +50182,21 @@ function asmFunc(global, env, buffer) {
       break block;
      };
     };
-    $4_1 = 16;
+    $3_1 = 16;
    };
-   $3_1 = 1 + $4_1 | 0;
+   $2_1 = 1 + $3_1 | 0;
   };
-  return $3_1 | 0;
+  return $2_1 | 0;
  }
  
  function $65($0) {
   $0 = $0 | 0;
-  var $4_1 = 0, $2_1 = 0, $3_1 = 0;
+  var $1_1 = 0, $2_1 = 0, $3_1 = 0;
   block : {
    block20 : {
     $2_1 = 8;
     $3_1 = $2_1;
-    $4_1 = $2_1;
+    $1_1 = $2_1;
     switch ($0 | 0) {
     case 0:
      break block20;
@@ -50190,7 +50206,7 @@ function asmFunc(global, env, buffer) {
      break block20;
     };
    };
-   $3_1 = 1 + $4_1 | 0;
+   $3_1 = 1 + $1_1 | 0;
   };
   return $3_1 | 0;
  }
@@ -50204,46 +50220,35 @@ function asmFunc(global, env, buffer) {
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10_1 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, $10_1 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   if (((var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0) == (0 | 0)) {
-   i64toi32_i32$0 = var$0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = var$0;
-   i64toi32_i32$1 = 4294967295;
-   i64toi32_i32$3 = 4294967295;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$2 = i64toi32_i32$2;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$0) + 32 | 0; else $10_1 = i64toi32_i32$3;
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
+   i64toi32_i32$1 = 0;
    i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
+   i64toi32_i32$4 = var$0$hi;
+   i64toi32_i32$3 = var$0;
+   i64toi32_i32$6 = 4294967295;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 4294967295 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$7;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$4 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$8 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$2 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$8 = 0;
+   if ((i64toi32_i32$4 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $10_1 = i64toi32_i32$4;
    i64toi32_i32$3 = $10_1;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   i64toi32_i32$0 = i64toi32_i32$1;
+   i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2;
    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$4 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$4 | 0;
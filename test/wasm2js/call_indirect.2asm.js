@@ -46,10 +46,7 @@ function asmFunc(global, env, buffer) {
  function id_i64($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0 | 0;
  }
  
@@ -67,10 +64,7 @@ function asmFunc(global, env, buffer) {
   $0 = $0 | 0;
   $1 = $1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $1$hi;
   return $1 | 0;
  }
  
@@ -101,10 +95,7 @@ function asmFunc(global, env, buffer) {
  function over_i64_duplicate($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0 | 0;
  }
  
@@ -126,14 +117,12 @@ function asmFunc(global, env, buffer) {
  }
  
  function $17() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   wasm2js_i32$1 = 1;
   wasm2js_i32$0 = FUNCTION_TABLE_i[wasm2js_i32$1 & 31]() | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
@@ -152,17 +141,15 @@ function asmFunc(global, env, buffer) {
  }
  
  function $20() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   i64toi32_i32$0 = 0;
   wasm2js_i32$2 = 100;
   wasm2js_i32$3 = i64toi32_i32$0;
   wasm2js_i32$1 = 5;
   wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
@@ -175,17 +162,15 @@ function asmFunc(global, env, buffer) {
  }
  
  function $22() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   i64toi32_i32$0 = 0;
   wasm2js_i32$2 = 64;
   wasm2js_i32$3 = i64toi32_i32$0;
   wasm2js_i32$1 = 5;
   wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
@@ -215,7 +200,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $26() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0, wasm2js_i32$4 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0, wasm2js_i32$4 = 0;
   i64toi32_i32$0 = 0;
   wasm2js_i32$2 = 32;
   wasm2js_i32$3 = 64;
@@ -223,10 +208,8 @@ function asmFunc(global, env, buffer) {
   wasm2js_i32$1 = 9;
   wasm2js_i32$0 = FUNCTION_TABLE_iiii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0, wasm2js_i32$4 | 0) | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
@@ -253,169 +236,138 @@ function asmFunc(global, env, buffer) {
   $0 = $0 | 0;
   $1 = $1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   wasm2js_i32$2 = $1;
   wasm2js_i32$3 = i64toi32_i32$0;
   wasm2js_i32$1 = $0;
   wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function $30($0) {
   $0 = $0 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   i64toi32_i32$0 = 0;
   wasm2js_i32$2 = 9;
   wasm2js_i32$3 = i64toi32_i32$0;
   wasm2js_i32$1 = $0;
   wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
   i64toi32_i32$0 = wasm2js_i32$0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function fac($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, $8 = 0, $8$hi = 0, i64toi32_i32$3 = 0, $6 = 0, $6$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$7 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, $7 = 0, i64toi32_i32$5 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  if (($0 | i64toi32_i32$0 | 0 | 0) == (0 | 0)) {
+  if (($0 | $0$hi | 0 | 0) == (0 | 0)) {
    i64toi32_i32$0 = 0;
-   $8 = 1;
-   $8$hi = i64toi32_i32$0;
+   $7 = 1;
   } else {
-   i64toi32_i32$0 = $0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$0 = i64toi32_i32$0;
+   i64toi32_i32$1 = $0$hi;
    i64toi32_i32$2 = $0;
-   i64toi32_i32$3 = 1;
-   i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + 0 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = i64toi32_i32$5;
-   wasm2js_i32$2 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-   wasm2js_i32$3 = i64toi32_i32$5;
+   i64toi32_i32$5 = 1;
+   i64toi32_i32$7 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0) + 0 | 0;
+   i64toi32_i32$7 = $0$hi - i64toi32_i32$7 | 0;
+   wasm2js_i32$2 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+   wasm2js_i32$3 = i64toi32_i32$7;
    wasm2js_i32$1 = 12;
    wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
-   i64toi32_i32$5 = wasm2js_i32$0;
-   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-   $6 = i64toi32_i32$5;
-   $6$hi = i64toi32_i32$2;
-   i64toi32_i32$2 = i64toi32_i32$0;
-   i64toi32_i32$5 = $6$hi;
-   i64toi32_i32$5 = __wasm_i64_mul($0 | 0, i64toi32_i32$0 | 0, $6 | 0, i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$7 = wasm2js_i32$0;
    i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+   i64toi32_i32$2 = __wasm_i64_mul($0 | 0, $0$hi | 0, i64toi32_i32$7 | 0, i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
    i64toi32_i32$2 = i64toi32_i32$2;
-   $8 = i64toi32_i32$5;
-   $8$hi = i64toi32_i32$2;
+   i64toi32_i32$0 = i64toi32_i32$1;
+   $7 = i64toi32_i32$2;
   }
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$5 = $8;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $7;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$1 | 0;
  }
  
  function fib($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, $10 = 0, $10$hi = 0, $5 = 0, $5$hi = 0, $8 = 0, $8$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$8 = 0, i64toi32_i32$7 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$6 = 0, $11 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = 0;
   i64toi32_i32$3 = 1;
-  if (i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0 | ((i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) & i64toi32_i32$2 >>> 0 <= i64toi32_i32$3 >>> 0 | 0) | 0) {
-   i64toi32_i32$2 = 0;
-   $10 = 1;
-   $10$hi = i64toi32_i32$2;
+  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & $0 >>> 0 <= i64toi32_i32$3 >>> 0 | 0) | 0) {
+   i64toi32_i32$0 = 0;
+   $11 = 1;
   } else {
    i64toi32_i32$2 = $0$hi;
-   i64toi32_i32$2 = i64toi32_i32$2;
    i64toi32_i32$3 = $0;
-   i64toi32_i32$0 = 0;
-   i64toi32_i32$1 = 2;
-   i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
-   i64toi32_i32$6 = i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0;
-   i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-   i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = i64toi32_i32$5;
-   wasm2js_i32$2 = i64toi32_i32$4;
-   wasm2js_i32$3 = i64toi32_i32$5;
+   i64toi32_i32$4 = 0;
+   i64toi32_i32$5 = 2;
+   i64toi32_i32$6 = $0 - i64toi32_i32$5 | 0;
+   i64toi32_i32$8 = $0 >>> 0 < i64toi32_i32$5 >>> 0;
+   i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$4 | 0;
+   i64toi32_i32$7 = i64toi32_i32$2 - i64toi32_i32$7 | 0;
+   wasm2js_i32$2 = i64toi32_i32$6;
+   wasm2js_i32$3 = i64toi32_i32$7;
    wasm2js_i32$1 = 13;
    wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0, wasm2js_i32$3 | 0) | 0;
-   i64toi32_i32$5 = wasm2js_i32$0;
+   i64toi32_i32$7 = wasm2js_i32$0;
    i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $5 = i64toi32_i32$5;
-   $5$hi = i64toi32_i32$3;
-   i64toi32_i32$3 = i64toi32_i32$2;
-   i64toi32_i32$3 = i64toi32_i32$2;
-   i64toi32_i32$2 = $0;
+   i64toi32_i32$1 = i64toi32_i32$7;
+   i64toi32_i32$2 = i64toi32_i32$2;
+   i64toi32_i32$7 = $0;
    i64toi32_i32$5 = 0;
-   i64toi32_i32$1 = 1;
-   i64toi32_i32$0 = i64toi32_i32$2 - i64toi32_i32$1 | 0;
-   i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$1 >>> 0;
-   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-   i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   wasm2js_i32$3 = i64toi32_i32$0;
-   wasm2js_i32$2 = i64toi32_i32$4;
+   i64toi32_i32$4 = 1;
+   i64toi32_i32$6 = $0 - i64toi32_i32$4 | 0;
+   i64toi32_i32$8 = ($0 >>> 0 < i64toi32_i32$4 >>> 0) + i64toi32_i32$5 | 0;
+   i64toi32_i32$8 = i64toi32_i32$2 - i64toi32_i32$8 | 0;
+   wasm2js_i32$3 = i64toi32_i32$6;
+   wasm2js_i32$2 = i64toi32_i32$8;
    wasm2js_i32$1 = 13;
    wasm2js_i32$0 = FUNCTION_TABLE_iii[wasm2js_i32$1 & 31](wasm2js_i32$3 | 0, wasm2js_i32$2 | 0) | 0;
-   i64toi32_i32$4 = wasm2js_i32$0;
-   i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-   $8 = i64toi32_i32$4;
-   $8$hi = i64toi32_i32$2;
-   i64toi32_i32$2 = $5$hi;
-   i64toi32_i32$3 = $5;
-   i64toi32_i32$4 = $8$hi;
-   i64toi32_i32$1 = $8;
-   i64toi32_i32$5 = i64toi32_i32$3 + i64toi32_i32$1 | 0;
-   i64toi32_i32$0 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
-   if (i64toi32_i32$5 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   $10 = i64toi32_i32$5;
-   $10$hi = i64toi32_i32$0;
+   i64toi32_i32$8 = wasm2js_i32$0;
+   i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+   i64toi32_i32$8 = i64toi32_i32$8;
+   i64toi32_i32$2 = i64toi32_i32$1 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 + i64toi32_i32$7 | 0;
+   if (i64toi32_i32$2 >>> 0 < i64toi32_i32$8 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
+   i64toi32_i32$1 = i64toi32_i32$2;
+   i64toi32_i32$0 = i64toi32_i32$4;
+   $11 = i64toi32_i32$2;
   }
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$3 = $10;
+  i64toi32_i32$4 = $11;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$4 | 0;
  }
  
  function even($0) {
   $0 = $0 | 0;
-  var $6 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
-  if (($0 | 0) == (0 | 0)) $6 = 44; else {
+  var $1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
+  if (($0 | 0) == (0 | 0)) $1 = 44; else {
    wasm2js_i32$2 = $0 - 1 | 0;
    wasm2js_i32$1 = 15;
    wasm2js_i32$0 = FUNCTION_TABLE_ii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0) | 0;
-   $6 = wasm2js_i32$0;
+   $1 = wasm2js_i32$0;
   }
-  return $6 | 0;
+  return $1 | 0;
  }
  
  function odd($0) {
   $0 = $0 | 0;
-  var $6 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
-  if (($0 | 0) == (0 | 0)) $6 = 99; else {
+  var $1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
+  if (($0 | 0) == (0 | 0)) $1 = 99; else {
    wasm2js_i32$2 = $0 - 1 | 0;
    wasm2js_i32$1 = 14;
    wasm2js_i32$0 = FUNCTION_TABLE_ii[wasm2js_i32$1 & 31](wasm2js_i32$2 | 0) | 0;
-   $6 = wasm2js_i32$0;
+   $1 = wasm2js_i32$0;
   }
-  return $6 | 0;
+  return $1 | 0;
  }
  
  function runaway() {
@@ -441,78 +393,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21_1 = 0, $22_1 = 0, var$6 = 0, $24_1 = 0, $17_1 = 0, $18_1 = 0, $23_1 = 0, $29_1 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16_1 = 0, $17_1 = 0, var$6 = 0, $18_1 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $23_1 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17_1 = Math_imul(var$4, var$5);
-  $18_1 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19_1 = Math_imul(var$4, var$5);
+  $20_1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16_1 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23_1 = $17_1 + Math_imul($18_1, $21_1) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21_1 = $19_1 + Math_imul($20_1, $16_1) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17_1 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29_1 = $23_1 + Math_imul($22_1, var$3) | 0;
+  $22_1 = $21_1 + Math_imul($17_1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45 = $29_1 + (var$2 >>> 16 | 0) | 0;
+  $23_1 = $22_1 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24_1 = 0;
+  i64toi32_i32$4 = $23_1 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18_1 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24_1 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18_1 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24_1;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18_1;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -520,14 +462,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -26,7 +26,6 @@ function asmFunc(global, env, buffer) {
   var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$1 = x;
   i64toi32_i32$0 = i64toi32_i32$1 >> 31 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -34,11 +33,11 @@ function asmFunc(global, env, buffer) {
  
  function $1(x) {
   x = x | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return x | 0;
+  var i64toi32_i32$1 = 0;
+  i64toi32_i32$1 = x;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = 0;
+  return i64toi32_i32$1 | 0;
  }
  
  function $2(x, x$hi) {
@@ -69,61 +68,53 @@ function asmFunc(global, env, buffer) {
  
  function $7(x) {
   x = Math_fround(x);
-  var i64toi32_i32$0 = Math_fround(0), i64toi32_i32$1 = 0, $4_1 = 0, $5_1 = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = Math_fround(0), $3_1 = 0, $4_1 = 0, i64toi32_i32$2 = 0;
   i64toi32_i32$0 = x;
   if (Math_fround(Math_abs(i64toi32_i32$0)) >= Math_fround(1.0)) {
-   if (i64toi32_i32$0 > Math_fround(0.0)) $4_1 = ~~Math_fround(Math_min(Math_fround(Math_floor(Math_fround(i64toi32_i32$0 / Math_fround(4294967296.0)))), Math_fround(Math_fround(4294967296.0) - Math_fround(1.0)))) >>> 0; else $4_1 = ~~Math_fround(Math_ceil(Math_fround(Math_fround(i64toi32_i32$0 - Math_fround(~~i64toi32_i32$0 >>> 0 >>> 0)) / Math_fround(4294967296.0)))) >>> 0;
-   $5_1 = $4_1;
-  } else $5_1 = 0;
-  i64toi32_i32$1 = $5_1;
-  i64toi32_i32$1 = i64toi32_i32$1;
+   if (i64toi32_i32$0 > Math_fround(0.0)) $3_1 = ~~Math_fround(Math_min(Math_fround(Math_floor(Math_fround(i64toi32_i32$0 / Math_fround(4294967296.0)))), Math_fround(Math_fround(4294967296.0) - Math_fround(1.0)))) >>> 0; else $3_1 = ~~Math_fround(Math_ceil(Math_fround(Math_fround(i64toi32_i32$0 - Math_fround(~~i64toi32_i32$0 >>> 0 >>> 0)) / Math_fround(4294967296.0)))) >>> 0;
+   $4_1 = $3_1;
+  } else $4_1 = 0;
   i64toi32_i32$2 = ~~i64toi32_i32$0 >>> 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = $4_1;
   return i64toi32_i32$2 | 0;
  }
  
  function $8(x) {
   x = Math_fround(x);
-  var i64toi32_i32$0 = Math_fround(0), i64toi32_i32$1 = 0, $4_1 = 0, $5_1 = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = Math_fround(0), $3_1 = 0, $4_1 = 0, i64toi32_i32$2 = 0;
   i64toi32_i32$0 = x;
   if (Math_fround(Math_abs(i64toi32_i32$0)) >= Math_fround(1.0)) {
-   if (i64toi32_i32$0 > Math_fround(0.0)) $4_1 = ~~Math_fround(Math_min(Math_fround(Math_floor(Math_fround(i64toi32_i32$0 / Math_fround(4294967296.0)))), Math_fround(Math_fround(4294967296.0) - Math_fround(1.0)))) >>> 0; else $4_1 = ~~Math_fround(Math_ceil(Math_fround(Math_fround(i64toi32_i32$0 - Math_fround(~~i64toi32_i32$0 >>> 0 >>> 0)) / Math_fround(4294967296.0)))) >>> 0;
-   $5_1 = $4_1;
-  } else $5_1 = 0;
-  i64toi32_i32$1 = $5_1;
-  i64toi32_i32$1 = i64toi32_i32$1;
+   if (i64toi32_i32$0 > Math_fround(0.0)) $3_1 = ~~Math_fround(Math_min(Math_fround(Math_floor(Math_fround(i64toi32_i32$0 / Math_fround(4294967296.0)))), Math_fround(Math_fround(4294967296.0) - Math_fround(1.0)))) >>> 0; else $3_1 = ~~Math_fround(Math_ceil(Math_fround(Math_fround(i64toi32_i32$0 - Math_fround(~~i64toi32_i32$0 >>> 0 >>> 0)) / Math_fround(4294967296.0)))) >>> 0;
+   $4_1 = $3_1;
+  } else $4_1 = 0;
   i64toi32_i32$2 = ~~i64toi32_i32$0 >>> 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = $4_1;
   return i64toi32_i32$2 | 0;
  }
  
  function $9(x) {
   x = +x;
-  var i64toi32_i32$0 = 0.0, i64toi32_i32$1 = 0, $4_1 = 0, $5_1 = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0.0, $3_1 = 0, $4_1 = 0, i64toi32_i32$2 = 0;
   i64toi32_i32$0 = x;
   if (Math_abs(i64toi32_i32$0) >= 1.0) {
-   if (i64toi32_i32$0 > 0.0) $4_1 = ~~Math_min(Math_floor(i64toi32_i32$0 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $4_1 = ~~Math_ceil((i64toi32_i32$0 - +(~~i64toi32_i32$0 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
-   $5_1 = $4_1;
-  } else $5_1 = 0;
-  i64toi32_i32$1 = $5_1;
-  i64toi32_i32$1 = i64toi32_i32$1;
+   if (i64toi32_i32$0 > 0.0) $3_1 = ~~Math_min(Math_floor(i64toi32_i32$0 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $3_1 = ~~Math_ceil((i64toi32_i32$0 - +(~~i64toi32_i32$0 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
+   $4_1 = $3_1;
+  } else $4_1 = 0;
   i64toi32_i32$2 = ~~i64toi32_i32$0 >>> 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = $4_1;
   return i64toi32_i32$2 | 0;
  }
  
  function $10(x) {
   x = +x;
-  var i64toi32_i32$0 = 0.0, i64toi32_i32$1 = 0, $4_1 = 0, $5_1 = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$0 = 0.0, $3_1 = 0, $4_1 = 0, i64toi32_i32$2 = 0;
   i64toi32_i32$0 = x;
   if (Math_abs(i64toi32_i32$0) >= 1.0) {
-   if (i64toi32_i32$0 > 0.0) $4_1 = ~~Math_min(Math_floor(i64toi32_i32$0 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $4_1 = ~~Math_ceil((i64toi32_i32$0 - +(~~i64toi32_i32$0 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
-   $5_1 = $4_1;
-  } else $5_1 = 0;
-  i64toi32_i32$1 = $5_1;
-  i64toi32_i32$1 = i64toi32_i32$1;
+   if (i64toi32_i32$0 > 0.0) $3_1 = ~~Math_min(Math_floor(i64toi32_i32$0 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $3_1 = ~~Math_ceil((i64toi32_i32$0 - +(~~i64toi32_i32$0 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
+   $4_1 = $3_1;
+  } else $4_1 = 0;
   i64toi32_i32$2 = ~~i64toi32_i32$0 >>> 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = $4_1;
   return i64toi32_i32$2 | 0;
  }
  
@@ -135,10 +126,7 @@ function asmFunc(global, env, buffer) {
  function $12(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return Math_fround(Math_fround(+(x >>> 0) + 4294967296.0 * +(i64toi32_i32$0 | 0)));
+  return Math_fround(Math_fround(+(x >>> 0) + 4294967296.0 * +(x$hi | 0)));
  }
  
  function $13(x) {
@@ -149,10 +137,7 @@ function asmFunc(global, env, buffer) {
  function $14(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return +(+(x >>> 0) + 4294967296.0 * +(i64toi32_i32$0 | 0));
+  return +(+(x >>> 0) + 4294967296.0 * +(x$hi | 0));
  }
  
  function $15(x) {
@@ -163,10 +148,7 @@ function asmFunc(global, env, buffer) {
  function $16(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return Math_fround(Math_fround(+(x >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0)));
+  return Math_fround(Math_fround(+(x >>> 0) + 4294967296.0 * +(x$hi >>> 0)));
  }
  
  function $17(x) {
@@ -177,10 +159,7 @@ function asmFunc(global, env, buffer) {
  function $18(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return +(+(x >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0));
+  return +(+(x >>> 0) + 4294967296.0 * +(x$hi >>> 0));
  }
  
  function $19(x) {
@@ -201,14 +180,12 @@ function asmFunc(global, env, buffer) {
  function $22(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   wasm2js_i32$0 = 0;
   wasm2js_i32$1 = x;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$0;
+  wasm2js_i32$1 = x$hi;
   HEAP32[(wasm2js_i32$0 + 4 | 0) >> 2] = wasm2js_i32$1;
   return +(+HEAPF64[0 >> 3]);
  }
@@ -220,14 +197,12 @@ function asmFunc(global, env, buffer) {
  
  function $24(x) {
   x = +x;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0;
+  var i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = x;
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$0 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = HEAP32[0 >> 2] | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = HEAP32[(0 + 4 | 0) >> 2] | 0;
   return i64toi32_i32$1 | 0;
  }
  
@@ -44,26 +44,15 @@ function asmFunc(global, env, buffer) {
   address = address | 0;
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $9_1 = 0, $6_1 = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $7_1 = 0, $8_1 = 0, i64toi32_i32$0 = 0;
   i32_store_little(address | 0, value | 0);
-  $6_1 = address + 4 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = value;
-  i64toi32_i32$1 = 0;
+  $8_1 = address + 4 | 0;
+  i64toi32_i32$1 = value$hi;
+  i64toi32_i32$0 = value;
   i64toi32_i32$3 = 32;
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $9_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $9_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i32_store_little($6_1 | 0, $9_1 | 0);
+  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) $7_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0; else $7_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+  i32_store_little($8_1 | 0, $7_1 | 0);
  }
  
  function i16_load_little(address) {
@@ -78,32 +67,27 @@ function asmFunc(global, env, buffer) {
  
  function i64_load_little(address) {
   address = address | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $9_1 = 0, $3 = 0, $3$hi = 0, $8$hi = 0;
-  i64toi32_i32$0 = 0;
-  $3 = i32_load_little(address | 0) | 0;
-  $3$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = i32_load_little(address + 4 | 0 | 0) | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, $8_1 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$2 = i32_load_little(address | 0) | 0;
   i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $9_1 = 0;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$4 = i32_load_little(address + 4 | 0 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$2 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
+   $8_1 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $9_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$6 | 0) | 0;
+   $8_1 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
   }
-  $8$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$0 = $3;
-  i64toi32_i32$2 = $8$hi;
-  i64toi32_i32$3 = $9_1;
-  i64toi32_i32$2 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  i64toi32_i32$2 = $8_1;
+  i64toi32_i32$4 = i64toi32_i32$1 | i64toi32_i32$4 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$2 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
   return i64toi32_i32$0 | 0;
  }
  
@@ -130,13 +114,9 @@ function asmFunc(global, env, buffer) {
   value$hi = value$hi | 0;
   var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i16_store_little(0 | 0, value | 0);
   i64toi32_i32$0 = HEAP16[0 >> 1] | 0;
   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$0 | 0;
@@ -145,17 +125,12 @@ function asmFunc(global, env, buffer) {
  function $10(value, value$hi) {
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i16_store_little(0 | 0, value | 0);
   i64toi32_i32$0 = HEAPU16[0 >> 1] | 0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = 0;
   return i64toi32_i32$0 | 0;
  }
  
@@ -164,13 +139,9 @@ function asmFunc(global, env, buffer) {
   value$hi = value$hi | 0;
   var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i32_store_little(0 | 0, value | 0);
   i64toi32_i32$0 = HEAP32[0 >> 2] | 0;
   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$0 | 0;
@@ -179,35 +150,25 @@ function asmFunc(global, env, buffer) {
  function $12(value, value$hi) {
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i32_store_little(0 | 0, value | 0);
   i64toi32_i32$0 = HEAPU32[0 >> 2] | 0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = 0;
   return i64toi32_i32$0 | 0;
  }
  
  function $13(value, value$hi) {
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, wasm2js_i32$0 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, wasm2js_i32$0 = 0;
   i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64_store_little(0 | 0, value | 0, i64toi32_i32$0 | 0);
   i64toi32_i32$2 = 0;
   i64toi32_i32$0 = HEAPU32[i64toi32_i32$2 >> 2] | 0;
-  i64toi32_i32$1 = (wasm2js_i32$0 = i64toi32_i32$2, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = (wasm2js_i32$0 = i64toi32_i32$2, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
   return i64toi32_i32$0 | 0;
  }
  
@@ -219,13 +180,11 @@ function asmFunc(global, env, buffer) {
  
  function $15(value) {
   value = +value;
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0;
+  var wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = value;
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$0 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64_store_little(0 | 0, HEAP32[0 >> 2] | 0 | 0, i64toi32_i32$0 | 0);
+  i64_store_little(0 | 0, HEAP32[0 >> 2] | 0 | 0, HEAP32[(0 + 4 | 0) >> 2] | 0 | 0);
   return +(+HEAPF64[0 >> 3]);
  }
  
@@ -250,36 +209,26 @@ function asmFunc(global, env, buffer) {
  function $18(value, value$hi) {
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
-  i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   wasm2js_i32$0 = 0;
   wasm2js_i32$1 = value;
   HEAP16[wasm2js_i32$0 >> 1] = wasm2js_i32$1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i16_load_little(0 | 0) | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = 0;
   return i64toi32_i32$1 | 0;
  }
  
  function $19(value, value$hi) {
   value = value | 0;
   value$hi = value$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
-  i64toi32_i32$0 = value$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   wasm2js_i32$0 = 0;
   wasm2js_i32$1 = value;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i32_load_little(0 | 0) | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = 0;
   return i64toi32_i32$1 | 0;
  }
  
@@ -287,23 +236,19 @@ function asmFunc(global, env, buffer) {
   value = value | 0;
   value$hi = value$hi | 0;
   var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
-  i64toi32_i32$0 = value$hi;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  wasm2js_i32$0 = i64toi32_i32$1;
+  i64toi32_i32$0 = 0;
+  i64toi32_i32$1 = value$hi;
+  wasm2js_i32$0 = i64toi32_i32$0;
   wasm2js_i32$1 = value;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-  wasm2js_i32$0 = i64toi32_i32$1;
-  wasm2js_i32$1 = i64toi32_i32$0;
+  wasm2js_i32$0 = i64toi32_i32$0;
+  wasm2js_i32$1 = i64toi32_i32$1;
   (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-  i64toi32_i32$0 = i64_load_little(0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_load_little(0 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
   i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$0 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$1 | 0;
  }
  
  function $21(value) {
@@ -317,18 +262,15 @@ function asmFunc(global, env, buffer) {
  
  function $22(value) {
   value = +value;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
+  var wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = value;
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$0 = i64_load_little(0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$0;
+  wasm2js_i32$1 = i64_load_little(0 | 0) | 0;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$1;
+  wasm2js_i32$1 = i64toi32_i32$HIGH_BITS;
   HEAP32[(wasm2js_i32$0 + 4 | 0) >> 2] = wasm2js_i32$1;
   return +(+HEAPF64[0 >> 3]);
  }
@@ -24,77 +24,66 @@ function asmFunc(global, env, buffer) {
  function $0($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, $8 = 0, $8$hi = 0, $6 = 0, $6$hi = 0;
-  i64toi32_i32$1 = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$7 = 0, i64toi32_i32$0 = 0, $7 = 0, i64toi32_i32$5 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0_1;
   i64toi32_i32$3 = 0;
-  if (($0_1 | 0) == (i64toi32_i32$3 | 0) & ($0$hi | 0) == (i64toi32_i32$1 | 0) | 0) {
-   $8 = 1;
-   $8$hi = 0;
+  if (($0_1 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (0 | 0) | 0) {
+   i64toi32_i32$0 = 0;
+   $7 = 1;
   } else {
+   i64toi32_i32$1 = $0$hi;
    i64toi32_i32$3 = $0_1;
-   i64toi32_i32$1 = 1;
-   i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + 0 | 0;
-   i64toi32_i32$5 = $0$hi - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = i64toi32_i32$5;
-   i64toi32_i32$5 = $0(i64toi32_i32$3 - i64toi32_i32$1 | 0 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $6 = i64toi32_i32$5;
-   $6$hi = i64toi32_i32$3;
-   i64toi32_i32$3 = $0$hi;
-   i64toi32_i32$5 = $6$hi;
-   i64toi32_i32$5 = __wasm_i64_mul($0_1 | 0, $0$hi | 0, $6 | 0, i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$5 = 1;
+   i64toi32_i32$7 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$5 >>> 0) + 0 | 0;
+   i64toi32_i32$7 = i64toi32_i32$1 - i64toi32_i32$7 | 0;
+   i64toi32_i32$7 = $0(i64toi32_i32$3 - i64toi32_i32$5 | 0 | 0, i64toi32_i32$7 | 0) | 0;
    i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+   i64toi32_i32$3 = __wasm_i64_mul($0_1 | 0, i64toi32_i32$1 | 0, i64toi32_i32$7 | 0, i64toi32_i32$3 | 0) | 0;
+   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
    i64toi32_i32$3 = i64toi32_i32$3;
-   $8 = i64toi32_i32$5;
-   $8$hi = i64toi32_i32$3;
+   i64toi32_i32$0 = i64toi32_i32$1;
+   $7 = i64toi32_i32$3;
   }
-  i64toi32_i32$3 = $8$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = $8;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $7;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$1 | 0;
  }
  
  function fac_rec_named(n, n$hi) {
   n = n | 0;
   n$hi = n$hi | 0;
-  var i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, $8 = 0, $8$hi = 0, $6 = 0, $6$hi = 0;
-  i64toi32_i32$1 = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$7 = 0, i64toi32_i32$0 = 0, $7 = 0, i64toi32_i32$5 = 0;
+  i64toi32_i32$1 = n$hi;
+  i64toi32_i32$0 = n;
   i64toi32_i32$3 = 0;
-  if ((n | 0) == (i64toi32_i32$3 | 0) & (n$hi | 0) == (i64toi32_i32$1 | 0) | 0) {
-   $8 = 1;
-   $8$hi = 0;
+  if ((n | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (0 | 0) | 0) {
+   i64toi32_i32$0 = 0;
+   $7 = 1;
   } else {
+   i64toi32_i32$1 = n$hi;
    i64toi32_i32$3 = n;
-   i64toi32_i32$1 = 1;
-   i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + 0 | 0;
-   i64toi32_i32$5 = n$hi - i64toi32_i32$5 | 0;
-   i64toi32_i32$5 = i64toi32_i32$5;
-   i64toi32_i32$5 = fac_rec_named(i64toi32_i32$3 - i64toi32_i32$1 | 0 | 0, i64toi32_i32$5 | 0) | 0;
-   i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
-   $6 = i64toi32_i32$5;
-   $6$hi = i64toi32_i32$3;
-   i64toi32_i32$3 = n$hi;
-   i64toi32_i32$5 = $6$hi;
-   i64toi32_i32$5 = __wasm_i64_mul(n | 0, n$hi | 0, $6 | 0, i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$5 = 1;
+   i64toi32_i32$7 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$5 >>> 0) + 0 | 0;
+   i64toi32_i32$7 = i64toi32_i32$1 - i64toi32_i32$7 | 0;
+   i64toi32_i32$7 = fac_rec_named(i64toi32_i32$3 - i64toi32_i32$5 | 0 | 0, i64toi32_i32$7 | 0) | 0;
    i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+   i64toi32_i32$3 = __wasm_i64_mul(n | 0, i64toi32_i32$1 | 0, i64toi32_i32$7 | 0, i64toi32_i32$3 | 0) | 0;
+   i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
    i64toi32_i32$3 = i64toi32_i32$3;
-   $8 = i64toi32_i32$5;
-   $8$hi = i64toi32_i32$3;
+   i64toi32_i32$0 = i64toi32_i32$1;
+   $7 = i64toi32_i32$3;
   }
-  i64toi32_i32$3 = $8$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = $8;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $7;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  return i64toi32_i32$1 | 0;
  }
  
  function $2($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, $1$hi = 0, $1 = 0, $2$hi = 0, i64toi32_i32$1 = 0, $2_1 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0, $2_1 = 0, $2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   $1 = $0_1;
   $1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -102,30 +91,24 @@ function asmFunc(global, env, buffer) {
   $2$hi = i64toi32_i32$0;
   block : {
    loop_in : do {
-    i64toi32_i32$0 = $1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = $1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = $1$hi;
+    i64toi32_i32$0 = $1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break block; else block0 : {
-     i64toi32_i32$2 = $1$hi;
-     i64toi32_i32$2 = $2$hi;
-     i64toi32_i32$2 = $1$hi;
-     i64toi32_i32$0 = $2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul($1 | 0, i64toi32_i32$2 | 0, $2_1 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     $2_1 = i64toi32_i32$0;
-     $2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = $1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = $1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     $1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break block; else block0 : {
+     i64toi32_i32$0 = $1$hi;
+     i64toi32_i32$1 = $2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul($1 | 0, i64toi32_i32$0 | 0, $2_1 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     $2_1 = i64toi32_i32$1;
+     $2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = $1$hi;
+     i64toi32_i32$0 = $1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     $1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      $1$hi = i64toi32_i32$5;
     };
     continue loop_in;
@@ -133,20 +116,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = $2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = $2_1;
+  i64toi32_i32$0 = $2_1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $3(n, n$hi) {
   n = n | 0;
   n$hi = n$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i$hi = 0, i = 0, res$hi = 0, i64toi32_i32$1 = 0, res = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i = 0, i$hi = 0, i64toi32_i32$2 = 0, res = 0, res$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = n$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i = n;
   i$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -154,30 +133,24 @@ function asmFunc(global, env, buffer) {
   res$hi = i64toi32_i32$0;
   done : {
    loop : do {
-    i64toi32_i32$0 = i$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = i;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = i$hi;
+    i64toi32_i32$0 = i;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break done; else block : {
-     i64toi32_i32$2 = i$hi;
-     i64toi32_i32$2 = res$hi;
-     i64toi32_i32$2 = i$hi;
-     i64toi32_i32$0 = res$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(i | 0, i64toi32_i32$2 | 0, res | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     res = i64toi32_i32$0;
-     res$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = i$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = i;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     i = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break done; else block : {
+     i64toi32_i32$0 = i$hi;
+     i64toi32_i32$1 = res$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(i | 0, i64toi32_i32$0 | 0, res | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     res = i64toi32_i32$1;
+     res$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = i$hi;
+     i64toi32_i32$0 = i;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     i = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      i$hi = i64toi32_i32$5;
     };
     continue loop;
@@ -185,64 +158,54 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = res$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = res;
+  i64toi32_i32$0 = res;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $4($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, $1$hi = 0, $1 = 0, $10 = 0, $11 = 0, $12 = 0, i64toi32_i32$4 = 0, $13 = 0, $14 = 0, $15 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, $1 = 0, $1$hi = 0, i64toi32_i32$3 = 0, $10 = 0, $11 = 0, $12 = 0, i64toi32_i32$4 = 0, $13 = 0, $14 = 0, $15 = 0;
   i64toi32_i32$0 = 0;
   $1 = 1;
   $1$hi = i64toi32_i32$0;
   block : {
-   i64toi32_i32$0 = $0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = $0_1;
-   i64toi32_i32$1 = 0;
+   i64toi32_i32$1 = $0$hi;
+   i64toi32_i32$0 = $0_1;
+   i64toi32_i32$2 = 0;
    i64toi32_i32$3 = 2;
-   if ((i64toi32_i32$0 | 0) < (i64toi32_i32$1 | 0)) $10 = 1; else {
-    if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-     if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$3 >>> 0) $11 = 0; else $11 = 1;
+   if ((i64toi32_i32$1 | 0) < (i64toi32_i32$2 | 0)) $10 = 1; else {
+    if ((i64toi32_i32$1 | 0) <= (i64toi32_i32$2 | 0)) {
+     if (i64toi32_i32$0 >>> 0 >= i64toi32_i32$3 >>> 0) $11 = 0; else $11 = 1;
      $12 = $11;
     } else $12 = 0;
     $10 = $12;
    }
    if ($10) break block;
    loop_in : do {
-    i64toi32_i32$2 = $1$hi;
-    i64toi32_i32$2 = $0$hi;
-    i64toi32_i32$2 = $1$hi;
-    i64toi32_i32$0 = $0$hi;
-    i64toi32_i32$0 = __wasm_i64_mul($1 | 0, i64toi32_i32$2 | 0, $0_1 | 0, i64toi32_i32$0 | 0) | 0;
-    i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    $1 = i64toi32_i32$0;
-    $1$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = $0$hi;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    i64toi32_i32$3 = $0_1;
-    i64toi32_i32$0 = 4294967295;
-    i64toi32_i32$1 = 4294967295;
-    i64toi32_i32$4 = $0_1 + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
+    i64toi32_i32$0 = $1$hi;
+    i64toi32_i32$1 = $0$hi;
+    i64toi32_i32$1 = __wasm_i64_mul($1 | 0, i64toi32_i32$0 | 0, $0_1 | 0, i64toi32_i32$1 | 0) | 0;
+    i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+    $1 = i64toi32_i32$1;
+    $1$hi = i64toi32_i32$0;
+    i64toi32_i32$1 = $0$hi;
+    i64toi32_i32$0 = $0_1;
+    i64toi32_i32$3 = 4294967295;
+    i64toi32_i32$2 = 4294967295;
+    i64toi32_i32$4 = i64toi32_i32$0 + i64toi32_i32$2 | 0;
+    i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$3 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$2 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
     $0_1 = i64toi32_i32$4;
     $0$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    i64toi32_i32$2 = $0_1;
-    i64toi32_i32$3 = 0;
-    i64toi32_i32$1 = 1;
-    if ((i64toi32_i32$5 | 0) > (i64toi32_i32$3 | 0)) $13 = 1; else {
-     if ((i64toi32_i32$5 | 0) >= (i64toi32_i32$3 | 0)) {
-      if (i64toi32_i32$2 >>> 0 <= i64toi32_i32$1 >>> 0) $14 = 0; else $14 = 1;
+    i64toi32_i32$0 = i64toi32_i32$5;
+    i64toi32_i32$5 = $0_1;
+    i64toi32_i32$1 = 0;
+    i64toi32_i32$2 = 1;
+    if ((i64toi32_i32$0 | 0) > (i64toi32_i32$1 | 0)) $13 = 1; else {
+     if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
+      if (i64toi32_i32$5 >>> 0 <= i64toi32_i32$2 >>> 0) $14 = 0; else $14 = 1;
       $15 = $14;
      } else $15 = 0;
      $13 = $15;
@@ -251,13 +214,10 @@ function asmFunc(global, env, buffer) {
     break loop_in;
    } while (1);
   };
-  i64toi32_i32$2 = $1$hi;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$5 = $1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$5 = $1$hi;
+  i64toi32_i32$0 = $1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0, var$0$hi, var$1, var$1$hi) {
@@ -265,78 +225,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16 = 0, $17 = 0, var$6 = 0, $18 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $23 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19 = Math_imul(var$4, var$5);
+  $20 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23 = $17 + Math_imul($18, $21) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21 = $19 + Math_imul($20, $16) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $22 = $21 + Math_imul($17, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45 = $29 + (var$2 >>> 16 | 0) | 0;
+  $23 = $22 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
+  i64toi32_i32$4 = $23 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -344,14 +294,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -140,40 +140,30 @@ function asmFunc(global, env, buffer) {
  function $21(x, y) {
   x = +x;
   y = +y;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $4_1 = 0, $4$hi = 0, $7_1 = 0, $7$hi = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = x;
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$0 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = HEAP32[0 >> 2] | 0;
-  i64toi32_i32$1 = 2147483647;
-  i64toi32_i32$3 = 4294967295;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  $4_1 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  $4$hi = i64toi32_i32$1;
+  i64toi32_i32$2 = HEAP32[(0 + 4 | 0) >> 2] | 0;
+  i64toi32_i32$1 = HEAP32[0 >> 2] | 0;
+  i64toi32_i32$3 = 2147483647;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = y;
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$1 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = HEAP32[0 >> 2] | 0;
-  i64toi32_i32$2 = 2147483648;
-  i64toi32_i32$3 = 0;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$2 | 0;
-  $7_1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $4$hi;
-  i64toi32_i32$1 = $4_1;
-  i64toi32_i32$0 = $7$hi;
-  i64toi32_i32$3 = $7_1;
-  i64toi32_i32$0 = i64toi32_i32$2 | i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = HEAP32[(0 + 4 | 0) >> 2] | 0;
+  i64toi32_i32$1 = HEAP32[0 >> 2] | 0;
+  i64toi32_i32$4 = 2147483648;
+  i64toi32_i32$4 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = i64toi32_i32$1 & 0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 | i64toi32_i32$4 | 0;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  wasm2js_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$0;
+  wasm2js_i32$1 = i64toi32_i32$4;
   HEAP32[(wasm2js_i32$0 + 4 | 0) >> 2] = wasm2js_i32$1;
   return +(+HEAPF64[0 >> 3]);
  }
@@ -220,7 +210,7 @@ function asmFunc(global, env, buffer) {
    if (var$2 > Math_fround(.5)) return Math_fround(var$0);
    var$2 = Math_fround(var$1 * Math_fround(.5));
    var$1 = (wasm2js_f32$0 = var$1, wasm2js_f32$1 = var$0, wasm2js_i32$0 = Math_fround(var$2 - Math_fround(Math_floor(var$2))) == Math_fround(0.0), wasm2js_i32$0 ? wasm2js_f32$0 : wasm2js_f32$1);
-  };
+  }
   return Math_fround(var$1);
  }
  
@@ -234,7 +224,7 @@ function asmFunc(global, env, buffer) {
    if (var$2 > .5) return +var$0;
    var$2 = var$1 * .5;
    var$1 = (wasm2js_f64$0 = var$1, wasm2js_f64$1 = var$0, wasm2js_i32$0 = var$2 - Math_floor(var$2) == 0.0, wasm2js_i32$0 ? wasm2js_f64$0 : wasm2js_f64$1);
-  };
+  }
   return +var$1;
  }
  
@@ -23,16 +23,16 @@ function asmFunc(global, env, buffer) {
  var i64toi32_i32$HIGH_BITS = 0;
  function even(n) {
   n = n | 0;
-  var $6 = 0;
-  if ((n | 0) == (0 | 0)) $6 = 1; else $6 = odd(n - 1 | 0 | 0) | 0;
-  return $6 | 0;
+  var $1 = 0;
+  if ((n | 0) == (0 | 0)) $1 = 1; else $1 = odd(n - 1 | 0 | 0) | 0;
+  return $1 | 0;
  }
  
  function odd(n) {
   n = n | 0;
-  var $6 = 0;
-  if ((n | 0) == (0 | 0)) $6 = 0; else $6 = even(n - 1 | 0 | 0) | 0;
-  return $6 | 0;
+  var $1 = 0;
+  if ((n | 0) == (0 | 0)) $1 = 0; else $1 = even(n - 1 | 0 | 0) | 0;
+  return $1 | 0;
  }
  
  return {
@@ -133,10 +133,8 @@ function asmFunc(global, env, buffer) {
  }
  
  function $24() {
-  var i64toi32_i32$0 = 0, $0$hi = 0, $0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  var $0$hi = 0, $0 = 0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0 | 0;
  }
  
@@ -156,10 +154,8 @@ function asmFunc(global, env, buffer) {
  }
  
  function $28() {
-  var i64toi32_i32$0 = 0, $1$hi = 0, $1_1 = 0;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  var $1$hi = 0, $1_1 = 0;
+  i64toi32_i32$HIGH_BITS = $1$hi;
   return $1_1 | 0;
  }
  
@@ -174,9 +170,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $31() {
-  var i64toi32_i32$0 = 0, $4 = 0.0, $0 = Math_fround(0), x = 0, $2$hi = 0, $2_1 = 0, $3 = 0, $5_1 = 0;
-  i64toi32_i32$0 = $2$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var $4 = 0.0, $0 = Math_fround(0), x = 0, $2_1 = 0, $2$hi = 0, $3 = 0, $5_1 = 0;
   return +$4;
  }
  
@@ -191,10 +185,7 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0 | 0;
  }
  
@@ -221,10 +212,7 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $1$hi;
   return $1_1 | 0;
  }
  
@@ -248,9 +236,6 @@ function asmFunc(global, env, buffer) {
   $3 = $3 | 0;
   $4 = +$4;
   $5_1 = $5_1 | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   return +$4;
  }
  
@@ -331,17 +316,14 @@ function asmFunc(global, env, buffer) {
  }
  
  function $57() {
-  var i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0;
+  var i64toi32_i32$0 = 0, $1_1 = 0;
   fake_return_waka123 : {
    i64toi32_i32$0 = 0;
-   $0 = 7979;
-   $0$hi = i64toi32_i32$0;
+   $1_1 = 7979;
    break fake_return_waka123;
   };
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return $0 | 0;
+  return $1_1 | 0;
  }
  
  function $58() {
@@ -363,13 +345,13 @@ function asmFunc(global, env, buffer) {
  }
  
  function $60() {
-  var $2_1 = 0;
+  var $0 = 0;
   fake_return_waka123 : {
    dummy();
-   $2_1 = 77;
+   $0 = 77;
    break fake_return_waka123;
   };
-  return $2_1 | 0;
+  return $0 | 0;
  }
  
  function $61($0) {
@@ -378,13 +360,13 @@ function asmFunc(global, env, buffer) {
  
  function $62($0) {
   $0 = $0 | 0;
-  var $2_1 = 0;
+  var $1_1 = 0;
   fake_return_waka123 : {
-   $2_1 = 50;
+   $1_1 = 50;
    if ($0) break fake_return_waka123;
-   $2_1 = 51;
+   $1_1 = 51;
   };
-  return $2_1 | 0;
+  return $1_1 | 0;
  }
  
  function $63($0) {
@@ -393,9 +375,9 @@ function asmFunc(global, env, buffer) {
  
  function $64($0) {
   $0 = $0 | 0;
-  var $3 = 0;
+  var $1_1 = 0;
   fake_return_waka123 : {
-   $3 = 50;
+   $1_1 = 50;
    switch ($0 | 0) {
    case 0:
     break fake_return_waka123;
@@ -403,7 +385,7 @@ function asmFunc(global, env, buffer) {
     break fake_return_waka123;
    };
   };
-  return $3 | 0;
+  return $1_1 | 0;
  }
  
  function $65($0) {
@@ -412,12 +394,12 @@ function asmFunc(global, env, buffer) {
  
  function $66($0) {
   $0 = $0 | 0;
-  var $2_1 = 0, $3 = 0, $4 = 0;
+  var $1_1 = 0, $2_1 = 0, $3 = 0;
   fake_return_waka123 : {
    block : {
-    $2_1 = 50;
-    $3 = $2_1;
-    $4 = $2_1;
+    $1_1 = 50;
+    $2_1 = $1_1;
+    $3 = $1_1;
     switch ($0 | 0) {
     case 0:
      break block;
@@ -427,9 +409,9 @@ function asmFunc(global, env, buffer) {
      break block;
     };
    };
-   $4 = $3 + 2 | 0;
+   $3 = $2_1 + 2 | 0;
   };
-  return $4 | 0;
+  return $3 | 0;
  }
  
  function $67() {
@@ -438,10 +420,8 @@ function asmFunc(global, env, buffer) {
  }
  
  function $68() {
-  var i64toi32_i32$0 = 0, $0$hi = 0, $0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  var $0$hi = 0, $0 = 0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0 | 0;
  }
  
@@ -29,16 +29,13 @@ function asmFunc(global, env, buffer) {
   $0 = $0 | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, $9$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = r$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$1 = $0;
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  $9$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = r$hi;
-  i64toi32_i32$0 = $9$hi;
-  return ($0 | 0) == (r | 0) & (i64toi32_i32$0 | 0) == (r$hi | 0) | 0 | 0;
+  i64toi32_i32$1 = i64toi32_i32$0;
+  i64toi32_i32$0 = $0;
+  return (i64toi32_i32$0 | 0) == (r | 0) & (i64toi32_i32$1 | 0) == (r$hi | 0) | 0 | 0;
  }
  
  return {
@@ -27,10 +27,8 @@ function asmFunc(global, env, buffer) {
  }
  
  function $1() {
-  var i64toi32_i32$0 = 0, $0$hi = 0, $0_1 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  var $0$hi = 0, $0_1 = 0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0_1 | 0;
  }
  
@@ -52,10 +50,7 @@ function asmFunc(global, env, buffer) {
  function $5($0_1, $0$hi) {
   $0_1 = $0_1 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = $0$hi;
   return $0_1 | 0;
  }
  
@@ -78,11 +73,8 @@ function asmFunc(global, env, buffer) {
   $4_1 = $4_1 | 0;
   var i64toi32_i32$0 = 0, $5_1 = Math_fround(0), $6$hi = 0, $6_1 = 0, $7$hi = 0, $7_1 = 0, $8_1 = 0.0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = $6$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = $7$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
  }
  
  function $9($0_1, $0$hi, $1_1, $2_1, $3_1, $4_1) {
@@ -92,21 +84,18 @@ function asmFunc(global, env, buffer) {
   $2_1 = +$2_1;
   $3_1 = $3_1 | 0;
   $4_1 = $4_1 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $6$hi = 0, $10 = 0.0, $21 = 0.0, $7$hi = 0, $7_1 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $6$hi = 0, $11 = 0.0, $12 = 0.0, $7$hi = 0, $7_1 = 0;
   i64toi32_i32$0 = 0;
   $6$hi = i64toi32_i32$0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = $0_1;
-  $10 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
+  $11 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
   i64toi32_i32$0 = $6$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = 6;
-  $21 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
+  $12 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
   i64toi32_i32$0 = $7$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = $7_1;
-  return +($10 + (+$1_1 + ($2_1 + (+($3_1 >>> 0) + (+($4_1 | 0) + (+Math_fround(5.5) + ($21 + (+(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0) + 8.0))))))));
+  return +($11 + (+$1_1 + ($2_1 + (+($3_1 >>> 0) + (+($4_1 | 0) + (+Math_fround(5.5) + ($12 + (+(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0) + 8.0))))))));
  }
  
  return {
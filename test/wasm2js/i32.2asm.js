@@ -199,10 +199,10 @@ function asmFunc(global, env, buffer) {
  
  function __wasm_popcnt_i32(var$0) {
   var$0 = var$0 | 0;
-  var var$1 = 0, $5_1 = 0;
+  var var$1 = 0, $2_1 = 0;
   label$1 : {
    label$2 : do {
-    $5_1 = var$1;
+    $2_1 = var$1;
     if ((var$0 | 0) == (0 | 0)) break label$1;
     var$0 = var$0 & (var$0 - 1 | 0) | 0;
     var$1 = var$1 + 1 | 0;
@@ -210,7 +210,7 @@ function asmFunc(global, env, buffer) {
     break label$2;
    } while (1);
   };
-  return $5_1 | 0;
+  return $2_1 | 0;
  }
  
  function __wasm_rotl_i32(var$0, var$1) {
@@ -24,74 +24,57 @@ function asmFunc(global, env, buffer) {
  function popcnt64($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = __wasm_popcnt_i64($0 | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function ctz64($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = __wasm_ctz_i64($0 | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, $10 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   if (((var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0) == (0 | 0)) {
-   i64toi32_i32$0 = var$0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = var$0;
-   i64toi32_i32$1 = 4294967295;
-   i64toi32_i32$3 = 4294967295;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$2 = i64toi32_i32$2;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) $10 = Math_clz32(i64toi32_i32$0) + 32 | 0; else $10 = i64toi32_i32$3;
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
+   i64toi32_i32$1 = 0;
    i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
+   i64toi32_i32$4 = var$0$hi;
+   i64toi32_i32$3 = var$0;
+   i64toi32_i32$6 = 4294967295;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 4294967295 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$7;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$4 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$8 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$2 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$8 = 0;
+   if ((i64toi32_i32$4 | 0) == (32 | 0)) $10 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $10 = i64toi32_i32$4;
    i64toi32_i32$3 = $10;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   i64toi32_i32$0 = i64toi32_i32$1;
+   i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2;
    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$4 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$4 | 0;
@@ -100,57 +83,42 @@ function asmFunc(global, env, buffer) {
  function __wasm_popcnt_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, var$1$hi = 0, var$1 = 0, $5 = 0, $5$hi = 0, $4 = 0, $9$hi = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$6 = 0, i64toi32_i32$0 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$1$hi = 0, var$1 = 0, $11 = 0, i64toi32_i32$1 = 0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    $4 = (var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0);
-    i64toi32_i32$0 = var$1$hi;
-    $5 = var$1;
-    $5$hi = i64toi32_i32$0;
-    if ($4) break label$1;
-    i64toi32_i32$0 = $5$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
+    i64toi32_i32$2 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$1 = i64toi32_i32$2;
+    i64toi32_i32$3 = var$0$hi;
+    $11 = i64toi32_i32$0;
+    if ((var$0 | i64toi32_i32$3 | 0 | 0) == (0 | 0)) break label$1;
     i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$0;
     i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = 0;
-    i64toi32_i32$3 = 1;
-    i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-    i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    $9$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$2;
-    i64toi32_i32$2 = $9$hi;
-    i64toi32_i32$3 = i64toi32_i32$4;
-    i64toi32_i32$2 = i64toi32_i32$5 & i64toi32_i32$2 | 0;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
-    var$0$hi = i64toi32_i32$2;
+    i64toi32_i32$4 = i64toi32_i32$0;
+    i64toi32_i32$3 = i64toi32_i32$2;
+    i64toi32_i32$6 = 1;
+    i64toi32_i32$8 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$6 >>> 0) + 0 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+    i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$6 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 & i64toi32_i32$8 | 0;
+    var$0 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
+    var$0$hi = i64toi32_i32$8;
     i64toi32_i32$2 = var$1$hi;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    i64toi32_i32$5 = var$1;
+    i64toi32_i32$8 = var$1;
     i64toi32_i32$0 = 0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$1 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
-    i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
-    i64toi32_i32$4 = i64toi32_i32$4;
-    var$1 = i64toi32_i32$1;
-    var$1$hi = i64toi32_i32$4;
+    i64toi32_i32$4 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+    i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+    var$1 = i64toi32_i32$4;
+    var$1$hi = i64toi32_i32$6;
     continue label$2;
     break label$2;
    } while (1);
   };
-  i64toi32_i32$4 = $5$hi;
-  i64toi32_i32$4 = i64toi32_i32$4;
-  i64toi32_i32$5 = $5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = $11;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$6 | 0;
  }
  
  return {
@@ -30,11 +30,7 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return ($0 | 0) == ($1_1 | 0) & (i64toi32_i32$0 | 0) == ($1$hi | 0) | 0 | 0;
+  return ($0 | 0) == ($1_1 | 0) & ($0$hi | 0) == ($1$hi | 0) | 0 | 0;
  }
  
  function $2($0, $0$hi, $1_1, $1$hi) {
@@ -42,11 +38,7 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return ($0 | 0) != ($1_1 | 0) | (i64toi32_i32$0 | 0) != ($1$hi | 0) | 0 | 0;
+  return ($0 | 0) != ($1_1 | 0) | ($0$hi | 0) != ($1$hi | 0) | 0 | 0;
  }
  
  function $3($0, $0$hi, $1_1, $1$hi) {
@@ -54,16 +46,14 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  if ((i64toi32_i32$0 | 0) > ($1$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) > (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) >= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -76,16 +66,14 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  if ((i64toi32_i32$0 | 0) > ($1$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 <= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) > (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) >= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 <= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -98,16 +86,14 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  if ((i64toi32_i32$0 | 0) < ($1$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 > i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) < (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) <= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 > i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -120,16 +106,14 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$0 = $0;
+  i64toi32_i32$2 = $1$hi;
   i64toi32_i32$3 = $1_1;
-  if ((i64toi32_i32$0 | 0) < ($1$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) < (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) <= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 >= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -142,11 +126,10 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return i64toi32_i32$0 >>> 0 > $1$hi >>> 0 | ((i64toi32_i32$0 | 0) == ($1$hi | 0) & $0 >>> 0 >= $1_1 >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  return i64toi32_i32$1 >>> 0 > i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & $0 >>> 0 >= $1_1 >>> 0 | 0) | 0 | 0;
  }
  
  function $8($0, $0$hi, $1_1, $1$hi) {
@@ -154,11 +137,10 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return i64toi32_i32$0 >>> 0 > $1$hi >>> 0 | ((i64toi32_i32$0 | 0) == ($1$hi | 0) & $0 >>> 0 > $1_1 >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  return i64toi32_i32$1 >>> 0 > i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & $0 >>> 0 > $1_1 >>> 0 | 0) | 0 | 0;
  }
  
  function $9($0, $0$hi, $1_1, $1$hi) {
@@ -166,11 +148,10 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return i64toi32_i32$0 >>> 0 < $1$hi >>> 0 | ((i64toi32_i32$0 | 0) == ($1$hi | 0) & $0 >>> 0 <= $1_1 >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  return i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & $0 >>> 0 <= $1_1 >>> 0 | 0) | 0 | 0;
  }
  
  function $10($0, $0$hi, $1_1, $1$hi) {
@@ -178,11 +159,10 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   $1_1 = $1_1 | 0;
   $1$hi = $1$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  return i64toi32_i32$0 >>> 0 < $1$hi >>> 0 | ((i64toi32_i32$0 | 0) == ($1$hi | 0) & $0 >>> 0 < $1_1 >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  return i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & $0 >>> 0 < $1_1 >>> 0 | 0) | 0 | 0;
  }
  
  return {
@@ -0,0 +1,279 @@
+function asmFunc(global, env, buffer) {
+ "use asm";
+ var HEAP8 = new global.Int8Array(buffer);
+ var HEAP16 = new global.Int16Array(buffer);
+ var HEAP32 = new global.Int32Array(buffer);
+ var HEAPU8 = new global.Uint8Array(buffer);
+ var HEAPU16 = new global.Uint16Array(buffer);
+ var HEAPU32 = new global.Uint32Array(buffer);
+ var HEAPF32 = new global.Float32Array(buffer);
+ var HEAPF64 = new global.Float64Array(buffer);
+ var Math_imul = global.Math.imul;
+ var Math_fround = global.Math.fround;
+ var Math_abs = global.Math.abs;
+ var Math_clz32 = global.Math.clz32;
+ var Math_min = global.Math.min;
+ var Math_max = global.Math.max;
+ var Math_floor = global.Math.floor;
+ var Math_ceil = global.Math.ceil;
+ var Math_sqrt = global.Math.sqrt;
+ var abort = env.abort;
+ var nan = global.NaN;
+ var infinity = global.Infinity;
+ var i64toi32_i32$HIGH_BITS = 0;
+ function take($0, $0$hi, $1_1, $1$hi) {
+  $0 = $0 | 0;
+  $0$hi = $0$hi | 0;
+  $1_1 = $1_1 | 0;
+  $1$hi = $1$hi | 0;
+  i64toi32_i32$HIGH_BITS = $1$hi;
+  return $1_1 | 0;
+ }
+ 
+ function $1(x, x$hi, y, y$hi) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  y = y | 0;
+  y$hi = y$hi | 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$7 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, $11 = 0, i64toi32_i32$1 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$4 = y$hi;
+  i64toi32_i32$3 = y;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$6 = 1;
+  i64toi32_i32$7 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 << i64toi32_i32$7 | 0;
+   $11 = 0;
+  } else {
+   i64toi32_i32$5 = ((1 << i64toi32_i32$7 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$7 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$7 | 0) | 0;
+   $11 = i64toi32_i32$3 << i64toi32_i32$7 | 0;
+  }
+  i64toi32_i32$3 = y$hi;
+  i64toi32_i32$4 = y;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$4 = i64toi32_i32$4;
+  i64toi32_i32$6 = $11 + i64toi32_i32$4 | 0;
+  i64toi32_i32$7 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
+  if (i64toi32_i32$6 >>> 0 < i64toi32_i32$4 >>> 0) i64toi32_i32$7 = i64toi32_i32$7 + 1 | 0;
+  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$6 | 0;
+  i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$7 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$5;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+  return i64toi32_i32$5 | 0;
+ }
+ 
+ function $2(x, x$hi, y, y$hi, c) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  y = y | 0;
+  y$hi = y$hi | 0;
+  c = c | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
+  i64toi32_i32$2 = x$hi;
+  i64toi32_i32$3 = y$hi;
+  i64toi32_i32$4 = c;
+  i64toi32_i32$2 = (wasm2js_i32$0 = i64toi32_i32$2, wasm2js_i32$1 = i64toi32_i32$3, wasm2js_i32$2 = i64toi32_i32$4, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$3 = (wasm2js_i32$0 = x, wasm2js_i32$1 = y, wasm2js_i32$2 = i64toi32_i32$4, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$3 | 0;
+ }
+ 
+ function $3(x, x$hi, y, y$hi) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  y = y | 0;
+  y$hi = y$hi | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$7 = 0, i64toi32_i32$8 = 0, i64toi32_i32$6 = 0, $13 = 0, $14 = 0, $15 = 0, i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
+  i64toi32_i32$3 = x$hi;
+  i64toi32_i32$2 = x;
+  i64toi32_i32$4 = y$hi;
+  i64toi32_i32$5 = y;
+  i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$5 | 0;
+  i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$4 | 0;
+  if (i64toi32_i32$6 >>> 0 < i64toi32_i32$5 >>> 0) i64toi32_i32$7 = i64toi32_i32$7 + 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$6;
+  i64toi32_i32$3 = x$hi;
+  i64toi32_i32$2 = x;
+  i64toi32_i32$5 = y$hi;
+  i64toi32_i32$4 = y;
+  i64toi32_i32$6 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$4 >>> 0) + i64toi32_i32$5 | 0;
+  i64toi32_i32$8 = i64toi32_i32$3 - i64toi32_i32$8 | 0;
+  i64toi32_i32$1 = i64toi32_i32$6;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$2 = i64toi32_i32$2;
+  i64toi32_i32$4 = i64toi32_i32$5;
+  i64toi32_i32$5 = y;
+  if ((i64toi32_i32$3 | 0) < (i64toi32_i32$4 | 0)) $13 = 1; else {
+   if ((i64toi32_i32$3 | 0) <= (i64toi32_i32$4 | 0)) {
+    if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$5 >>> 0) $14 = 0; else $14 = 1;
+    $15 = $14;
+   } else $15 = 0;
+   $13 = $15;
+  }
+  i64toi32_i32$2 = $13;
+  i64toi32_i32$7 = (wasm2js_i32$0 = i64toi32_i32$7, wasm2js_i32$1 = i64toi32_i32$8, wasm2js_i32$2 = i64toi32_i32$2, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$8 = (wasm2js_i32$0 = i64toi32_i32$0, wasm2js_i32$1 = i64toi32_i32$1, wasm2js_i32$2 = i64toi32_i32$2, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$7;
+  return i64toi32_i32$8 | 0;
+ }
+ 
+ function $4(x, x$hi, c) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  c = c | 0;
+  var i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, $9 = 0, i64toi32_i32$7 = 0, i64toi32_i32$2 = 0;
+  b : {
+   i64toi32_i32$4 = x$hi;
+   i64toi32_i32$3 = x;
+   i64toi32_i32$6 = 1;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 0 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$8;
+   $9 = i64toi32_i32$7;
+   if (c) break b;
+   i64toi32_i32$3 = 0;
+   i64toi32_i32$4 = $9 + i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$8 + 1 | 0;
+   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$6;
+   $9 = i64toi32_i32$4;
+  };
+  i64toi32_i32$6 = $9;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$6 | 0;
+ }
+ 
+ function $5(x, x$hi, c) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  c = c | 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$6 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, $9 = 0;
+  b : {
+   if (c) {
+    i64toi32_i32$0 = x;
+    i64toi32_i32$2 = 0;
+    i64toi32_i32$3 = 1;
+    i64toi32_i32$4 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+    i64toi32_i32$5 = x$hi + i64toi32_i32$2 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
+    $9 = i64toi32_i32$4;
+    break b;
+   }
+   i64toi32_i32$0 = x;
+   i64toi32_i32$3 = 0;
+   i64toi32_i32$2 = 1;
+   i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
+   i64toi32_i32$6 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = x$hi - i64toi32_i32$6 | 0;
+   i64toi32_i32$0 = i64toi32_i32$4;
+   i64toi32_i32$5 = i64toi32_i32$6;
+   $9 = i64toi32_i32$0;
+   break b;
+  };
+  i64toi32_i32$6 = $9;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$6 | 0;
+ }
+ 
+ function $6(x, x$hi, c) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  c = c | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, $8_1 = 0;
+  if (c) abort(); else {
+   i64toi32_i32$2 = x$hi;
+   i64toi32_i32$1 = x;
+   i64toi32_i32$4 = 1;
+   i64toi32_i32$6 = (i64toi32_i32$1 >>> 0 < i64toi32_i32$4 >>> 0) + 0 | 0;
+   i64toi32_i32$6 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+   $8_1 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+  }
+  i64toi32_i32$0 = $8_1;
+  i64toi32_i32$1 = 4294967295;
+  i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = i64toi32_i32$6 ^ i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$0 | 0;
+ }
+ 
+ function $7(x, x$hi) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$6 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, $8_1 = 0, i64toi32_i32$4 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  i64toi32_i32$0 = 8;
+  i64toi32_i32$1 = x$hi;
+  wasm2js_i32$0 = i64toi32_i32$0;
+  wasm2js_i32$1 = x;
+  HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
+  wasm2js_i32$0 = i64toi32_i32$0;
+  wasm2js_i32$1 = i64toi32_i32$1;
+  (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
+  i64toi32_i32$1 = 4 + 4 | 0;
+  $8_1 = i64toi32_i32$1;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$5 = 8;
+  i64toi32_i32$3 = HEAPU32[i64toi32_i32$5 >> 2] | 0;
+  i64toi32_i32$4 = (wasm2js_i32$0 = i64toi32_i32$5, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
+  i64toi32_i32$6 = x$hi + i64toi32_i32$4 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+  wasm2js_i32$0 = $8_1;
+  wasm2js_i32$1 = i64toi32_i32$5;
+  HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
+  wasm2js_i32$0 = i64toi32_i32$1;
+  wasm2js_i32$1 = i64toi32_i32$6;
+  (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
+  i64toi32_i32$0 = 8;
+  i64toi32_i32$6 = HEAPU32[i64toi32_i32$0 >> 2] | 0;
+  i64toi32_i32$1 = (wasm2js_i32$0 = i64toi32_i32$0, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
+  i64toi32_i32$6 = i64toi32_i32$6;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$6 | 0;
+ }
+ 
+ function $8(x, x$hi, c) {
+  x = x | 0;
+  x$hi = x$hi | 0;
+  c = c | 0;
+  var i64toi32_i32$6 = 0, i64toi32_i32$5 = 0, $5_1 = 0, $6_1 = 0;
+  if (c) abort();
+  $5_1 = x;
+  $6_1 = x$hi;
+  i64toi32_i32$5 = x + x | 0;
+  i64toi32_i32$6 = x$hi + x$hi | 0;
+  if (i64toi32_i32$5 >>> 0 < x >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+  i64toi32_i32$6 = take($5_1 | 0, $6_1 | 0, i64toi32_i32$5 | 0, i64toi32_i32$6 | 0) | 0;
+  i64toi32_i32$6 = i64toi32_i32$6;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
+  return i64toi32_i32$6 | 0;
+ }
+ 
+ return {
+  add_nested: $1, 
+  select: $2, 
+  select_nested: $3, 
+  br_if_value: $4, 
+  br_values: $5, 
+  if_unreachable_arm: $6, 
+  store_nested: $7, 
+  call_unreachable_operand: $8
+ };
+}
+
+const memasmFunc = new ArrayBuffer(65536);
+const retasmFunc = asmFunc({Math,Int8Array,Uint8Array,Int16Array,Uint16Array,Int32Array,Uint32Array,Float32Array,Float64Array,NaN,Infinity}, {abort:function() { throw new Error('abort'); }},memasmFunc);
+export const add_nested = retasmFunc.add_nested;
+export const select = retasmFunc.select;
+export const select_nested = retasmFunc.select_nested;
+export const br_if_value = retasmFunc.br_if_value;
+export const br_values = retasmFunc.br_values;
+export const if_unreachable_arm = retasmFunc.if_unreachable_arm;
+export const store_nested = retasmFunc.store_nested;
+export const call_unreachable_operand = retasmFunc.call_unreachable_operand;
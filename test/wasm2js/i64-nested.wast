@@ -0,0 +1,80 @@
+;; Testing i64 lowering of nested code.
+
+(module
+  (memory 1)
+
+  (func $take (param $0 i64) (param $1 i64) (result i64)
+    (get_local $1))
+
+  (func (export "add_nested") (param $x i64) (param $y i64) (result i64)
+    (i64.add
+      (get_local $x)
+      (i64.add
+        (i64.shl (get_local $y) (i64.const 1))
+        (i64.extend_u/i32 (i32.wrap/i64 (get_local $y))))))
+
+  (func (export "select") (param $x i64) (param $y i64) (param $c i32) (result i64)
+    (select (get_local $x) (get_local $y) (get_local $c)))
+
+  (func (export "select_nested") (param $x i64) (param $y i64) (result i64)
+    (select
+      (i64.add (get_local $x) (get_local $y))
+      (i64.sub (get_local $x) (get_local $y))
+      (i64.lt_s (get_local $x) (get_local $y))))
+
+  (func (export "br_if_value") (param $x i64) (param $c i32) (result i64)
+    (block $b (result i64)
+      (i64.add
+        (br_if $b (i64.add (get_local $x) (i64.const 1)) (get_local $c))
+        (i64.const 0x100000000))))
+
+  (func (export "br_values") (param $x i64) (param $c i32) (result i64)
+    (block $b (result i64)
+      (if (get_local $c)
+        (br $b (i64.add (get_local $x) (i64.const 1))))
+      (br $b (i64.sub (get_local $x) (i64.const 1)))))
+
+  (func (export "if_unreachable_arm") (param $x i64) (param $c i32) (result i64)
+    (i64.xor
+      (if (result i64) (get_local $c)
+        (unreachable)
+        (i64.sub (get_local $x) (i64.const 1)))
+      (i64.const 0xffffffff00000000)))
+
+  (func (export "store_nested") (param $x i64) (result i64)
+    (i64.store (i32.const 8) (get_local $x))
+    (i64.store
+      (i32.add (i32.const 4) (i32.const 4))
+      (i64.add (get_local $x) (i64.load (i32.const 8))))
+    (i64.load (i32.const 8)))
+
+  (func (export "call_unreachable_operand") (param $x i64) (param $c i32) (result i64)
+    (if (get_local $c)
+      (drop (call $take (get_local $x) (unreachable))))
+    (call $take (get_local $x) (i64.add (get_local $x) (get_local $x))))
+)
+
+(assert_return (invoke "add_nested" (i64.const 0x00000001ffffffff) (i64.const 0x7fffffff80000000))
+               (i64.const 0x000000017fffffff))
+(assert_return (invoke "select" (i64.const 0x0000000100000002) (i64.const 0x0000000300000004) (i32.const 1))
+               (i64.const 0x0000000100000002))
+(assert_return (invoke "select" (i64.const 0x0000000100000002) (i64.const 0x0000000300000004) (i32.const 0))
+               (i64.const 0x0000000300000004))
+(assert_return (invoke "select_nested" (i64.const 0x0000000100000000) (i64.const 0x0000000200000000))
+               (i64.const 0x0000000300000000))
+(assert_return (invoke "select_nested" (i64.const 0x0000000200000000) (i64.const 0x0000000100000000))
+               (i64.const 0x0000000100000000))
+(assert_return (invoke "br_if_value" (i64.const 0x00000001ffffffff) (i32.const 1))
+               (i64.const 0x0000000200000000))
+(assert_return (invoke "br_if_value" (i64.const 0x00000001ffffffff) (i32.const 0))
+               (i64.const 0x0000000300000000))
+(assert_return (invoke "br_values" (i64.const 0x0000000100000000) (i32.const 1))
+               (i64.const 0x0000000100000001))
+(assert_return (invoke "br_values" (i64.const 0x0000000100000000) (i32.const 0))
+               (i64.const 0x00000000ffffffff))
+(assert_return (invoke "if_unreachable_arm" (i64.const 0x0000000100000000) (i32.const 0))
+               (i64.const 0xffffffffffffffff))
+(assert_return (invoke "store_nested" (i64.const 0x00000001ffffffff))
+               (i64.const 0x00000003fffffffe))
+(assert_return (invoke "call_unreachable_operand" (i64.const 0x00000001ffffffff) (i32.const 0))
+               (i64.const 0x00000003fffffffe))
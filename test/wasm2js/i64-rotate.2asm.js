@@ -32,19 +32,14 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   $2_1 = $2_1 | 0;
   $2$hi = $2$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $5$hi = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_rotl_i64($0 | 0, i64toi32_i32$0 | 0, $1_1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $5$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $2$hi;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = $2$hi;
-  return (i64toi32_i32$2 | 0) == ($2_1 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  i64toi32_i32$2 = __wasm_rotl_i64($0 | 0, i64toi32_i32$1 | 0, $1_1 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$2 = $2$hi;
+  return (i64toi32_i32$0 | 0) == ($2_1 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  function $2($0, $0$hi, $1_1, $1$hi, $2_1, $2$hi) {
@@ -54,19 +49,14 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   $2_1 = $2_1 | 0;
   $2$hi = $2$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $5$hi = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_rotr_i64($0 | 0, i64toi32_i32$0 | 0, $1_1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $5$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $2$hi;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = $2$hi;
-  return (i64toi32_i32$2 | 0) == ($2_1 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $1$hi;
+  i64toi32_i32$2 = __wasm_rotr_i64($0 | 0, i64toi32_i32$1 | 0, $1_1 | 0, i64toi32_i32$2 | 0) | 0;
+  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$2 = $2$hi;
+  return (i64toi32_i32$0 | 0) == ($2_1 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  function __wasm_rotl_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -74,112 +64,84 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = 4294967295;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $19 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$12 = 0, i64toi32_i32$1 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, var$2 = 0, $16 = 0, $17 = 0, $18 = 0, $19 = 0, var$2$hi = 0;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = 4294967295;
+  i64toi32_i32$6 = var$1$hi;
+  i64toi32_i32$5 = var$1;
+  i64toi32_i32$7 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  var$2 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$2;
+  var$2$hi = i64toi32_i32$7;
+  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$7 = 0;
+   $16 = i64toi32_i32$4 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$7 = i64toi32_i32$4 >>> i64toi32_i32$6 | 0;
+   $16 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$6 | 0) | 0;
   }
-  $6$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-  $8$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$0 = $8$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $20 = 0;
+  i64toi32_i32$2 = $16;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$7 & i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$7 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   $17 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $20 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
+   $17 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
   }
-  $10 = $20;
-  $10$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $17;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$7 = 4294967295;
+  i64toi32_i32$8 = 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$12 = (i64toi32_i32$6 >>> 0 < var$1 >>> 0) + var$1$hi | 0;
+  i64toi32_i32$12 = i64toi32_i32$8 - i64toi32_i32$12 | 0;
+  i64toi32_i32$5 = i64toi32_i32$6 - var$1 | 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$6 = i64toi32_i32$12 & i64toi32_i32$6 | 0;
+  var$1 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$1;
+  var$1$hi = i64toi32_i32$6;
   i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$5 = 4294967295;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
-   $21 = 0;
+  i64toi32_i32$12 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$7 << i64toi32_i32$12 | 0;
+   $18 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
-   $21 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
+   i64toi32_i32$6 = ((1 << i64toi32_i32$12 | 0) - 1 | 0) & (i64toi32_i32$7 >>> (32 - i64toi32_i32$12 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$12 | 0) | 0;
+   $18 = i64toi32_i32$7 << i64toi32_i32$12 | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $22 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = $18;
+  i64toi32_i32$7 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  i64toi32_i32$1 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $19 = i64toi32_i32$7 >>> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$0 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
-   $22 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$7 >>> i64toi32_i32$4 | 0;
+   $19 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$7 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $19;
+  i64toi32_i32$3 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_rotr_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -187,112 +149,84 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $6$hi = 0, $8$hi = 0, $10 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = 4294967295;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $19 = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$3 = 0, i64toi32_i32$7 = 0, i64toi32_i32$5 = 0, i64toi32_i32$12 = 0, i64toi32_i32$1 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, var$2 = 0, $16 = 0, $17 = 0, $18 = 0, $19 = 0, var$2$hi = 0;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = 4294967295;
+  i64toi32_i32$6 = var$1$hi;
+  i64toi32_i32$5 = var$1;
+  i64toi32_i32$7 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  var$2 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$2;
+  var$2$hi = i64toi32_i32$7;
+  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$7 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
+   $16 = 0;
   } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $19 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
+   i64toi32_i32$7 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$6 | 0) | 0;
+   $16 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
   }
-  $6$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-  $8$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$0 = $8$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $20 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = $16;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$7 & i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$7 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = 0;
+   $17 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+   $17 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $10 = $20;
-  $10$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $17;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$7 = 4294967295;
+  i64toi32_i32$8 = 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$12 = (i64toi32_i32$6 >>> 0 < var$1 >>> 0) + var$1$hi | 0;
+  i64toi32_i32$12 = i64toi32_i32$8 - i64toi32_i32$12 | 0;
+  i64toi32_i32$5 = i64toi32_i32$6 - var$1 | 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$6 = i64toi32_i32$12 & i64toi32_i32$6 | 0;
+  var$1 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$1;
+  var$1$hi = i64toi32_i32$6;
   i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$5 = 4294967295;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$12 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = 0;
+   $18 = i64toi32_i32$4 >>> i64toi32_i32$12 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
-   $21 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$4 >>> i64toi32_i32$12 | 0;
+   $18 = (((1 << i64toi32_i32$12 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$12 | 0) | 0 | (i64toi32_i32$7 >>> i64toi32_i32$12 | 0) | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
-   $22 = 0;
+  i64toi32_i32$3 = $18;
+  i64toi32_i32$7 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  i64toi32_i32$1 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   $19 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$2 | 0) | 0;
-   $22 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$7 << i64toi32_i32$4 | 0) | 0;
+   $19 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $19;
+  i64toi32_i32$3 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  return {
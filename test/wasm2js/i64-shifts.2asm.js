@@ -32,28 +32,22 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   $2_1 = $2_1 | 0;
   $2$hi = $2$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $12 = 0, $5$hi = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1_1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $12 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, $11 = 0;
+  i64toi32_i32$2 = $0$hi;
+  i64toi32_i32$1 = $0;
+  i64toi32_i32$3 = $1$hi;
+  i64toi32_i32$4 = $1_1;
+  i64toi32_i32$5 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $11 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $12 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$3 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$5 | 0) | 0;
+   $11 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $5$hi = i64toi32_i32$1;
   i64toi32_i32$1 = $2$hi;
-  i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $12;
-  i64toi32_i32$2 = $2$hi;
-  i64toi32_i32$3 = $2_1;
-  return (i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
+  i64toi32_i32$2 = $2_1;
+  return ($11 | 0) == (i64toi32_i32$2 | 0) & (i64toi32_i32$3 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
  }
  
  function $2($0, $0$hi, $1_1, $1$hi, $2_1, $2$hi) {
@@ -63,28 +57,22 @@ function asmFunc(global, env, buffer) {
   $1$hi = $1$hi | 0;
   $2_1 = $2_1 | 0;
   $2$hi = $2$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, $12 = 0, $5$hi = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = $1$hi;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1_1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $12 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, $11 = 0;
+  i64toi32_i32$2 = $0$hi;
+  i64toi32_i32$1 = $0;
+  i64toi32_i32$3 = $1$hi;
+  i64toi32_i32$4 = $1_1;
+  i64toi32_i32$5 = i64toi32_i32$4 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$2 >> 31 | 0;
+   $11 = i64toi32_i32$2 >> i64toi32_i32$5 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $12 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >> i64toi32_i32$5 | 0;
+   $11 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$5 | 0) | 0;
   }
-  $5$hi = i64toi32_i32$1;
   i64toi32_i32$1 = $2$hi;
-  i64toi32_i32$1 = $5$hi;
-  i64toi32_i32$0 = $12;
-  i64toi32_i32$2 = $2$hi;
-  i64toi32_i32$3 = $2_1;
-  return (i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == ($2$hi | 0) | 0 | 0;
+  i64toi32_i32$2 = $2_1;
+  return ($11 | 0) == (i64toi32_i32$2 | 0) & (i64toi32_i32$3 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
  }
  
  return {
@@ -26,15 +26,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
+  var i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$3 = y;
   i64toi32_i32$4 = x + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + y$hi | 0;
+  i64toi32_i32$5 = x$hi + y$hi | 0;
   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
   return i64toi32_i32$4 | 0;
  }
@@ -44,18 +40,14 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
+  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$0 = x;
   i64toi32_i32$3 = y;
-  i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + y$hi | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
+  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + y$hi | 0;
+  i64toi32_i32$5 = x$hi - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $2(x, x$hi, y, y$hi) {
@@ -63,14 +55,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_mul(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -81,14 +70,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_sdiv(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -99,14 +85,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_udiv(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -117,14 +100,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_srem(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -135,14 +115,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_urem(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -153,17 +130,13 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 & y | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
+  i64toi32_i32$2 = x$hi & i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 & y | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $8(x, x$hi, y, y$hi) {
@@ -171,17 +144,13 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | y | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
+  i64toi32_i32$2 = x$hi | i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | y | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $9(x, x$hi, y, y$hi) {
@@ -189,17 +158,13 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 ^ y | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
+  i64toi32_i32$2 = x$hi ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 ^ y | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $10(x, x$hi, y, y$hi) {
@@ -207,25 +172,22 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $9_1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9_1 = 0, i64toi32_i32$1 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
    $9_1 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $9_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
+   $9_1 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = $9_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = $9_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $11(x, x$hi, y, y$hi) {
@@ -233,25 +195,22 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9_1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9_1 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $9_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
+   $9_1 = i64toi32_i32$1 >> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $9_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$4 | 0;
+   $9_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = $9_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = $9_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $12(x, x$hi, y, y$hi) {
@@ -259,25 +218,22 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9_1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9_1 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
   i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
   if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $9_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = 0;
+   $9_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $9_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+   $9_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = $9_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = $9_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$0 | 0;
  }
  
  function $13(x, x$hi, y, y$hi) {
@@ -285,14 +241,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_rotl_i64(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -303,14 +256,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_rotr_i64(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -319,14 +269,12 @@ function asmFunc(global, env, buffer) {
  function $15(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $6_1 = 0, i64toi32_i32$1 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, $6_1 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
   i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = x;
   i64toi32_i32$3 = Math_clz32(i64toi32_i32$0);
   i64toi32_i32$2 = 0;
   if ((i64toi32_i32$3 | 0) == (32 | 0)) $6_1 = Math_clz32(i64toi32_i32$1) + 32 | 0; else $6_1 = i64toi32_i32$3;
-  i64toi32_i32$2 = i64toi32_i32$2;
   i64toi32_i32$0 = $6_1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
   return i64toi32_i32$0 | 0;
@@ -335,38 +283,29 @@ function asmFunc(global, env, buffer) {
  function $16(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = __wasm_ctz_i64(x | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function $17(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
+  var i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$0 = __wasm_popcnt_i64(x | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$HIGH_BITS;
   return i64toi32_i32$0 | 0;
  }
  
  function $18(x, x$hi) {
   x = x | 0;
   x$hi = x$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return (x | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0;
+  return (x | x$hi | 0 | 0) == (0 | 0) | 0;
  }
  
  function $19(x, x$hi, y, y$hi) {
@@ -374,11 +313,7 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return (x | 0) == (y | 0) & (i64toi32_i32$0 | 0) == (y$hi | 0) | 0 | 0;
+  return (x | 0) == (y | 0) & (x$hi | 0) == (y$hi | 0) | 0 | 0;
  }
  
  function $20(x, x$hi, y, y$hi) {
@@ -386,11 +321,7 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return (x | 0) != (y | 0) | (i64toi32_i32$0 | 0) != (y$hi | 0) | 0 | 0;
+  return (x | 0) != (y | 0) | (x$hi | 0) != (y$hi | 0) | 0 | 0;
  }
  
  function $21(x, x$hi, y, y$hi) {
@@ -398,16 +329,14 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
-  if ((i64toi32_i32$0 | 0) < (y$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) < (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) <= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 >= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -420,11 +349,10 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return i64toi32_i32$0 >>> 0 < y$hi >>> 0 | ((i64toi32_i32$0 | 0) == (y$hi | 0) & x >>> 0 < y >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$2 = y$hi;
+  return i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & x >>> 0 < y >>> 0 | 0) | 0 | 0;
  }
  
  function $23(x, x$hi, y, y$hi) {
@@ -432,16 +360,14 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
-  if ((i64toi32_i32$0 | 0) < (y$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 > i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) < (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) <= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 > i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -454,11 +380,10 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return i64toi32_i32$0 >>> 0 < y$hi >>> 0 | ((i64toi32_i32$0 | 0) == (y$hi | 0) & x >>> 0 <= y >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$2 = y$hi;
+  return i64toi32_i32$1 >>> 0 < i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & x >>> 0 <= y >>> 0 | 0) | 0 | 0;
  }
  
  function $25(x, x$hi, y, y$hi) {
@@ -466,16 +391,14 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
-  if ((i64toi32_i32$0 | 0) > (y$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 <= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) > (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) >= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 <= i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -488,11 +411,10 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return i64toi32_i32$0 >>> 0 > y$hi >>> 0 | ((i64toi32_i32$0 | 0) == (y$hi | 0) & x >>> 0 > y >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$2 = y$hi;
+  return i64toi32_i32$1 >>> 0 > i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & x >>> 0 > y >>> 0 | 0) | 0 | 0;
  }
  
  function $27(x, x$hi, y, y$hi) {
@@ -500,16 +422,14 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$0 = x;
+  i64toi32_i32$2 = y$hi;
   i64toi32_i32$3 = y;
-  if ((i64toi32_i32$0 | 0) > (y$hi | 0)) $8_1 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
+  if ((i64toi32_i32$1 | 0) > (i64toi32_i32$2 | 0)) $8_1 = 1; else {
+   if ((i64toi32_i32$1 | 0) >= (i64toi32_i32$2 | 0)) {
+    if (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) $9_1 = 0; else $9_1 = 1;
     $10_1 = $9_1;
    } else $10_1 = 0;
    $8_1 = $10_1;
@@ -522,11 +442,10 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
-  i64toi32_i32$0 = x$hi;
-  return i64toi32_i32$0 >>> 0 > y$hi >>> 0 | ((i64toi32_i32$0 | 0) == (y$hi | 0) & x >>> 0 >= y >>> 0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0;
+  i64toi32_i32$1 = x$hi;
+  i64toi32_i32$2 = y$hi;
+  return i64toi32_i32$1 >>> 0 > i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & x >>> 0 >= y >>> 0 | 0) | 0 | 0;
  }
  
  function _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0, var$0$hi, var$1, var$1$hi) {
@@ -534,78 +453,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21_1 = 0, $22_1 = 0, var$6 = 0, $24_1 = 0, $17_1 = 0, $18_1 = 0, $23_1 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16_1 = 0, $17_1 = 0, var$6 = 0, $18_1 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $23_1 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17_1 = Math_imul(var$4, var$5);
-  $18_1 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19_1 = Math_imul(var$4, var$5);
+  $20_1 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16_1 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23_1 = $17_1 + Math_imul($18_1, $21_1) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21_1 = $19_1 + Math_imul($20_1, $16_1) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17_1 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29 = $23_1 + Math_imul($22_1, var$3) | 0;
+  $22_1 = $21_1 + Math_imul($17_1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45 = $29 + (var$2 >>> 16 | 0) | 0;
+  $23_1 = $22_1 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24_1 = 0;
+  i64toi32_i32$4 = $23_1 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18_1 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24_1 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18_1 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24_1;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18_1;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Div3div17he78fc483e41d7ec7E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -613,124 +522,93 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21_1 = 0, $22_1 = 0, $23_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17_1 = 0, $17$hi = 0, $23$hi = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$5 = 0, i64toi32_i32$8 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$7 = 0, i64toi32_i32$9 = 0, var$2 = 0, i64toi32_i32$0 = 0, $15_1 = 0, $16_1 = 0, i64toi32_i32$1 = 0, $17_1 = 0, $18_1 = 0, $19_1 = 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$7 = 63;
+  i64toi32_i32$8 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$5 >> 31 | 0;
+   $15_1 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
+   $15_1 = (((1 << i64toi32_i32$8 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$8 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$8 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $21_1;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$0 = var$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9_1 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22_1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  var$2 = $15_1;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$4;
+  i64toi32_i32$4 = var$0$hi;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$4 = i64toi32_i32$6 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$3 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$3 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 >>> 0 < i64toi32_i32$6 >>> 0;
+  i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$4 - i64toi32_i32$7 | 0;
+  $18_1 = i64toi32_i32$5;
+  $19_1 = i64toi32_i32$7;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$9 = i64toi32_i32$8 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$8 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 >> 31 | 0;
+   $16_1 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$5 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
+   $16_1 = (((1 << i64toi32_i32$9 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$9 | 0) | 0 | (i64toi32_i32$6 >>> i64toi32_i32$9 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $22_1;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  var$2 = $16_1;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9_1 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17_1 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
+  i64toi32_i32$6 = i64toi32_i32$5 ^ i64toi32_i32$6 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$4 = i64toi32_i32$5;
+  i64toi32_i32$5 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$9 = i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0;
+  i64toi32_i32$8 = i64toi32_i32$9 + i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = i64toi32_i32$6 - i64toi32_i32$8 | 0;
+  i64toi32_i32$8 = __wasm_i64_udiv($18_1 | 0, $19_1 | 0, i64toi32_i32$3 | 0, i64toi32_i32$8 | 0) | 0;
+  i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$8;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$5 = i64toi32_i32$6 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23_1 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = 63;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$5 >> 31 | 0;
+   $17_1 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23_1 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
+   $17_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$8 >>> i64toi32_i32$4 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  var$0 = $23_1;
+  var$0 = $17_1;
+  i64toi32_i32$8 = var$0;
   var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17_1;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$8 = i64toi32_i32$8;
+  i64toi32_i32$2 = i64toi32_i32$7 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 ^ i64toi32_i32$8 | 0;
   i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$7 = i64toi32_i32$8;
+  i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+  i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$7 >>> 0;
+  i64toi32_i32$5 = i64toi32_i32$6 + var$0$hi | 0;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = i64toi32_i32$8;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$8 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -738,101 +616,77 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20_1 = 0, $21_1 = 0, $7$hi = 0, $9_1 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20_1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$6 = 0, i64toi32_i32$8 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$7 = 0, i64toi32_i32$9 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$0 = 0, $16_1 = 0, $17_1 = 0, i64toi32_i32$1 = 0, $18_1 = 0, $19_1 = 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$7 = 63;
+  i64toi32_i32$8 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$5 >> 31 | 0;
+   $16_1 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
+   $16_1 = (((1 << i64toi32_i32$8 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$8 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$8 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $20_1;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$0 = var$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9_1 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21_1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  var$2 = $16_1;
+  i64toi32_i32$4 = var$2;
+  var$2$hi = i64toi32_i32$6;
+  i64toi32_i32$3 = i64toi32_i32$4;
+  i64toi32_i32$4 = var$0$hi;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$4 = i64toi32_i32$6 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$3 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$3 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 >>> 0 < i64toi32_i32$6 >>> 0;
+  i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$4 - i64toi32_i32$7 | 0;
+  $18_1 = i64toi32_i32$5;
+  $19_1 = i64toi32_i32$7;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$9 = i64toi32_i32$8 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$8 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 >> 31 | 0;
+   $17_1 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21_1 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$5 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
+   $17_1 = (((1 << i64toi32_i32$9 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$9 | 0) | 0 | (i64toi32_i32$6 >>> i64toi32_i32$9 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$0 = $21_1;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$2 = var$1$hi;
+  var$0 = $17_1;
+  i64toi32_i32$6 = var$0;
+  var$0$hi = i64toi32_i32$5;
+  i64toi32_i32$4 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9_1 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$6 = i64toi32_i32$5 ^ i64toi32_i32$6 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$9 = i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0;
+  i64toi32_i32$8 = i64toi32_i32$9 + i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = i64toi32_i32$6 - i64toi32_i32$8 | 0;
+  i64toi32_i32$8 = __wasm_i64_urem($18_1 | 0, $19_1 | 0, i64toi32_i32$3 | 0, i64toi32_i32$8 | 0) | 0;
+  i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$8;
+  i64toi32_i32$8 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$8 = i64toi32_i32$7 ^ i64toi32_i32$8 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$1 = var$2$hi;
+  i64toi32_i32$7 = i64toi32_i32$2;
+  i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
+  i64toi32_i32$5 = i64toi32_i32$0 >>> 0 < i64toi32_i32$7 >>> 0;
+  i64toi32_i32$6 = i64toi32_i32$5 + var$2$hi | 0;
+  i64toi32_i32$6 = i64toi32_i32$8 - i64toi32_i32$6 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$6;
+  return i64toi32_i32$2 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -840,7 +694,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, $45 = 0, var$8$hi = 0, $46 = 0, $47 = 0, $48 = 0, $49 = 0, var$7$hi = 0, $50 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $66 = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$2 = 0, var$3 = 0, i64toi32_i32$9 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, var$4 = 0, var$5 = 0, var$6 = 0, var$5$hi = 0, var$6$hi = 0, $24_1 = 0, $25_1 = 0, $26_1 = 0, $27_1 = 0, $28_1 = 0, $29 = 0, $30 = 0, $31 = 0, $32 = 0, $33 = 0, $34 = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, var$8 = 0, var$8$hi = 0, var$7$hi = 0, var$7 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -852,135 +706,117 @@ function asmFunc(global, env, buffer) {
           label$9 : {
            label$10 : {
             label$11 : {
-             i64toi32_i32$0 = var$0$hi;
-             i64toi32_i32$0 = i64toi32_i32$0;
-             i64toi32_i32$2 = var$0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$0$hi;
+             i64toi32_i32$0 = var$0;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$3 = 32;
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $38 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              i64toi32_i32$2 = 0;
+              $24_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
              } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+              $24_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
              }
-             i64toi32_i32$1 = i64toi32_i32$1;
-             var$2 = $38;
+             var$2 = $24_1;
              if (var$2) block : {
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
+              i64toi32_i32$2 = var$1$hi;
               var$3 = var$1;
               if ((var$3 | 0) == (0 | 0)) break label$11;
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
-              i64toi32_i32$0 = var$1;
-              i64toi32_i32$2 = 0;
+              i64toi32_i32$0 = var$1$hi;
+              i64toi32_i32$2 = var$1;
+              i64toi32_i32$1 = 0;
               i64toi32_i32$3 = 32;
               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-               i64toi32_i32$2 = 0;
-               $39 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+               i64toi32_i32$1 = 0;
+               $25_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
               } else {
-               i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+               $25_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
               }
-              i64toi32_i32$2 = i64toi32_i32$2;
-              var$4 = $39;
+              var$4 = $25_1;
               if ((var$4 | 0) == (0 | 0)) break label$9;
               var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
               if (var$2 >>> 0 <= 31 >>> 0) break label$8;
               break label$2;
-             };
+             }
              i64toi32_i32$2 = var$1$hi;
-             i64toi32_i32$2 = i64toi32_i32$2;
              i64toi32_i32$1 = var$1;
              i64toi32_i32$0 = 1;
              i64toi32_i32$3 = 0;
              if (i64toi32_i32$2 >>> 0 > i64toi32_i32$0 >>> 0 | ((i64toi32_i32$2 | 0) == (i64toi32_i32$0 | 0) & i64toi32_i32$1 >>> 0 >= i64toi32_i32$3 >>> 0 | 0) | 0) break label$2;
-             i64toi32_i32$1 = var$0$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$1 = 1024;
+             i64toi32_i32$2 = var$0$hi;
              var$2 = var$0;
-             i64toi32_i32$1 = var$1$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$2 = var$1$hi;
              var$3 = var$1;
              var$2 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-             i64toi32_i32$1 = 0;
-             i64toi32_i32$2 = 1024;
-             i64toi32_i32$1 = i64toi32_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$3 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$2 = 0;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$3;
              HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = i64toi32_i32$1;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$2;
              (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$2;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$1 = i64toi32_i32$1;
-             i64toi32_i32$2 = var$2;
-             i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-             return i64toi32_i32$2 | 0;
+             i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+             return i64toi32_i32$1 | 0;
             };
             i64toi32_i32$2 = var$1$hi;
-            i64toi32_i32$2 = i64toi32_i32$2;
-            i64toi32_i32$3 = var$1;
-            i64toi32_i32$1 = 0;
+            i64toi32_i32$1 = var$1;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$0 = 32;
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             i64toi32_i32$3 = 0;
+             $26_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $26_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
             }
-            i64toi32_i32$1 = i64toi32_i32$1;
-            var$3 = $40;
-            i64toi32_i32$1 = var$0$hi;
-            i64toi32_i32$1 = i64toi32_i32$1;
+            var$3 = $26_1;
+            i64toi32_i32$3 = var$0$hi;
             if ((var$0 | 0) == (0 | 0)) break label$7;
             if ((var$3 | 0) == (0 | 0)) break label$6;
             var$4 = var$3 + 4294967295 | 0;
             if (var$4 & var$3 | 0) break label$6;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $41 = 0;
+            i64toi32_i32$3 = 1024;
+            $37 = i64toi32_i32$3;
+            i64toi32_i32$4 = var$4 & var$2 | 0;
+            i64toi32_i32$0 = 0;
+            i64toi32_i32$2 = i64toi32_i32$4;
+            i64toi32_i32$4 = 0;
+            i64toi32_i32$5 = 32;
+            i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+            if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+             i64toi32_i32$4 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
+             $27_1 = 0;
             } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$6 | 0) | 0;
+             $27_1 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
             }
-            $63$hi = i64toi32_i32$3;
-            i64toi32_i32$3 = var$0$hi;
-            i64toi32_i32$3 = i64toi32_i32$3;
-            i64toi32_i32$1 = var$0;
-            i64toi32_i32$2 = 0;
-            i64toi32_i32$0 = 4294967295;
-            i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
-            $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
-            $65$hi = i64toi32_i32$2;
-            i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $41;
-            i64toi32_i32$1 = $65$hi;
-            i64toi32_i32$0 = $65;
-            i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
-            $66 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-            i64toi32_i32$3 = 1024;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = $66;
+            i64toi32_i32$1 = $27_1;
+            i64toi32_i32$0 = var$0$hi;
+            i64toi32_i32$2 = var$0;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$6 = 4294967295;
+            i64toi32_i32$5 = i64toi32_i32$0 & i64toi32_i32$5 | 0;
+            i64toi32_i32$2 = i64toi32_i32$2 & i64toi32_i32$6 | 0;
+            i64toi32_i32$5 = i64toi32_i32$4 | i64toi32_i32$5 | 0;
+            wasm2js_i32$0 = $37;
+            wasm2js_i32$1 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
             HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
             wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = i64toi32_i32$1;
+            wasm2js_i32$1 = i64toi32_i32$5;
             (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
             i64toi32_i32$3 = var$2 >>> ((__wasm_ctz_i32(var$3 | 0) | 0) & 31 | 0) | 0;
-            i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$3 = i64toi32_i32$3;
+            i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
             return i64toi32_i32$3 | 0;
            };
           };
@@ -994,350 +830,292 @@ function asmFunc(global, env, buffer) {
          var$2 = var$2 + 1 | 0;
          break label$3;
         };
+        i64toi32_i32$3 = 1024;
+        $38 = i64toi32_i32$3;
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$3 = i64toi32_i32$3;
-        i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
+        i64toi32_i32$4 = var$2 - Math_imul(var$4, var$3) | 0;
         i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $42 = 0;
+        i64toi32_i32$5 = i64toi32_i32$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$2 = 32;
+        i64toi32_i32$0 = i64toi32_i32$2 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+         i64toi32_i32$4 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
+         $28_1 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $42 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         i64toi32_i32$4 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$0 | 0) | 0;
+         $28_1 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
         }
-        i64toi32_i32$2 = 1024;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = $42;
+        wasm2js_i32$0 = $38;
+        wasm2js_i32$1 = $28_1;
         HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = i64toi32_i32$1;
+        wasm2js_i32$0 = i64toi32_i32$3;
+        wasm2js_i32$1 = i64toi32_i32$4;
         (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        i64toi32_i32$2 = var$4;
-        i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-        return i64toi32_i32$2 | 0;
+        i64toi32_i32$3 = var$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$3 = i64toi32_i32$3;
+        i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+        return i64toi32_i32$3 | 0;
        };
        var$2 = Math_clz32(var$3) - Math_clz32(var$2) | 0;
        if (var$2 >>> 0 < 31 >>> 0) break label$4;
        break label$2;
       };
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$2 = 0;
-      i64toi32_i32$1 = 1024;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = var$4 & var$0 | 0;
+      i64toi32_i32$3 = 1024;
+      i64toi32_i32$4 = var$0$hi;
+      i64toi32_i32$5 = var$4 & var$0 | 0;
+      i64toi32_i32$4 = 0;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$5;
       HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = i64toi32_i32$2;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$4;
       (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
       if ((var$3 | 0) == (1 | 0)) break label$1;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = 0;
-      $120$hi = i64toi32_i32$2;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$3 = var$0;
-      i64toi32_i32$1 = $120$hi;
-      i64toi32_i32$0 = __wasm_ctz_i32(var$3 | 0) | 0;
-      i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-      if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-       i64toi32_i32$1 = 0;
-       $43 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+      i64toi32_i32$3 = var$0$hi;
+      i64toi32_i32$4 = var$0;
+      i64toi32_i32$1 = __wasm_ctz_i32(var$3 | 0) | 0;
+      i64toi32_i32$5 = 0;
+      i64toi32_i32$1 = i64toi32_i32$1;
+      i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+      if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+       i64toi32_i32$5 = 0;
+       $29 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
       } else {
-       i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       i64toi32_i32$5 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
+       $29 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
       }
-      i64toi32_i32$1 = i64toi32_i32$1;
-      i64toi32_i32$3 = $43;
-      i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-      return i64toi32_i32$3 | 0;
+      i64toi32_i32$4 = $29;
+      i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+      return i64toi32_i32$4 | 0;
      };
      var$3 = 63 - var$2 | 0;
      var$2 = var$2 + 1 | 0;
     };
-    i64toi32_i32$3 = var$0$hi;
+    i64toi32_i32$5 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = var$2 & 63 | 0;
     i64toi32_i32$3 = 0;
-    $129$hi = i64toi32_i32$3;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = $129$hi;
-    i64toi32_i32$0 = var$2 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$1 = 0;
-     $44 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$3 = 0;
+     $30 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
     } else {
-     i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     i64toi32_i32$3 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+     $30 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
     }
-    i64toi32_i32$1 = i64toi32_i32$1;
-    var$5 = $44;
-    var$5$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
-    i64toi32_i32$1 = 0;
-    $134$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
+    var$5 = $30;
+    var$5$hi = i64toi32_i32$3;
+    i64toi32_i32$4 = var$0$hi;
     i64toi32_i32$3 = var$0;
-    i64toi32_i32$2 = $134$hi;
-    i64toi32_i32$0 = var$3 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $45 = 0;
+    i64toi32_i32$1 = var$3 & 63 | 0;
+    i64toi32_i32$5 = 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$5 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
+     $31 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $45 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     i64toi32_i32$5 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$2 | 0) | 0;
+     $31 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
     }
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = $45;
-    var$0$hi = i64toi32_i32$2;
+    var$0 = $31;
+    var$0$hi = i64toi32_i32$5;
     label$13 : {
      if (var$2) block3 : {
-      i64toi32_i32$2 = var$1$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$1 = var$1;
-      i64toi32_i32$3 = 4294967295;
-      i64toi32_i32$0 = 4294967295;
-      i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-      if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-      i64toi32_i32$5 = i64toi32_i32$5;
-      var$8 = i64toi32_i32$4;
-      var$8$hi = i64toi32_i32$5;
+      i64toi32_i32$3 = var$1$hi;
+      i64toi32_i32$5 = var$1;
+      i64toi32_i32$4 = 4294967295;
+      i64toi32_i32$1 = 4294967295;
+      i64toi32_i32$2 = i64toi32_i32$5 + i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$4 | 0;
+      if (i64toi32_i32$2 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0;
+      var$8 = i64toi32_i32$2;
+      var$8$hi = i64toi32_i32$0;
       label$15 : do {
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$5;
-       i64toi32_i32$1 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        $46 = 0;
+       i64toi32_i32$1 = var$5$hi;
+       i64toi32_i32$3 = var$5;
+       i64toi32_i32$4 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$6 = i64toi32_i32$2 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+        i64toi32_i32$4 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
+        $32 = 0;
        } else {
-        i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-        $46 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+        i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$6 | 0) | 0;
+        $32 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
        }
-       $140 = $46;
-       $140$hi = i64toi32_i32$1;
+       i64toi32_i32$5 = $32;
        i64toi32_i32$1 = var$0$hi;
-       i64toi32_i32$1 = i64toi32_i32$1;
-       i64toi32_i32$5 = var$0;
+       i64toi32_i32$3 = var$0;
        i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
+       i64toi32_i32$6 = 63;
+       i64toi32_i32$7 = i64toi32_i32$6 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
         i64toi32_i32$2 = 0;
-        $47 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $33 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        $47 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
+        $33 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$7 | 0) | 0;
        }
-       $142$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = $140$hi;
-       i64toi32_i32$1 = $140;
-       i64toi32_i32$5 = $142$hi;
-       i64toi32_i32$0 = $47;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-       var$5$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       $144 = var$5;
-       $144$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$2 = var$8;
-       i64toi32_i32$1 = var$5$hi;
-       i64toi32_i32$0 = var$5;
-       i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-       i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-       i64toi32_i32$4 = i64toi32_i32$4;
-       i64toi32_i32$5 = i64toi32_i32$3;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-        $48 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+       i64toi32_i32$3 = $33;
+       i64toi32_i32$2 = i64toi32_i32$4 | i64toi32_i32$2 | 0;
+       var$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
+       i64toi32_i32$5 = var$5;
+       var$5$hi = i64toi32_i32$2;
+       i64toi32_i32$0 = i64toi32_i32$5;
+       i64toi32_i32$1 = var$8$hi;
+       i64toi32_i32$3 = var$8;
+       i64toi32_i32$6 = i64toi32_i32$2;
+       i64toi32_i32$7 = i64toi32_i32$5;
+       i64toi32_i32$9 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$5 >>> 0) + i64toi32_i32$2 | 0;
+       i64toi32_i32$9 = i64toi32_i32$1 - i64toi32_i32$9 | 0;
+       i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$5 | 0;
+       i64toi32_i32$3 = 0;
+       i64toi32_i32$1 = 63;
+       i64toi32_i32$7 = i64toi32_i32$1 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+        i64toi32_i32$3 = i64toi32_i32$9 >> 31 | 0;
+        $34 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        $48 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+        i64toi32_i32$3 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
+        $34 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$9 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$7 | 0) | 0;
        }
-       i64toi32_i32$2 = i64toi32_i32$2;
-       var$6 = $48;
-       var$6$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = i64toi32_i32$2;
-       i64toi32_i32$2 = var$1$hi;
-       i64toi32_i32$2 = var$6$hi;
+       var$6 = $34;
        i64toi32_i32$4 = var$6;
-       i64toi32_i32$5 = var$1$hi;
-       i64toi32_i32$0 = var$1;
-       i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-       $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-       $151$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = $144$hi;
-       i64toi32_i32$2 = $144;
-       i64toi32_i32$4 = $151$hi;
-       i64toi32_i32$0 = $151;
-       i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-       i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$5 = i64toi32_i32$1;
-       var$5$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = var$0$hi;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$5 = var$0;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        $49 = 0;
+       var$6$hi = i64toi32_i32$3;
+       i64toi32_i32$5 = i64toi32_i32$4;
+       i64toi32_i32$4 = var$1$hi;
+       i64toi32_i32$9 = var$1;
+       i64toi32_i32$4 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+       i64toi32_i32$5 = i64toi32_i32$5 & i64toi32_i32$9 | 0;
+       i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+       i64toi32_i32$1 = i64toi32_i32$0 >>> 0 < i64toi32_i32$5 >>> 0;
+       i64toi32_i32$9 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+       i64toi32_i32$9 = i64toi32_i32$2 - i64toi32_i32$9 | 0;
+       var$5 = i64toi32_i32$3;
+       var$5$hi = i64toi32_i32$9;
+       i64toi32_i32$2 = var$0$hi;
+       i64toi32_i32$0 = var$0;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$4 = 1;
+       i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+        i64toi32_i32$5 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
+        $35 = 0;
        } else {
-        i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-        $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+        i64toi32_i32$5 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$3 | 0) | 0;
+        $35 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
        }
-       $154$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = var$7$hi;
-       i64toi32_i32$2 = $154$hi;
-       i64toi32_i32$3 = $49;
-       i64toi32_i32$5 = var$7$hi;
-       i64toi32_i32$0 = var$7;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-       var$0$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$6$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$6;
-       i64toi32_i32$3 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-       var$6$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$7 = var$6;
-       var$7$hi = i64toi32_i32$3;
+       i64toi32_i32$9 = $35;
+       i64toi32_i32$0 = var$7$hi;
+       i64toi32_i32$2 = var$7;
+       i64toi32_i32$0 = i64toi32_i32$5 | i64toi32_i32$0 | 0;
+       var$0 = i64toi32_i32$9 | i64toi32_i32$2 | 0;
+       var$0$hi = i64toi32_i32$0;
+       i64toi32_i32$9 = var$6$hi;
+       i64toi32_i32$0 = var$6;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$5 = i64toi32_i32$9 & i64toi32_i32$5 | 0;
+       var$6 = i64toi32_i32$0 & i64toi32_i32$2 | 0;
+       i64toi32_i32$0 = var$6;
+       var$6$hi = i64toi32_i32$5;
+       var$7 = i64toi32_i32$0;
+       var$7$hi = i64toi32_i32$5;
        var$2 = var$2 + 4294967295 | 0;
        if (var$2) continue label$15;
        break label$15;
       } while (1);
       break label$13;
-     };
+     }
     };
-    i64toi32_i32$3 = var$5$hi;
-    i64toi32_i32$2 = 1024;
-    i64toi32_i32$3 = i64toi32_i32$3;
-    wasm2js_i32$0 = i64toi32_i32$2;
+    i64toi32_i32$5 = 1024;
+    i64toi32_i32$0 = var$5$hi;
+    wasm2js_i32$0 = i64toi32_i32$5;
     wasm2js_i32$1 = var$5;
     HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-    wasm2js_i32$0 = i64toi32_i32$2;
-    wasm2js_i32$1 = i64toi32_i32$3;
+    wasm2js_i32$0 = i64toi32_i32$5;
+    wasm2js_i32$1 = i64toi32_i32$0;
     (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$3 = i64toi32_i32$3;
+    i64toi32_i32$9 = var$0$hi;
     i64toi32_i32$5 = var$0;
     i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $50 = 0;
+    i64toi32_i32$4 = 1;
+    i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
+     $36 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $50 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$2 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$9 << i64toi32_i32$3 | 0) | 0;
+     $36 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $50;
+    i64toi32_i32$0 = $36;
     i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
+    i64toi32_i32$9 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$9 | 0;
     i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    return i64toi32_i32$0 | 0;
    };
-   i64toi32_i32$3 = var$0$hi;
-   i64toi32_i32$5 = 1024;
-   i64toi32_i32$3 = i64toi32_i32$3;
-   wasm2js_i32$0 = i64toi32_i32$5;
+   i64toi32_i32$0 = 1024;
+   i64toi32_i32$5 = var$0$hi;
+   wasm2js_i32$0 = i64toi32_i32$0;
    wasm2js_i32$1 = var$0;
    HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-   wasm2js_i32$0 = i64toi32_i32$5;
-   wasm2js_i32$1 = i64toi32_i32$3;
+   wasm2js_i32$0 = i64toi32_i32$0;
+   wasm2js_i32$1 = i64toi32_i32$5;
    (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$5 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$5;
   };
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$0 | 0;
+ }
+ 
+ function __wasm_ctz_i32(var$0) {
+  var$0 = var$0 | 0;
+  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
+  return 32 | 0;
  }
  
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10_1 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, $10_1 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   if (((var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0) == (0 | 0)) {
-   i64toi32_i32$0 = var$0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = var$0;
-   i64toi32_i32$1 = 4294967295;
-   i64toi32_i32$3 = 4294967295;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$2 = i64toi32_i32$2;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$0) + 32 | 0; else $10_1 = i64toi32_i32$3;
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
+   i64toi32_i32$1 = 0;
    i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
+   i64toi32_i32$4 = var$0$hi;
+   i64toi32_i32$3 = var$0;
+   i64toi32_i32$6 = 4294967295;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 4294967295 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$7;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$4 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$8 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$2 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$8 = 0;
+   if ((i64toi32_i32$4 | 0) == (32 | 0)) $10_1 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $10_1 = i64toi32_i32$4;
    i64toi32_i32$3 = $10_1;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   i64toi32_i32$0 = i64toi32_i32$1;
+   i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2;
    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$4 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$4 | 0;
@@ -1348,14 +1126,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -1366,14 +1141,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4sdiv3Div3div17he78fc483e41d7ec7E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -1384,14 +1156,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -1402,14 +1171,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -1422,18 +1188,12 @@ function asmFunc(global, env, buffer) {
   var$1$hi = var$1$hi | 0;
   var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, wasm2js_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$2 = 1024;
   i64toi32_i32$0 = HEAPU32[i64toi32_i32$2 >> 2] | 0;
   i64toi32_i32$1 = (wasm2js_i32$0 = i64toi32_i32$2, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$0 | 0;
@@ -1442,57 +1202,42 @@ function asmFunc(global, env, buffer) {
  function __wasm_popcnt_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, $9$hi = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$6 = 0, i64toi32_i32$0 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$1$hi = 0, var$1 = 0, $11_1 = 0, i64toi32_i32$1 = 0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    $4_1 = (var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0);
-    i64toi32_i32$0 = var$1$hi;
-    $5_1 = var$1;
-    $5$hi = i64toi32_i32$0;
-    if ($4_1) break label$1;
-    i64toi32_i32$0 = $5$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
+    i64toi32_i32$2 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$1 = i64toi32_i32$2;
+    i64toi32_i32$3 = var$0$hi;
+    $11_1 = i64toi32_i32$0;
+    if ((var$0 | i64toi32_i32$3 | 0 | 0) == (0 | 0)) break label$1;
     i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$0;
     i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = 0;
-    i64toi32_i32$3 = 1;
-    i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-    i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    $9$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$2;
-    i64toi32_i32$2 = $9$hi;
-    i64toi32_i32$3 = i64toi32_i32$4;
-    i64toi32_i32$2 = i64toi32_i32$5 & i64toi32_i32$2 | 0;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
-    var$0$hi = i64toi32_i32$2;
+    i64toi32_i32$4 = i64toi32_i32$0;
+    i64toi32_i32$3 = i64toi32_i32$2;
+    i64toi32_i32$6 = 1;
+    i64toi32_i32$8 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$6 >>> 0) + 0 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+    i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$6 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 & i64toi32_i32$8 | 0;
+    var$0 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
+    var$0$hi = i64toi32_i32$8;
     i64toi32_i32$2 = var$1$hi;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    i64toi32_i32$5 = var$1;
+    i64toi32_i32$8 = var$1;
     i64toi32_i32$0 = 0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$1 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
-    i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
-    i64toi32_i32$4 = i64toi32_i32$4;
-    var$1 = i64toi32_i32$1;
-    var$1$hi = i64toi32_i32$4;
+    i64toi32_i32$4 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+    i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+    var$1 = i64toi32_i32$4;
+    var$1$hi = i64toi32_i32$6;
     continue label$2;
     break label$2;
    } while (1);
   };
-  i64toi32_i32$4 = $5$hi;
-  i64toi32_i32$4 = i64toi32_i32$4;
-  i64toi32_i32$5 = $5_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = $11_1;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$6 | 0;
  }
  
  function __wasm_rotl_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1500,112 +1245,84 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = 4294967295;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $19_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$12 = 0, i64toi32_i32$1 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, var$2 = 0, $16_1 = 0, $17_1 = 0, $18_1 = 0, $19_1 = 0, var$2$hi = 0;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = 4294967295;
+  i64toi32_i32$6 = var$1$hi;
+  i64toi32_i32$5 = var$1;
+  i64toi32_i32$7 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  var$2 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$2;
+  var$2$hi = i64toi32_i32$7;
+  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$7 = 0;
+   $16_1 = i64toi32_i32$4 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $19_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$7 = i64toi32_i32$4 >>> i64toi32_i32$6 | 0;
+   $16_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$6 | 0) | 0;
   }
-  $6$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19_1;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-  $8$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$0 = $8$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $20_1 = 0;
+  i64toi32_i32$2 = $16_1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$7 & i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$7 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   $17_1 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $20_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
+   $17_1 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
   }
-  $10_1 = $20_1;
-  $10$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $17_1;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$7 = 4294967295;
+  i64toi32_i32$8 = 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$12 = (i64toi32_i32$6 >>> 0 < var$1 >>> 0) + var$1$hi | 0;
+  i64toi32_i32$12 = i64toi32_i32$8 - i64toi32_i32$12 | 0;
+  i64toi32_i32$5 = i64toi32_i32$6 - var$1 | 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$6 = i64toi32_i32$12 & i64toi32_i32$6 | 0;
+  var$1 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$1;
+  var$1$hi = i64toi32_i32$6;
   i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$5 = 4294967295;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
-   $21_1 = 0;
+  i64toi32_i32$12 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$7 << i64toi32_i32$12 | 0;
+   $18_1 = 0;
   } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$2 | 0) | 0;
-   $21_1 = i64toi32_i32$5 << i64toi32_i32$2 | 0;
+   i64toi32_i32$6 = ((1 << i64toi32_i32$12 | 0) - 1 | 0) & (i64toi32_i32$7 >>> (32 - i64toi32_i32$12 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$12 | 0) | 0;
+   $18_1 = i64toi32_i32$7 << i64toi32_i32$12 | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21_1;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = 0;
-   $22_1 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$3 = $18_1;
+  i64toi32_i32$7 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  i64toi32_i32$1 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $19_1 = i64toi32_i32$7 >>> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$0 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
-   $22_1 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$7 >>> i64toi32_i32$4 | 0;
+   $19_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$7 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10_1;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22_1;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$1 = $19_1;
+  i64toi32_i32$3 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_rotr_i64(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1613,118 +1330,84 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, var$2$hi = 0, var$2 = 0, $19_1 = 0, $20_1 = 0, $21_1 = 0, $22_1 = 0, $6$hi = 0, $8$hi = 0, $10_1 = 0, $10$hi = 0, $15$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = 4294967295;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
-   $19_1 = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$3 = 0, i64toi32_i32$7 = 0, i64toi32_i32$5 = 0, i64toi32_i32$12 = 0, i64toi32_i32$1 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0, var$2 = 0, $16_1 = 0, $17_1 = 0, $18_1 = 0, $19_1 = 0, var$2$hi = 0;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = 4294967295;
+  i64toi32_i32$6 = var$1$hi;
+  i64toi32_i32$5 = var$1;
+  i64toi32_i32$7 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  var$2 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$2;
+  var$2$hi = i64toi32_i32$7;
+  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$7 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
+   $16_1 = 0;
   } else {
-   i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-   $19_1 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
+   i64toi32_i32$7 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$6 | 0) | 0;
+   $16_1 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
   }
-  $6$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$2 = $6$hi;
-  i64toi32_i32$1 = $19_1;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-  $8$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$0 = $8$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $20_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = $16_1;
+  i64toi32_i32$3 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$7 & i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = var$2$hi;
+  i64toi32_i32$7 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = 0;
+   $17_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $20_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+   $17_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
   }
-  $10_1 = $20_1;
-  $10$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$2 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$4 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-  i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = $17_1;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$7 = 4294967295;
+  i64toi32_i32$8 = 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$12 = (i64toi32_i32$6 >>> 0 < var$1 >>> 0) + var$1$hi | 0;
+  i64toi32_i32$12 = i64toi32_i32$8 - i64toi32_i32$12 | 0;
+  i64toi32_i32$5 = i64toi32_i32$6 - var$1 | 0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$6 = i64toi32_i32$12 & i64toi32_i32$6 | 0;
+  var$1 = i64toi32_i32$5 & i64toi32_i32$8 | 0;
+  i64toi32_i32$5 = var$1;
+  var$1$hi = i64toi32_i32$6;
   i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$1 = i64toi32_i32$4;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$5 & i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  var$1 = i64toi32_i32$1 & i64toi32_i32$3 | 0;
-  var$1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = 4294967295;
-  i64toi32_i32$5 = 4294967295;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21_1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
+  i64toi32_i32$12 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = 0;
+   $18_1 = i64toi32_i32$4 >>> i64toi32_i32$12 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$2 | 0;
-   $21_1 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$2 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$4 >>> i64toi32_i32$12 | 0;
+   $18_1 = (((1 << i64toi32_i32$12 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$12 | 0) | 0 | (i64toi32_i32$7 >>> i64toi32_i32$12 | 0) | 0;
   }
-  $15$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = $15$hi;
-  i64toi32_i32$0 = $21_1;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$5 = i64toi32_i32$1 & i64toi32_i32$5 | 0;
-  $17$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = $17$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
-   $22_1 = 0;
+  i64toi32_i32$3 = $18_1;
+  i64toi32_i32$7 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$7 = i64toi32_i32$6 & i64toi32_i32$7 | 0;
+  i64toi32_i32$1 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   $19_1 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$2 | 0) | 0;
-   $22_1 = i64toi32_i32$1 << i64toi32_i32$2 | 0;
+   i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$7 << i64toi32_i32$4 | 0) | 0;
+   $19_1 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
   }
-  $19$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $10$hi;
-  i64toi32_i32$5 = $10_1;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$3 = $22_1;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$5 | 0;
- }
- 
- function __wasm_ctz_i32(var$0) {
-  var$0 = var$0 | 0;
-  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
-  return 32 | 0;
+  i64toi32_i32$1 = $19_1;
+  i64toi32_i32$3 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
+  return i64toi32_i32$0 | 0;
  }
  
  return {
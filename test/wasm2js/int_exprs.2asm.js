@@ -38,38 +38,31 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $13 = 0, $14 = 0, $15 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, i64toi32_i32$2 = 0, $12 = 0, $13 = 0, $14 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$2 = x$hi;
+  i64toi32_i32$1 = x;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$4 = 1;
+  i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+  i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$4 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$5;
+  i64toi32_i32$2 = y$hi;
+  i64toi32_i32$1 = y;
+  i64toi32_i32$4 = 0;
   i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-  $3_1 = i64toi32_i32$4;
-  $3$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = y$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$0 = y;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$1 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5 + i64toi32_i32$2 | 0;
-  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
-  $5$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $3$hi;
-  i64toi32_i32$5 = $3_1;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$3 = i64toi32_i32$1;
-  if ((i64toi32_i32$4 | 0) < (i64toi32_i32$0 | 0)) $13 = 1; else {
-   if ((i64toi32_i32$4 | 0) <= (i64toi32_i32$0 | 0)) {
-    if (i64toi32_i32$5 >>> 0 >= i64toi32_i32$3 >>> 0) $14 = 0; else $14 = 1;
-    $15 = $14;
-   } else $15 = 0;
-   $13 = $15;
+  i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$7 = i64toi32_i32$7 + 1 | 0;
+  i64toi32_i32$1 = i64toi32_i32$5;
+  if ((i64toi32_i32$6 | 0) < (i64toi32_i32$7 | 0)) $12 = 1; else {
+   if ((i64toi32_i32$6 | 0) <= (i64toi32_i32$7 | 0)) {
+    if (i64toi32_i32$0 >>> 0 >= i64toi32_i32$1 >>> 0) $13 = 0; else $13 = 1;
+    $14 = $13;
+   } else $14 = 0;
+   $12 = $14;
   }
-  return $13 | 0;
+  return $12 | 0;
  }
  
  function $3(x, x$hi, y, y$hi) {
@@ -77,31 +70,24 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, $3_1 = 0, $3$hi = 0, $5$hi = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = x;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 1;
-  i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-  $3_1 = i64toi32_i32$4;
-  $3$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = y$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$0 = y;
-  i64toi32_i32$2 = 0;
+  var i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$2 = x$hi;
+  i64toi32_i32$1 = x;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$4 = 1;
+  i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+  i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$4 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$5;
+  i64toi32_i32$2 = y$hi;
+  i64toi32_i32$1 = y;
+  i64toi32_i32$4 = 0;
   i64toi32_i32$3 = 1;
-  i64toi32_i32$1 = i64toi32_i32$0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$4 = i64toi32_i32$5 + i64toi32_i32$2 | 0;
-  if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
-  $5$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $3$hi;
-  i64toi32_i32$5 = $3_1;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$3 = i64toi32_i32$1;
-  return i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0 | ((i64toi32_i32$4 | 0) == (i64toi32_i32$0 | 0) & i64toi32_i32$5 >>> 0 < i64toi32_i32$3 >>> 0 | 0) | 0 | 0;
+  i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$2 + i64toi32_i32$4 | 0;
+  if (i64toi32_i32$5 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$7 = i64toi32_i32$7 + 1 | 0;
+  i64toi32_i32$1 = i64toi32_i32$5;
+  return i64toi32_i32$6 >>> 0 < i64toi32_i32$7 >>> 0 | ((i64toi32_i32$6 | 0) == (i64toi32_i32$7 | 0) & i64toi32_i32$0 >>> 0 < i64toi32_i32$5 >>> 0 | 0) | 0 | 0;
  }
  
  return {
@@ -31,31 +31,31 @@ function asmFunc(global, env, buffer) {
  }
  
  function $1() {
-  var i = 0, $6_1 = 0;
+  var i = 0, $1_1 = 0;
   i = 0;
   exit : {
    cont : do {
     i = i + 1 | 0;
     if ((i | 0) == (5 | 0)) {
-     $6_1 = i;
+     $1_1 = i;
      break exit;
     }
     continue cont;
     break cont;
    } while (1);
   };
-  return $6_1 | 0;
+  return $1_1 | 0;
  }
  
  function $2() {
-  var i = 0, $8_1 = 0;
+  var i = 0, $1_1 = 0;
   i = 0;
   exit : {
    cont : do {
     i = i + 1 | 0;
     if ((i | 0) == (5 | 0)) continue cont;
     if ((i | 0) == (8 | 0)) {
-     $8_1 = i;
+     $1_1 = i;
      break exit;
     }
     i = i + 1 | 0;
@@ -63,42 +63,42 @@ function asmFunc(global, env, buffer) {
     break cont;
    } while (1);
   };
-  return $8_1 | 0;
+  return $1_1 | 0;
  }
  
  function $3() {
-  var i = 0, $6_1 = 0;
+  var i = 0, $1_1 = 0;
   i = 0;
   exit : {
    cont : do {
     i = i + 1 | 0;
     if ((i | 0) == (5 | 0)) {
-     $6_1 = i;
+     $1_1 = i;
      break exit;
     }
     break cont;
    } while (1);
-   $6_1 = i;
+   $1_1 = i;
   };
-  return $6_1 | 0;
+  return $1_1 | 0;
  }
  
  function $4(max) {
   max = max | 0;
-  var i = 0, $9_1 = 0;
+  var i = 0, $2_1 = 0;
   i = 1;
   exit : {
    cont : do {
     i = i + i | 0;
     if (i >>> 0 > max >>> 0) {
-     $9_1 = i;
+     $2_1 = i;
      break exit;
     }
     continue cont;
     break cont;
    } while (1);
   };
-  return $9_1 | 0;
+  return $2_1 | 0;
  }
  
  function $5() {
@@ -168,21 +168,21 @@ function asmFunc(global, env, buffer) {
  
  function $8($0_1) {
   $0_1 = $0_1 | 0;
-  var $2_2 = 0, $3_2 = 0;
+  var $1_1 = 0, $2_1 = 0;
   ret : {
    exit : {
     $0_2 : {
      default_ : {
       $3_1 : {
-       $2_1 : {
-        $1_1 : {
+       $2_2 : {
+        $1_2 : {
          switch ($0_1 | 0) {
          case 0:
           break $0_2;
          case 1:
-          break $1_1;
+          break $1_2;
          case 2:
-          break $2_1;
+          break $2_2;
          case 3:
           break $3_1;
          default:
@@ -190,29 +190,29 @@ function asmFunc(global, env, buffer) {
          };
         };
        };
-       $2_2 = 2;
+       $1_1 = 2;
        break exit;
       };
-      $3_2 = 3;
+      $2_1 = 3;
       break ret;
      };
     };
-    $2_2 = 5;
+    $1_1 = 5;
    };
-   $3_2 = Math_imul(10, $2_2);
+   $2_1 = Math_imul(10, $1_1);
   };
-  return $3_2 | 0;
+  return $2_1 | 0;
  }
  
  function $9($0_1) {
   $0_1 = $0_1 | 0;
-  $1_1 : {
+  $1_2 : {
    $0_2 : {
     switch ($0_1 | 0) {
     case 0:
      break $0_2;
     default:
-     break $1_1;
+     break $1_2;
     };
    };
    return 0 | 0;
@@ -221,7 +221,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $10() {
-  var i = 0, $10_1 = 0;
+  var i = 0, $1_1 = 0;
   i = 0;
   outer : {
    inner : {
@@ -231,69 +231,69 @@ function asmFunc(global, env, buffer) {
     i = i | 2 | 0;
    };
    i = i | 4 | 0;
-   $10_1 = i;
+   $1_1 = i;
    if (0) break outer;
    i = i | 8 | 0;
    i = i | 16 | 0;
-   $10_1 = i;
+   $1_1 = i;
    if (1) break outer;
    i = i | 32 | 0;
-   $10_1 = i;
+   $1_1 = i;
   };
-  return $10_1 | 0;
+  return $1_1 | 0;
  }
  
  function $11() {
-  var $2_2 = 0, $0_1 = 0;
+  var $0_1 = 0, $1_1 = 0;
   l0 : {
    l1 : {
-    $0_1 = 1;
+    $1_1 = 1;
     break l1;
    };
-   $2_2 = $0_1;
+   $0_1 = $1_1;
    if (1) break l0;
-   $2_2 = 1;
+   $0_1 = 1;
   };
-  return $2_2 | 0;
+  return $0_1 | 0;
  }
  
  function $12() {
-  var $2_2 = 0, $0_1 = 0;
+  var $0_1 = 0, $1_1 = 0;
   l0 : {
    l1 : {
-    $0_1 = 1;
+    $1_1 = 1;
     break l1;
    };
-   $2_2 = $0_1;
+   $0_1 = $1_1;
    break l0;
   };
-  return $2_2 | 0;
+  return $0_1 | 0;
  }
  
  function $13() {
-  var i1 = 0, $7_1 = 0, $3_2 = 0;
+  var i1 = 0, $1_1 = 0, $2_1 = 0;
   l0 : {
    i1 = 1;
-   $3_2 = i1;
+   $2_1 = i1;
    i1 = 2;
-   $7_1 = $3_2;
+   $1_1 = $2_1;
    if (i1) break l0;
-   $7_1 = 0;
+   $1_1 = 0;
   };
   return i1 | 0;
  }
  
  function $14() {
-  var $2_2 = 0, $0_1 = 0, $3_2 = 0;
+  var $0_1 = 0, $1_1 = 0, $2_1 = 0;
   l0 : {
    l1 : {
-    $0_1 = 1;
+    $1_1 = 1;
     break l1;
    };
-   $2_2 = $0_1;
+   $0_1 = $1_1;
    break l0;
   };
-  return $2_2 | 0;
+  return $0_1 | 0;
  }
  
  function $15() {
@@ -306,15 +306,15 @@ function asmFunc(global, env, buffer) {
  }
  
  function $16() {
-  var $1_2 = 0, $2_2 = 0;
+  var $0_1 = 0, $1_1 = 0;
   l1 : {
-   $1_2 = 2;
+   $0_1 = 2;
    l113 : {
-    $2_2 = 3;
+    $1_1 = 3;
     break l113;
    };
   };
-  return $1_2 + $2_2 | 0 | 0;
+  return $0_1 + $1_1 | 0 | 0;
  }
  
  return {
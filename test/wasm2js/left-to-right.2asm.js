@@ -146,41 +146,32 @@ function asmFunc(global, env, buffer) {
  }
  
  function i64_left() {
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   bump();
   wasm2js_i32$0 = 8;
   wasm2js_i32$1 = 1;
   HEAP8[wasm2js_i32$0 >> 0] = wasm2js_i32$1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = 0;
   return 0 | 0;
  }
  
  function i64_right() {
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   bump();
   wasm2js_i32$0 = 8;
   wasm2js_i32$1 = 2;
   HEAP8[wasm2js_i32$0 >> 0] = wasm2js_i32$1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = 0;
   return 1 | 0;
  }
  
  function i64_another() {
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   bump();
   wasm2js_i32$0 = 8;
   wasm2js_i32$1 = 3;
   HEAP8[wasm2js_i32$0 >> 0] = wasm2js_i32$1;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+  i64toi32_i32$HIGH_BITS = 0;
   return 1 | 0;
  }
  
@@ -503,579 +494,392 @@ function asmFunc(global, env, buffer) {
  }
  
  function $64() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  i64toi32_i32$4 = $0 + i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$4 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
+  i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$HIGH_BITS | 0;
+  if (i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
   return get() | 0 | 0;
  }
  
  function $65() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$2 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-  i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $66() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $2 = 0, $3 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_i64_mul($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $2 = i64toi32_i32$0;
+  $3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$2 = __wasm_i64_mul($2 | 0, $3 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $67() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $2 = 0, $3 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_i64_sdiv($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $2 = i64toi32_i32$0;
+  $3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$2 = __wasm_i64_sdiv($2 | 0, $3 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $68() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $2 = 0, $3 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $2 = i64toi32_i32$0;
+  $3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$2 = __wasm_i64_udiv($2 | 0, $3 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $69() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $2 = 0, $3 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_i64_srem($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $2 = i64toi32_i32$0;
+  $3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$2 = __wasm_i64_srem($2 | 0, $3 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $70() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, $2 = 0, $3 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $2 = i64toi32_i32$0;
+  $3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$2 = __wasm_i64_urem($2 | 0, $3 | 0, i64toi32_i32$0 | 0, i64toi32_i32$2 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $71() {
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
   i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $72() {
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $73() {
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$1 | 0;
   i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $74() {
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $9 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, $4 = 0, i64toi32_i32$2 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-   $9 = 0;
-  } else {
-   i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$4 | 0) | 0;
-   $9 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-  }
   i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) $4 = 0; else $4 = i64toi32_i32$0 << i64toi32_i32$4 | 0;
   return get() | 0 | 0;
  }
  
  function $75() {
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $9 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, $4 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $9 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $9 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
   i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) $4 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0; else $4 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $76() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, $9 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, $4 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $9 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-  } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $9 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
-  }
   i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$4 = i64toi32_i32$1 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) $4 = i64toi32_i32$2 >> i64toi32_i32$4 | 0; else $4 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $77() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $78() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $79() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $8 = 0, $9 = 0, $10 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $4 = 0, $5 = 0, $6 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  if ((i64toi32_i32$0 | 0) < (i64toi32_i32$1 | 0)) $8 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 >= i64toi32_i32$3 >>> 0) $9 = 0; else $9 = 1;
-    $10 = $9;
-   } else $10 = 0;
-   $8 = $10;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  if ((i64toi32_i32$2 | 0) < (i64toi32_i32$3 | 0)) $4 = 1; else {
+   if ((i64toi32_i32$2 | 0) <= (i64toi32_i32$3 | 0)) {
+    if (i64toi32_i32$0 >>> 0 >= i64toi32_i32$1 >>> 0) $5 = 0; else $5 = 1;
+    $6 = $5;
+   } else $6 = 0;
+   $4 = $6;
   }
   return get() | 0 | 0;
  }
  
  function $80() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $8 = 0, $9 = 0, $10 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $4 = 0, $5 = 0, $6 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  if ((i64toi32_i32$0 | 0) < (i64toi32_i32$1 | 0)) $8 = 1; else {
-   if ((i64toi32_i32$0 | 0) <= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 > i64toi32_i32$3 >>> 0) $9 = 0; else $9 = 1;
-    $10 = $9;
-   } else $10 = 0;
-   $8 = $10;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  if ((i64toi32_i32$2 | 0) < (i64toi32_i32$3 | 0)) $4 = 1; else {
+   if ((i64toi32_i32$2 | 0) <= (i64toi32_i32$3 | 0)) {
+    if (i64toi32_i32$0 >>> 0 > i64toi32_i32$1 >>> 0) $5 = 0; else $5 = 1;
+    $6 = $5;
+   } else $6 = 0;
+   $4 = $6;
   }
   return get() | 0 | 0;
  }
  
  function $81() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $82() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $83() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $8 = 0, $9 = 0, $10 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $4 = 0, $5 = 0, $6 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  if ((i64toi32_i32$0 | 0) > (i64toi32_i32$1 | 0)) $8 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 <= i64toi32_i32$3 >>> 0) $9 = 0; else $9 = 1;
-    $10 = $9;
-   } else $10 = 0;
-   $8 = $10;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  if ((i64toi32_i32$2 | 0) > (i64toi32_i32$3 | 0)) $4 = 1; else {
+   if ((i64toi32_i32$2 | 0) >= (i64toi32_i32$3 | 0)) {
+    if (i64toi32_i32$0 >>> 0 <= i64toi32_i32$1 >>> 0) $5 = 0; else $5 = 1;
+    $6 = $5;
+   } else $6 = 0;
+   $4 = $6;
   }
   return get() | 0 | 0;
  }
  
  function $84() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $8 = 0, $9 = 0, $10 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $4 = 0, $5 = 0, $6 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$2 = $0;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$3 = $1;
-  if ((i64toi32_i32$0 | 0) > (i64toi32_i32$1 | 0)) $8 = 1; else {
-   if ((i64toi32_i32$0 | 0) >= (i64toi32_i32$1 | 0)) {
-    if (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) $9 = 0; else $9 = 1;
-    $10 = $9;
-   } else $10 = 0;
-   $8 = $10;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
+  if ((i64toi32_i32$2 | 0) > (i64toi32_i32$3 | 0)) $4 = 1; else {
+   if ((i64toi32_i32$2 | 0) >= (i64toi32_i32$3 | 0)) {
+    if (i64toi32_i32$0 >>> 0 < i64toi32_i32$1 >>> 0) $5 = 0; else $5 = 1;
+    $6 = $5;
+   } else $6 = 0;
+   $4 = $6;
   }
   return get() | 0 | 0;
  }
  
  function $85() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $86() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
+  i64toi32_i32$1 = i64_left() | 0;
+  i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$1;
   return get() | 0 | 0;
  }
  
  function $87() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   reset();
-  $0 = i32_left() | 0;
-  i64toi32_i32$0 = i64_right() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$0;
-  i64toi32_i32$0 = $0;
-  i64toi32_i32$1 = i64toi32_i32$1;
+  i64toi32_i32$0 = i32_left() | 0;
   wasm2js_i32$0 = i64toi32_i32$0;
-  wasm2js_i32$1 = $1;
+  wasm2js_i32$1 = i64_right() | 0;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   wasm2js_i32$0 = i64toi32_i32$0;
-  wasm2js_i32$1 = i64toi32_i32$1;
+  wasm2js_i32$1 = i64toi32_i32$HIGH_BITS;
   (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
   return get() | 0 | 0;
  }
  
  function $88() {
-  var $0 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var $1 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   reset();
-  $0 = i32_left() | 0;
+  $1 = i32_left() | 0;
   i64toi32_i32$0 = i64_right() | 0;
-  wasm2js_i32$0 = $0;
+  wasm2js_i32$0 = $1;
   wasm2js_i32$1 = i64toi32_i32$0;
   HEAP8[wasm2js_i32$0 >> 0] = wasm2js_i32$1;
   return get() | 0 | 0;
  }
  
  function $89() {
-  var $0 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var $1 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   reset();
-  $0 = i32_left() | 0;
+  $1 = i32_left() | 0;
   i64toi32_i32$0 = i64_right() | 0;
-  wasm2js_i32$0 = $0;
+  wasm2js_i32$0 = $1;
   wasm2js_i32$1 = i64toi32_i32$0;
   HEAP16[wasm2js_i32$0 >> 1] = wasm2js_i32$1;
   return get() | 0 | 0;
  }
  
  function $90() {
-  var $0 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
+  var $1 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0;
   reset();
-  $0 = i32_left() | 0;
+  $1 = i32_left() | 0;
   i64toi32_i32$0 = i64_right() | 0;
-  wasm2js_i32$0 = $0;
+  wasm2js_i32$0 = $1;
   wasm2js_i32$1 = i64toi32_i32$0;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   return get() | 0 | 0;
  }
  
  function $91() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$0 = 0, $1 = 0, $2 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64_dummy($0 | 0, i64toi32_i32$0 | 0, $1 | 0, i64toi32_i32$1 | 0);
+  $1 = i64toi32_i32$0;
+  $2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  i64_dummy($1 | 0, $2 | 0, i64toi32_i32$0 | 0, i64toi32_i32$HIGH_BITS | 0);
   return get() | 0 | 0;
  }
  
  function $92() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0, wasm2js_i32$4 = 0;
+  var i64toi32_i32$0 = 0, $1 = 0, $2 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0, wasm2js_i32$4 = 0;
   reset();
   i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  wasm2js_i32$1 = $0;
-  wasm2js_i32$2 = i64toi32_i32$0;
-  wasm2js_i32$3 = $1;
-  wasm2js_i32$4 = i64toi32_i32$1;
+  $1 = i64toi32_i32$0;
+  $2 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64_right() | 0;
+  wasm2js_i32$1 = $1;
+  wasm2js_i32$2 = $2;
+  wasm2js_i32$3 = i64toi32_i32$0;
+  wasm2js_i32$4 = i64toi32_i32$HIGH_BITS;
   wasm2js_i32$0 = i64_callee() | 0;
   FUNCTION_TABLE_iiiii[wasm2js_i32$0 & 7](wasm2js_i32$1 | 0, wasm2js_i32$2 | 0, wasm2js_i32$3 | 0, wasm2js_i32$4 | 0) | 0;
   return get() | 0 | 0;
  }
  
  function $93() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $0 = 0, $0$hi = 0, $1 = 0, $1$hi = 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
   reset();
-  i64toi32_i32$0 = i64_left() | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $0 = i64toi32_i32$0;
-  $0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64_right() | 0;
-  i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  $1 = i64toi32_i32$1;
-  $1$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$1 = $1$hi;
-  i64toi32_i32$0 = i64toi32_i32$1;
-  i64toi32_i32$0 = i64toi32_i32$1;
-  i64_bool() | 0;
+  i64toi32_i32$2 = i64_left() | 0;
+  i64toi32_i32$3 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$2 = i64_right() | 0;
+  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$2;
+  i64toi32_i32$2 = i64_bool() | 0;
+  i64toi32_i32$3 = (wasm2js_i32$0 = i64toi32_i32$3, wasm2js_i32$1 = i64toi32_i32$4, wasm2js_i32$2 = i64toi32_i32$2, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
   return get() | 0 | 0;
  }
  
@@ -1214,41 +1018,31 @@ function asmFunc(global, env, buffer) {
  }
  
  function $115() {
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, $2 = 0, $2$hi = 0, $5 = 0, $5$hi = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_f64$0 = 0.0, wasm2js_i32$1 = 0;
   reset();
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = +f64_left();
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$0 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = HEAP32[0 >> 2] | 0;
-  i64toi32_i32$1 = 2147483647;
-  i64toi32_i32$3 = 4294967295;
-  i64toi32_i32$1 = i64toi32_i32$0 & i64toi32_i32$1 | 0;
-  $2 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
-  $2$hi = i64toi32_i32$1;
+  i64toi32_i32$2 = HEAP32[(0 + 4 | 0) >> 2] | 0;
+  i64toi32_i32$1 = HEAP32[0 >> 2] | 0;
+  i64toi32_i32$3 = 2147483647;
+  i64toi32_i32$4 = 4294967295;
+  i64toi32_i32$3 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 & i64toi32_i32$4 | 0;
   wasm2js_i32$0 = 0;
   wasm2js_f64$0 = +f64_right();
   HEAPF64[wasm2js_i32$0 >> 3] = wasm2js_f64$0;
-  i64toi32_i32$1 = HEAP32[(0 + 4 | 0) >> 2] | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = HEAP32[0 >> 2] | 0;
-  i64toi32_i32$2 = 2147483648;
-  i64toi32_i32$3 = 0;
-  i64toi32_i32$2 = i64toi32_i32$1 & i64toi32_i32$2 | 0;
-  $5 = i64toi32_i32$0 & i64toi32_i32$3 | 0;
-  $5$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = $2$hi;
-  i64toi32_i32$1 = $2;
-  i64toi32_i32$0 = $5$hi;
-  i64toi32_i32$3 = $5;
-  i64toi32_i32$0 = i64toi32_i32$2 | i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = HEAP32[(0 + 4 | 0) >> 2] | 0;
+  i64toi32_i32$1 = HEAP32[0 >> 2] | 0;
+  i64toi32_i32$4 = 2147483648;
+  i64toi32_i32$4 = i64toi32_i32$2 & i64toi32_i32$4 | 0;
+  i64toi32_i32$1 = i64toi32_i32$1 & 0 | 0;
+  i64toi32_i32$4 = i64toi32_i32$3 | i64toi32_i32$4 | 0;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$1 | i64toi32_i32$3 | 0;
+  wasm2js_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
   HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
   wasm2js_i32$0 = 0;
-  wasm2js_i32$1 = i64toi32_i32$0;
+  wasm2js_i32$1 = i64toi32_i32$4;
   HEAP32[(wasm2js_i32$0 + 4 | 0) >> 2] = wasm2js_i32$1;
   +HEAPF64[0 >> 3];
   return get() | 0 | 0;
@@ -1335,24 +1129,24 @@ function asmFunc(global, env, buffer) {
  }
  
  function $128() {
-  var $3 = 0;
+  var $0 = 0;
   block : {
    reset();
-   $3 = i32_left() | 0;
+   $0 = i32_left() | 0;
    if ((i32_right() | 0) & 0 | 0) break block;
-   $3 = get() | 0;
+   $0 = get() | 0;
   };
-  return $3 | 0;
+  return $0 | 0;
  }
  
  function $129() {
-  var $2 = 0, $3 = 0, $4 = 0;
+  var $0 = 0, $1 = 0, $2 = 0;
   a : {
    reset();
    b : {
-    $2 = i32_left() | 0;
-    $3 = $2;
-    $4 = $2;
+    $0 = i32_left() | 0;
+    $1 = $0;
+    $2 = $0;
     switch (i32_right() | 0 | 0) {
     case 0:
      break a;
@@ -1360,9 +1154,9 @@ function asmFunc(global, env, buffer) {
      break b;
     };
    };
-   $3 = get() | 0;
+   $1 = get() | 0;
   };
-  return $3 | 0;
+  return $1 | 0;
  }
  
  function _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1370,78 +1164,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45_1 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16 = 0, $17 = 0, var$6 = 0, $18 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $23 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19 = Math_imul(var$4, var$5);
+  $20 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23 = $17 + Math_imul($18, $21) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21 = $19 + Math_imul($20, $16) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $22 = $21 + Math_imul($17, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45_1 = $29 + (var$2 >>> 16 | 0) | 0;
+  $23 = $22 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45_1 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
+  i64toi32_i32$4 = $23 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Div3div17he78fc483e41d7ec7E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1449,124 +1233,93 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$5 = 0, i64toi32_i32$8 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$7 = 0, i64toi32_i32$9 = 0, var$2 = 0, i64toi32_i32$0 = 0, $15 = 0, $16 = 0, i64toi32_i32$1 = 0, $17 = 0, $18 = 0, $19 = 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$7 = 63;
+  i64toi32_i32$8 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$5 >> 31 | 0;
+   $15 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
+   $15 = (((1 << i64toi32_i32$8 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$8 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$8 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $21;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$0 = var$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  var$2 = $15;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$4;
+  i64toi32_i32$4 = var$0$hi;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$4 = i64toi32_i32$6 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$3 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$3 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 >>> 0 < i64toi32_i32$6 >>> 0;
+  i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$4 - i64toi32_i32$7 | 0;
+  $18 = i64toi32_i32$5;
+  $19 = i64toi32_i32$7;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$9 = i64toi32_i32$8 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$8 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 >> 31 | 0;
+   $16 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$5 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
+   $16 = (((1 << i64toi32_i32$9 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$9 | 0) | 0 | (i64toi32_i32$6 >>> i64toi32_i32$9 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  var$2 = $16;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
+  i64toi32_i32$6 = i64toi32_i32$5 ^ i64toi32_i32$6 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$4 = i64toi32_i32$5;
+  i64toi32_i32$5 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$9 = i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0;
+  i64toi32_i32$8 = i64toi32_i32$9 + i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = i64toi32_i32$6 - i64toi32_i32$8 | 0;
+  i64toi32_i32$8 = __wasm_i64_udiv($18 | 0, $19 | 0, i64toi32_i32$3 | 0, i64toi32_i32$8 | 0) | 0;
+  i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$8;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$5 = i64toi32_i32$6 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = 63;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$5 >> 31 | 0;
+   $17 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
+   $17 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$8 >>> i64toi32_i32$4 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  var$0 = $23;
+  var$0 = $17;
+  i64toi32_i32$8 = var$0;
   var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$8 = i64toi32_i32$8;
+  i64toi32_i32$2 = i64toi32_i32$7 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 ^ i64toi32_i32$8 | 0;
   i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$7 = i64toi32_i32$8;
+  i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+  i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$7 >>> 0;
+  i64toi32_i32$5 = i64toi32_i32$6 + var$0$hi | 0;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = i64toi32_i32$8;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$8 | 0;
  }
  
  function _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1574,101 +1327,77 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$5 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, var$2 = 0, $20 = 0, $21 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17$hi = 0, $19$hi = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $20 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$6 = 0, i64toi32_i32$8 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$7 = 0, i64toi32_i32$9 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$0 = 0, $16 = 0, $17 = 0, i64toi32_i32$1 = 0, $18 = 0, $19 = 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$7 = 63;
+  i64toi32_i32$8 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$5 >> 31 | 0;
+   $16 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $20 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
+   $16 = (((1 << i64toi32_i32$8 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$8 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$8 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $20;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$0 = var$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $21 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  var$2 = $16;
+  i64toi32_i32$4 = var$2;
+  var$2$hi = i64toi32_i32$6;
+  i64toi32_i32$3 = i64toi32_i32$4;
+  i64toi32_i32$4 = var$0$hi;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$4 = i64toi32_i32$6 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$3 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$3 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 >>> 0 < i64toi32_i32$6 >>> 0;
+  i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$4 - i64toi32_i32$7 | 0;
+  $18 = i64toi32_i32$5;
+  $19 = i64toi32_i32$7;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$9 = i64toi32_i32$8 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$8 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 >> 31 | 0;
+   $17 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $21 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$5 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
+   $17 = (((1 << i64toi32_i32$9 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$9 | 0) | 0 | (i64toi32_i32$6 >>> i64toi32_i32$9 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$0 = $21;
-  var$0$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$2 = var$1$hi;
+  var$0 = $17;
+  i64toi32_i32$6 = var$0;
+  var$0$hi = i64toi32_i32$5;
+  i64toi32_i32$4 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_urem($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$2$hi;
-  i64toi32_i32$4 = $17$hi;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  $19$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$1 = $19$hi;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$2 = var$2$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = i64toi32_i32$4 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$2 | 0;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$6 = i64toi32_i32$5 ^ i64toi32_i32$6 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 ^ i64toi32_i32$3 | 0;
   i64toi32_i32$4 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$4 | 0;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$9 = i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0;
+  i64toi32_i32$8 = i64toi32_i32$9 + i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = i64toi32_i32$6 - i64toi32_i32$8 | 0;
+  i64toi32_i32$8 = __wasm_i64_urem($18 | 0, $19 | 0, i64toi32_i32$3 | 0, i64toi32_i32$8 | 0) | 0;
+  i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$8;
+  i64toi32_i32$8 = var$2$hi;
+  i64toi32_i32$2 = var$2;
+  i64toi32_i32$8 = i64toi32_i32$7 ^ i64toi32_i32$8 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$1 = var$2$hi;
+  i64toi32_i32$7 = i64toi32_i32$2;
+  i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
+  i64toi32_i32$5 = i64toi32_i32$0 >>> 0 < i64toi32_i32$7 >>> 0;
+  i64toi32_i32$6 = i64toi32_i32$5 + var$2$hi | 0;
+  i64toi32_i32$6 = i64toi32_i32$8 - i64toi32_i32$6 | 0;
+  i64toi32_i32$0 = i64toi32_i32$2;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$6;
+  return i64toi32_i32$2 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -1676,7 +1405,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $38_1 = 0, $39_1 = 0, $40_1 = 0, $41_1 = 0, $42_1 = 0, $43_1 = 0, $44_1 = 0, $45_1 = 0, var$8$hi = 0, $46_1 = 0, $47_1 = 0, $48_1 = 0, $49_1 = 0, var$7$hi = 0, $50_1 = 0, $63$hi = 0, $65_1 = 0, $65$hi = 0, $66_1 = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$2 = 0, var$3 = 0, i64toi32_i32$9 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, var$4 = 0, var$5 = 0, var$6 = 0, var$5$hi = 0, var$6$hi = 0, $24 = 0, $25 = 0, $26 = 0, $27 = 0, $28 = 0, $29 = 0, $30 = 0, $31 = 0, $32 = 0, $33 = 0, $34 = 0, $35_1 = 0, $36_1 = 0, $37_1 = 0, $38_1 = 0, var$8 = 0, var$8$hi = 0, var$7$hi = 0, var$7 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -1688,135 +1417,117 @@ function asmFunc(global, env, buffer) {
           label$9 : {
            label$10 : {
             label$11 : {
-             i64toi32_i32$0 = var$0$hi;
-             i64toi32_i32$0 = i64toi32_i32$0;
-             i64toi32_i32$2 = var$0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$0$hi;
+             i64toi32_i32$0 = var$0;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$3 = 32;
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $38_1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              i64toi32_i32$2 = 0;
+              $24 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
              } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $38_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+              $24 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
              }
-             i64toi32_i32$1 = i64toi32_i32$1;
-             var$2 = $38_1;
+             var$2 = $24;
              if (var$2) block : {
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
+              i64toi32_i32$2 = var$1$hi;
               var$3 = var$1;
               if ((var$3 | 0) == (0 | 0)) break label$11;
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
-              i64toi32_i32$0 = var$1;
-              i64toi32_i32$2 = 0;
+              i64toi32_i32$0 = var$1$hi;
+              i64toi32_i32$2 = var$1;
+              i64toi32_i32$1 = 0;
               i64toi32_i32$3 = 32;
               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-               i64toi32_i32$2 = 0;
-               $39_1 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+               i64toi32_i32$1 = 0;
+               $25 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
               } else {
-               i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               $39_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+               $25 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
               }
-              i64toi32_i32$2 = i64toi32_i32$2;
-              var$4 = $39_1;
+              var$4 = $25;
               if ((var$4 | 0) == (0 | 0)) break label$9;
               var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
               if (var$2 >>> 0 <= 31 >>> 0) break label$8;
               break label$2;
-             };
+             }
              i64toi32_i32$2 = var$1$hi;
-             i64toi32_i32$2 = i64toi32_i32$2;
              i64toi32_i32$1 = var$1;
              i64toi32_i32$0 = 1;
              i64toi32_i32$3 = 0;
              if (i64toi32_i32$2 >>> 0 > i64toi32_i32$0 >>> 0 | ((i64toi32_i32$2 | 0) == (i64toi32_i32$0 | 0) & i64toi32_i32$1 >>> 0 >= i64toi32_i32$3 >>> 0 | 0) | 0) break label$2;
-             i64toi32_i32$1 = var$0$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$1 = 1024;
+             i64toi32_i32$2 = var$0$hi;
              var$2 = var$0;
-             i64toi32_i32$1 = var$1$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$2 = var$1$hi;
              var$3 = var$1;
              var$2 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-             i64toi32_i32$1 = 0;
-             i64toi32_i32$2 = 1024;
-             i64toi32_i32$1 = i64toi32_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$3 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$2 = 0;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$3;
              HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = i64toi32_i32$1;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$2;
              (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$2;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$1 = i64toi32_i32$1;
-             i64toi32_i32$2 = var$2;
-             i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-             return i64toi32_i32$2 | 0;
+             i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+             return i64toi32_i32$1 | 0;
             };
             i64toi32_i32$2 = var$1$hi;
-            i64toi32_i32$2 = i64toi32_i32$2;
-            i64toi32_i32$3 = var$1;
-            i64toi32_i32$1 = 0;
+            i64toi32_i32$1 = var$1;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$0 = 32;
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $40_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             i64toi32_i32$3 = 0;
+             $26 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $40_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $26 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
             }
-            i64toi32_i32$1 = i64toi32_i32$1;
-            var$3 = $40_1;
-            i64toi32_i32$1 = var$0$hi;
-            i64toi32_i32$1 = i64toi32_i32$1;
+            var$3 = $26;
+            i64toi32_i32$3 = var$0$hi;
             if ((var$0 | 0) == (0 | 0)) break label$7;
             if ((var$3 | 0) == (0 | 0)) break label$6;
             var$4 = var$3 + 4294967295 | 0;
             if (var$4 & var$3 | 0) break label$6;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $41_1 = 0;
+            i64toi32_i32$3 = 1024;
+            $37_1 = i64toi32_i32$3;
+            i64toi32_i32$4 = var$4 & var$2 | 0;
+            i64toi32_i32$0 = 0;
+            i64toi32_i32$2 = i64toi32_i32$4;
+            i64toi32_i32$4 = 0;
+            i64toi32_i32$5 = 32;
+            i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+            if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+             i64toi32_i32$4 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
+             $27 = 0;
             } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $41_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$6 | 0) | 0;
+             $27 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
             }
-            $63$hi = i64toi32_i32$3;
-            i64toi32_i32$3 = var$0$hi;
-            i64toi32_i32$3 = i64toi32_i32$3;
-            i64toi32_i32$1 = var$0;
-            i64toi32_i32$2 = 0;
-            i64toi32_i32$0 = 4294967295;
-            i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
-            $65_1 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
-            $65$hi = i64toi32_i32$2;
-            i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $41_1;
-            i64toi32_i32$1 = $65$hi;
-            i64toi32_i32$0 = $65_1;
-            i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
-            $66_1 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-            i64toi32_i32$3 = 1024;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = $66_1;
+            i64toi32_i32$1 = $27;
+            i64toi32_i32$0 = var$0$hi;
+            i64toi32_i32$2 = var$0;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$6 = 4294967295;
+            i64toi32_i32$5 = i64toi32_i32$0 & i64toi32_i32$5 | 0;
+            i64toi32_i32$2 = i64toi32_i32$2 & i64toi32_i32$6 | 0;
+            i64toi32_i32$5 = i64toi32_i32$4 | i64toi32_i32$5 | 0;
+            wasm2js_i32$0 = $37_1;
+            wasm2js_i32$1 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
             HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
             wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = i64toi32_i32$1;
+            wasm2js_i32$1 = i64toi32_i32$5;
             (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
             i64toi32_i32$3 = var$2 >>> ((__wasm_ctz_i32(var$3 | 0) | 0) & 31 | 0) | 0;
-            i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$3 = i64toi32_i32$3;
+            i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
             return i64toi32_i32$3 | 0;
            };
           };
@@ -1830,305 +1541,258 @@ function asmFunc(global, env, buffer) {
          var$2 = var$2 + 1 | 0;
          break label$3;
         };
+        i64toi32_i32$3 = 1024;
+        $38_1 = i64toi32_i32$3;
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$3 = i64toi32_i32$3;
-        i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
+        i64toi32_i32$4 = var$2 - Math_imul(var$4, var$3) | 0;
         i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $42_1 = 0;
+        i64toi32_i32$5 = i64toi32_i32$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$2 = 32;
+        i64toi32_i32$0 = i64toi32_i32$2 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+         i64toi32_i32$4 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
+         $28 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $42_1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         i64toi32_i32$4 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$0 | 0) | 0;
+         $28 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
         }
-        i64toi32_i32$2 = 1024;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = $42_1;
+        wasm2js_i32$0 = $38_1;
+        wasm2js_i32$1 = $28;
         HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = i64toi32_i32$1;
+        wasm2js_i32$0 = i64toi32_i32$3;
+        wasm2js_i32$1 = i64toi32_i32$4;
         (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        i64toi32_i32$2 = var$4;
-        i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-        return i64toi32_i32$2 | 0;
+        i64toi32_i32$3 = var$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$3 = i64toi32_i32$3;
+        i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+        return i64toi32_i32$3 | 0;
        };
        var$2 = Math_clz32(var$3) - Math_clz32(var$2) | 0;
        if (var$2 >>> 0 < 31 >>> 0) break label$4;
        break label$2;
       };
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$2 = 0;
-      i64toi32_i32$1 = 1024;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = var$4 & var$0 | 0;
+      i64toi32_i32$3 = 1024;
+      i64toi32_i32$4 = var$0$hi;
+      i64toi32_i32$5 = var$4 & var$0 | 0;
+      i64toi32_i32$4 = 0;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$5;
       HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = i64toi32_i32$2;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$4;
       (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
       if ((var$3 | 0) == (1 | 0)) break label$1;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = 0;
-      $120$hi = i64toi32_i32$2;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$3 = var$0;
-      i64toi32_i32$1 = $120$hi;
-      i64toi32_i32$0 = __wasm_ctz_i32(var$3 | 0) | 0;
-      i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-      if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-       i64toi32_i32$1 = 0;
-       $43_1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+      i64toi32_i32$3 = var$0$hi;
+      i64toi32_i32$4 = var$0;
+      i64toi32_i32$1 = __wasm_ctz_i32(var$3 | 0) | 0;
+      i64toi32_i32$5 = 0;
+      i64toi32_i32$1 = i64toi32_i32$1;
+      i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+      if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+       i64toi32_i32$5 = 0;
+       $29 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
       } else {
-       i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $43_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       i64toi32_i32$5 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
+       $29 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
       }
-      i64toi32_i32$1 = i64toi32_i32$1;
-      i64toi32_i32$3 = $43_1;
-      i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-      return i64toi32_i32$3 | 0;
+      i64toi32_i32$4 = $29;
+      i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+      return i64toi32_i32$4 | 0;
      };
      var$3 = 63 - var$2 | 0;
      var$2 = var$2 + 1 | 0;
     };
-    i64toi32_i32$3 = var$0$hi;
+    i64toi32_i32$5 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = var$2 & 63 | 0;
     i64toi32_i32$3 = 0;
-    $129$hi = i64toi32_i32$3;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = $129$hi;
-    i64toi32_i32$0 = var$2 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$1 = 0;
-     $44_1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$3 = 0;
+     $30 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
     } else {
-     i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $44_1 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     i64toi32_i32$3 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+     $30 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
     }
-    i64toi32_i32$1 = i64toi32_i32$1;
-    var$5 = $44_1;
-    var$5$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
-    i64toi32_i32$1 = 0;
-    $134$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
+    var$5 = $30;
+    var$5$hi = i64toi32_i32$3;
+    i64toi32_i32$4 = var$0$hi;
     i64toi32_i32$3 = var$0;
-    i64toi32_i32$2 = $134$hi;
-    i64toi32_i32$0 = var$3 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $45_1 = 0;
+    i64toi32_i32$1 = var$3 & 63 | 0;
+    i64toi32_i32$5 = 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$5 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
+     $31 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $45_1 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     i64toi32_i32$5 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$2 | 0) | 0;
+     $31 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
     }
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = $45_1;
-    var$0$hi = i64toi32_i32$2;
+    var$0 = $31;
+    var$0$hi = i64toi32_i32$5;
     label$13 : {
      if (var$2) block3 : {
-      i64toi32_i32$2 = var$1$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$1 = var$1;
-      i64toi32_i32$3 = 4294967295;
-      i64toi32_i32$0 = 4294967295;
-      i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-      if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-      i64toi32_i32$5 = i64toi32_i32$5;
-      var$8 = i64toi32_i32$4;
-      var$8$hi = i64toi32_i32$5;
+      i64toi32_i32$3 = var$1$hi;
+      i64toi32_i32$5 = var$1;
+      i64toi32_i32$4 = 4294967295;
+      i64toi32_i32$1 = 4294967295;
+      i64toi32_i32$2 = i64toi32_i32$5 + i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$4 | 0;
+      if (i64toi32_i32$2 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0;
+      var$8 = i64toi32_i32$2;
+      var$8$hi = i64toi32_i32$0;
       label$15 : do {
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$5;
-       i64toi32_i32$1 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        $46_1 = 0;
+       i64toi32_i32$1 = var$5$hi;
+       i64toi32_i32$3 = var$5;
+       i64toi32_i32$4 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$6 = i64toi32_i32$2 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+        i64toi32_i32$4 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
+        $32 = 0;
        } else {
-        i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-        $46_1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+        i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$6 | 0) | 0;
+        $32 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
        }
-       $140 = $46_1;
-       $140$hi = i64toi32_i32$1;
+       i64toi32_i32$5 = $32;
        i64toi32_i32$1 = var$0$hi;
-       i64toi32_i32$1 = i64toi32_i32$1;
-       i64toi32_i32$5 = var$0;
+       i64toi32_i32$3 = var$0;
        i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
+       i64toi32_i32$6 = 63;
+       i64toi32_i32$7 = i64toi32_i32$6 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
         i64toi32_i32$2 = 0;
-        $47_1 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $33 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        $47_1 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
+        $33 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$7 | 0) | 0;
        }
-       $142$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = $140$hi;
-       i64toi32_i32$1 = $140;
-       i64toi32_i32$5 = $142$hi;
-       i64toi32_i32$0 = $47_1;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-       var$5$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       $144 = var$5;
-       $144$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$2 = var$8;
-       i64toi32_i32$1 = var$5$hi;
-       i64toi32_i32$0 = var$5;
-       i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-       i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-       i64toi32_i32$4 = i64toi32_i32$4;
-       i64toi32_i32$5 = i64toi32_i32$3;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-        $48_1 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+       i64toi32_i32$3 = $33;
+       i64toi32_i32$2 = i64toi32_i32$4 | i64toi32_i32$2 | 0;
+       var$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
+       i64toi32_i32$5 = var$5;
+       var$5$hi = i64toi32_i32$2;
+       i64toi32_i32$0 = i64toi32_i32$5;
+       i64toi32_i32$1 = var$8$hi;
+       i64toi32_i32$3 = var$8;
+       i64toi32_i32$6 = i64toi32_i32$2;
+       i64toi32_i32$7 = i64toi32_i32$5;
+       i64toi32_i32$9 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$5 >>> 0) + i64toi32_i32$2 | 0;
+       i64toi32_i32$9 = i64toi32_i32$1 - i64toi32_i32$9 | 0;
+       i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$5 | 0;
+       i64toi32_i32$3 = 0;
+       i64toi32_i32$1 = 63;
+       i64toi32_i32$7 = i64toi32_i32$1 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+        i64toi32_i32$3 = i64toi32_i32$9 >> 31 | 0;
+        $34 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        $48_1 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+        i64toi32_i32$3 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
+        $34 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$9 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$7 | 0) | 0;
        }
-       i64toi32_i32$2 = i64toi32_i32$2;
-       var$6 = $48_1;
-       var$6$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = i64toi32_i32$2;
-       i64toi32_i32$2 = var$1$hi;
-       i64toi32_i32$2 = var$6$hi;
+       var$6 = $34;
        i64toi32_i32$4 = var$6;
-       i64toi32_i32$5 = var$1$hi;
-       i64toi32_i32$0 = var$1;
-       i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-       $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-       $151$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = $144$hi;
-       i64toi32_i32$2 = $144;
-       i64toi32_i32$4 = $151$hi;
-       i64toi32_i32$0 = $151;
-       i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-       i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$5 = i64toi32_i32$1;
-       var$5$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = var$0$hi;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$5 = var$0;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        $49_1 = 0;
+       var$6$hi = i64toi32_i32$3;
+       i64toi32_i32$5 = i64toi32_i32$4;
+       i64toi32_i32$4 = var$1$hi;
+       i64toi32_i32$9 = var$1;
+       i64toi32_i32$4 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+       i64toi32_i32$5 = i64toi32_i32$5 & i64toi32_i32$9 | 0;
+       i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+       i64toi32_i32$1 = i64toi32_i32$0 >>> 0 < i64toi32_i32$5 >>> 0;
+       i64toi32_i32$9 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+       i64toi32_i32$9 = i64toi32_i32$2 - i64toi32_i32$9 | 0;
+       var$5 = i64toi32_i32$3;
+       var$5$hi = i64toi32_i32$9;
+       i64toi32_i32$2 = var$0$hi;
+       i64toi32_i32$0 = var$0;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$4 = 1;
+       i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+        i64toi32_i32$5 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
+        $35_1 = 0;
        } else {
-        i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-        $49_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+        i64toi32_i32$5 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$3 | 0) | 0;
+        $35_1 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
        }
-       $154$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = var$7$hi;
-       i64toi32_i32$2 = $154$hi;
-       i64toi32_i32$3 = $49_1;
-       i64toi32_i32$5 = var$7$hi;
-       i64toi32_i32$0 = var$7;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-       var$0$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$6$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$6;
-       i64toi32_i32$3 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-       var$6$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$7 = var$6;
-       var$7$hi = i64toi32_i32$3;
+       i64toi32_i32$9 = $35_1;
+       i64toi32_i32$0 = var$7$hi;
+       i64toi32_i32$2 = var$7;
+       i64toi32_i32$0 = i64toi32_i32$5 | i64toi32_i32$0 | 0;
+       var$0 = i64toi32_i32$9 | i64toi32_i32$2 | 0;
+       var$0$hi = i64toi32_i32$0;
+       i64toi32_i32$9 = var$6$hi;
+       i64toi32_i32$0 = var$6;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$5 = i64toi32_i32$9 & i64toi32_i32$5 | 0;
+       var$6 = i64toi32_i32$0 & i64toi32_i32$2 | 0;
+       i64toi32_i32$0 = var$6;
+       var$6$hi = i64toi32_i32$5;
+       var$7 = i64toi32_i32$0;
+       var$7$hi = i64toi32_i32$5;
        var$2 = var$2 + 4294967295 | 0;
        if (var$2) continue label$15;
        break label$15;
       } while (1);
       break label$13;
-     };
+     }
     };
-    i64toi32_i32$3 = var$5$hi;
-    i64toi32_i32$2 = 1024;
-    i64toi32_i32$3 = i64toi32_i32$3;
-    wasm2js_i32$0 = i64toi32_i32$2;
+    i64toi32_i32$5 = 1024;
+    i64toi32_i32$0 = var$5$hi;
+    wasm2js_i32$0 = i64toi32_i32$5;
     wasm2js_i32$1 = var$5;
     HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-    wasm2js_i32$0 = i64toi32_i32$2;
-    wasm2js_i32$1 = i64toi32_i32$3;
+    wasm2js_i32$0 = i64toi32_i32$5;
+    wasm2js_i32$1 = i64toi32_i32$0;
     (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$3 = i64toi32_i32$3;
+    i64toi32_i32$9 = var$0$hi;
     i64toi32_i32$5 = var$0;
     i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $50_1 = 0;
+    i64toi32_i32$4 = 1;
+    i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
+     $36_1 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $50_1 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$2 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$9 << i64toi32_i32$3 | 0) | 0;
+     $36_1 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $50_1;
+    i64toi32_i32$0 = $36_1;
     i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
+    i64toi32_i32$9 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$9 | 0;
     i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    return i64toi32_i32$0 | 0;
    };
-   i64toi32_i32$3 = var$0$hi;
-   i64toi32_i32$5 = 1024;
-   i64toi32_i32$3 = i64toi32_i32$3;
-   wasm2js_i32$0 = i64toi32_i32$5;
+   i64toi32_i32$0 = 1024;
+   i64toi32_i32$5 = var$0$hi;
+   wasm2js_i32$0 = i64toi32_i32$0;
    wasm2js_i32$1 = var$0;
    HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-   wasm2js_i32$0 = i64toi32_i32$5;
-   wasm2js_i32$1 = i64toi32_i32$3;
+   wasm2js_i32$0 = i64toi32_i32$0;
+   wasm2js_i32$1 = i64toi32_i32$5;
    (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$5 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$5;
   };
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$0 | 0;
+ }
+ 
+ function __wasm_ctz_i32(var$0) {
+  var$0 = var$0 | 0;
+  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
+  return 32 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -2136,14 +1800,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -2154,14 +1815,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4sdiv3Div3div17he78fc483e41d7ec7E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -2172,14 +1830,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4sdiv3Mod4mod_17h2cbb7bbf36e41d68E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -2190,14 +1845,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -2210,29 +1862,17 @@ function asmFunc(global, env, buffer) {
   var$1$hi = var$1$hi | 0;
   var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, wasm2js_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$2 = 1024;
   i64toi32_i32$0 = HEAPU32[i64toi32_i32$2 >> 2] | 0;
   i64toi32_i32$1 = (wasm2js_i32$0 = i64toi32_i32$2, HEAPU8[(wasm2js_i32$0 + 4 | 0) >> 0] | 0 | 0 | (HEAPU8[(wasm2js_i32$0 + 5 | 0) >> 0] | 0 | 0) << 8 | (HEAPU8[(wasm2js_i32$0 + 6 | 0) >> 0] | 0 | 0) << 16 | (HEAPU8[(wasm2js_i32$0 + 7 | 0) >> 0] | 0 | 0) << 24);
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
   return i64toi32_i32$0 | 0;
  }
  
- function __wasm_ctz_i32(var$0) {
-  var$0 = var$0 | 0;
-  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
-  return 32 | 0;
- }
- 
  var FUNCTION_TABLE_idd = [f64_t0, f64_t0, f64_t0, f64_t0, f64_t0, f64_t0, f64_t0, f64_t1];
  var FUNCTION_TABLE_iff = [f32_t0, f32_t0, f32_t0, f32_t0, f32_t0, f32_t1, f32_t0, f32_t0];
  var FUNCTION_TABLE_iii = [i32_t0, i32_t1, i32_t0, i32_t0, i32_t0, i32_t0, i32_t0, i32_t0];
@@ -39,7 +39,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $3() {
-  var $2_1 = 0;
+  var $0 = 0;
   loop_in : do {
    dummy();
    dummy();
@@ -51,14 +51,14 @@ function asmFunc(global, env, buffer) {
    dummy();
    dummy();
    dummy();
-   $2_1 = 8;
+   $0 = 8;
    break loop_in1;
   } while (1);
-  return $2_1 | 0;
+  return $0 | 0;
  }
  
  function $4() {
-  var $2_1 = 0;
+  var $0 = 0;
   loop_in : do {
    loop_in2 : do {
     dummy();
@@ -66,16 +66,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
    loop_in3 : do {
     dummy();
-    $2_1 = 9;
+    $0 = 9;
     break loop_in3;
    } while (1);
    break loop_in;
   } while (1);
-  return $2_1 | 0;
+  return $0 | 0;
  }
  
  function $5() {
-  var $82 = 0, $2_1 = 0, $6_1 = 0, $10_1 = 0, $14_1 = 0, $18_1 = 0, $22 = 0, $26 = 0, $30 = 0, $34 = 0, $38 = 0, $42 = 0, $46 = 0, $50 = 0, $54 = 0, $58 = 0, $62 = 0, $66 = 0, $70 = 0, $74 = 0, $78 = 0;
+  var $0 = 0, $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, $11_1 = 0, $12_1 = 0, $13_1 = 0, $14_1 = 0, $15 = 0, $16_1 = 0, $17_1 = 0, $18_1 = 0, $19 = 0, $20 = 0;
   loop_in : do {
    loop_in4 : do {
     loop_in6 : do {
@@ -99,124 +99,124 @@ function asmFunc(global, env, buffer) {
                       loop_in42 : do {
                        loop_in44 : do {
                         dummy();
-                        $2_1 = 150;
+                        $1_1 = 150;
                         break loop_in44;
                        } while (1);
-                       $6_1 = $2_1;
+                       $2_1 = $1_1;
                        break loop_in42;
                       } while (1);
-                      $10_1 = $6_1;
+                      $3_1 = $2_1;
                       break loop_in40;
                      } while (1);
-                     $14_1 = $10_1;
+                     $4_1 = $3_1;
                      break loop_in38;
                     } while (1);
-                    $18_1 = $14_1;
+                    $5_1 = $4_1;
                     break loop_in36;
                    } while (1);
-                   $22 = $18_1;
+                   $6_1 = $5_1;
                    break loop_in34;
                   } while (1);
-                  $26 = $22;
+                  $7_1 = $6_1;
                   break loop_in32;
                  } while (1);
-                 $30 = $26;
+                 $8_1 = $7_1;
                  break loop_in30;
                 } while (1);
-                $34 = $30;
+                $9_1 = $8_1;
                 break loop_in28;
                } while (1);
-               $38 = $34;
+               $10_1 = $9_1;
                break loop_in26;
               } while (1);
-              $42 = $38;
+              $11_1 = $10_1;
               break loop_in24;
              } while (1);
-             $46 = $42;
+             $12_1 = $11_1;
              break loop_in22;
             } while (1);
-            $50 = $46;
+            $13_1 = $12_1;
             break loop_in20;
            } while (1);
-           $54 = $50;
+           $14_1 = $13_1;
            break loop_in18;
           } while (1);
-          $58 = $54;
+          $15 = $14_1;
           break loop_in16;
          } while (1);
-         $62 = $58;
+         $16_1 = $15;
          break loop_in14;
         } while (1);
-        $66 = $62;
+        $17_1 = $16_1;
         break loop_in12;
        } while (1);
-       $70 = $66;
+       $18_1 = $17_1;
        break loop_in10;
       } while (1);
-      $74 = $70;
+      $19 = $18_1;
       break loop_in8;
      } while (1);
-     $78 = $74;
+     $20 = $19;
      break loop_in6;
     } while (1);
-    $82 = $78;
+    $0 = $20;
     break loop_in4;
    } while (1);
    break loop_in;
   } while (1);
-  return $82 | 0;
+  return $0 | 0;
  }
  
  function $6() {
-  var $2_1 = 0;
+  var $0 = 0;
   loop_in : do {
    dummy();
-   $2_1 = 13;
+   $0 = 13;
    break loop_in;
   } while (1);
-  return __wasm_ctz_i32($2_1 | 0) | 0 | 0;
+  return __wasm_ctz_i32($0 | 0) | 0 | 0;
  }
  
  function $7() {
-  var $2_1 = 0, $3_1 = 0, $6_1 = 0;
+  var $0 = 0, $1_1 = 0, $2_1 = 0;
   loop_in : do {
    dummy();
-   $2_1 = 3;
+   $0 = 3;
    break loop_in;
   } while (1);
-  $3_1 = $2_1;
+  $1_1 = $0;
   loop_in46 : do {
    dummy();
-   $6_1 = 4;
+   $2_1 = 4;
    break loop_in46;
   } while (1);
-  return Math_imul($3_1, $6_1) | 0;
+  return Math_imul($1_1, $2_1) | 0;
  }
  
  function $8() {
-  var $2_1 = 0;
+  var $0 = 0;
   loop_in : do {
    dummy();
-   $2_1 = 13;
+   $0 = 13;
    break loop_in;
   } while (1);
-  return ($2_1 | 0) == (0 | 0) | 0;
+  return ($0 | 0) == (0 | 0) | 0;
  }
  
  function $9() {
-  var $2_1 = Math_fround(0), $3_1 = Math_fround(0), $6_1 = Math_fround(0);
+  var $0 = Math_fround(0), $1_1 = Math_fround(0), $2_1 = Math_fround(0);
   loop_in : do {
    dummy();
-   $2_1 = Math_fround(3.0);
+   $0 = Math_fround(3.0);
    break loop_in;
   } while (1);
-  $3_1 = $2_1;
+  $1_1 = $0;
   loop_in47 : do {
    dummy();
-   $6_1 = Math_fround(3.0);
+   $2_1 = Math_fround(3.0);
    break loop_in47;
   } while (1);
-  return $3_1 > $6_1 | 0;
+  return $1_1 > $2_1 | 0;
  }
  
  function $10() {
@@ -259,7 +259,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $11() {
-  var $0 = 0, $1_1 = 0, $3_1 = 0;
+  var $0 = 0, $1_1 = 0;
   block : {
    loop_in : do {
     $0 = 18;
@@ -271,7 +271,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $12() {
-  var $0 = 0, $5_1 = 0, $7_1 = 0;
+  var $0 = 0, $1_1 = 0;
   block : {
    loop_in : do {
     $0 = 18;
@@ -283,7 +283,7 @@ function asmFunc(global, env, buffer) {
  }
  
  function $13() {
-  var $0 = 0, $1_1 = 0, $2_1 = 0, $5_1 = 0, $6_1 = 0, $9_1 = 0, $10_1 = 0, $12_1 = 0, $17_1 = 0, $18_1 = 0, $21 = 0, $22 = 0;
+  var $0 = 0, $1_1 = 0, $2_1 = 0, $3_1 = 0, $4_1 = 0, $5_1 = 0, $6_1 = 0, $7_1 = 0, $8_1 = 0, $9_1 = 0, $10_1 = 0, $11_1 = 0;
   $0 = 0;
   $1_1 = $0;
   block : {
@@ -296,57 +296,57 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   $0 = $1_1 + $2_1 | 0;
-  $5_1 = $0;
+  $3_1 = $0;
   block55 : {
    loop_in56 : do {
     loop_in57 : do {
-     $6_1 = 2;
+     $4_1 = 2;
      break block55;
      break loop_in57;
     } while (1);
     break loop_in56;
    } while (1);
   };
-  $0 = $5_1 + $6_1 | 0;
-  $9_1 = $0;
+  $0 = $3_1 + $4_1 | 0;
+  $5_1 = $0;
   loop_in59 : do {
    block60 : {
     loop_in61 : do {
-     $10_1 = 4;
+     $6_1 = 4;
      break block60;
      break loop_in61;
     } while (1);
    };
-   $12_1 = $10_1;
+   $7_1 = $6_1;
    break loop_in59;
   } while (1);
-  $0 = $9_1 + $12_1 | 0;
-  $17_1 = $0;
+  $0 = $5_1 + $7_1 | 0;
+  $8_1 = $0;
   block62 : {
    loop_in63 : do {
-    $18_1 = 8;
+    $9_1 = 8;
     break block62;
     break loop_in63;
    } while (1);
   };
-  $0 = $17_1 + $18_1 | 0;
-  $21 = $0;
+  $0 = $8_1 + $9_1 | 0;
+  $10_1 = $0;
   block64 : {
    loop_in65 : do {
     loop_in66 : do {
-     $22 = 16;
+     $11_1 = 16;
      break block64;
      break loop_in66;
     } while (1);
     break loop_in65;
    } while (1);
   };
-  $0 = $21 + $22 | 0;
+  $0 = $10_1 + $11_1 | 0;
   return $0 | 0;
  }
  
  function $14() {
-  var $0 = 0, $1_1 = 0, $6_1 = 0, $2_1 = 0, $7_1 = 0, $3_1 = 0, $8_1 = 0, $5_1 = 0, wasm2js_i32$0 = 0;
+  var $0 = 0, $1_1 = 0, $2_1 = 0, $3_1 = 0, wasm2js_i32$0 = 0;
   $0 = 0;
   $1_1 = $0;
   loop_in : do {
@@ -377,49 +377,41 @@ function asmFunc(global, env, buffer) {
  function $16($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, $1$hi = 0, $1_1 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = 0;
   $1_1 = 1;
   $1$hi = i64toi32_i32$0;
   block : {
    loop_in : do {
     i64toi32_i32$0 = $0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
     if (($0 | i64toi32_i32$0 | 0 | 0) == (0 | 0)) break block;
     i64toi32_i32$0 = $0$hi;
-    i64toi32_i32$0 = $1$hi;
-    i64toi32_i32$0 = $0$hi;
     i64toi32_i32$1 = $1$hi;
-    i64toi32_i32$1 = __wasm_i64_mul($0 | 0, i64toi32_i32$0 | 0, $1_1 | 0, $1$hi | 0) | 0;
+    i64toi32_i32$1 = __wasm_i64_mul($0 | 0, i64toi32_i32$0 | 0, $1_1 | 0, i64toi32_i32$1 | 0) | 0;
     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-    i64toi32_i32$0 = i64toi32_i32$0;
     $1_1 = i64toi32_i32$1;
     $1$hi = i64toi32_i32$0;
-    i64toi32_i32$0 = $0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = $0$hi;
+    i64toi32_i32$0 = $0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$5 = ($0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    $0 = $0 - i64toi32_i32$3 | 0;
+    i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + 0 | 0;
+    i64toi32_i32$5 = $0$hi - i64toi32_i32$5 | 0;
+    $0 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
     $0$hi = i64toi32_i32$5;
     continue loop_in;
     break loop_in;
    } while (1);
   };
   i64toi32_i32$5 = $1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$0 = $1_1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return $1_1 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $17($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, $2$hi = 0, $2_1 = 0, i64toi32_i32$1 = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$4 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, $2_1 = 0, $2$hi = 0, $1_1 = 0, $1$hi = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0;
   i64toi32_i32$0 = 0;
   $1_1 = 1;
   $1$hi = i64toi32_i32$0;
@@ -428,29 +420,24 @@ function asmFunc(global, env, buffer) {
   $2$hi = i64toi32_i32$0;
   block : {
    loop_in : do {
-    i64toi32_i32$0 = $2$hi;
-    i64toi32_i32$0 = $0$hi;
-    i64toi32_i32$0 = $2$hi;
-    i64toi32_i32$2 = $2_1;
-    i64toi32_i32$1 = $0$hi;
-    if (i64toi32_i32$0 >>> 0 > i64toi32_i32$1 >>> 0 | ((i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) & i64toi32_i32$2 >>> 0 > $0 >>> 0 | 0) | 0) break block;
-    i64toi32_i32$2 = $1$hi;
-    i64toi32_i32$2 = $2$hi;
-    i64toi32_i32$2 = $1$hi;
-    i64toi32_i32$0 = $2$hi;
-    i64toi32_i32$0 = __wasm_i64_mul($1_1 | 0, i64toi32_i32$2 | 0, $2_1 | 0, i64toi32_i32$0 | 0) | 0;
-    i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    $1_1 = i64toi32_i32$0;
-    $1$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = $2$hi;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    i64toi32_i32$0 = 0;
-    i64toi32_i32$1 = 1;
-    i64toi32_i32$4 = $2_1 + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
+    i64toi32_i32$1 = $2$hi;
+    i64toi32_i32$0 = $2_1;
+    i64toi32_i32$2 = $0$hi;
+    i64toi32_i32$3 = $0;
+    if (i64toi32_i32$1 >>> 0 > i64toi32_i32$2 >>> 0 | ((i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) & i64toi32_i32$0 >>> 0 > i64toi32_i32$3 >>> 0 | 0) | 0) break block;
+    i64toi32_i32$0 = $1$hi;
+    i64toi32_i32$1 = $2$hi;
+    i64toi32_i32$1 = __wasm_i64_mul($1_1 | 0, i64toi32_i32$0 | 0, $2_1 | 0, i64toi32_i32$1 | 0) | 0;
+    i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+    $1_1 = i64toi32_i32$1;
+    $1$hi = i64toi32_i32$0;
+    i64toi32_i32$1 = $2$hi;
+    i64toi32_i32$0 = $2_1;
+    i64toi32_i32$3 = 0;
+    i64toi32_i32$2 = 1;
+    i64toi32_i32$4 = i64toi32_i32$0 + i64toi32_i32$2 | 0;
+    i64toi32_i32$5 = i64toi32_i32$1 + i64toi32_i32$3 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$2 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
     $2_1 = i64toi32_i32$4;
     $2$hi = i64toi32_i32$5;
     continue loop_in;
@@ -458,11 +445,9 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = $1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
+  i64toi32_i32$0 = $1_1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return $1_1 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $18($0, $1_1) {
@@ -497,78 +482,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17_1 = 0, $18_1 = 0, $23 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16_1 = 0, $17_1 = 0, var$6 = 0, $18_1 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $23 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17_1 = Math_imul(var$4, var$5);
-  $18_1 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19 = Math_imul(var$4, var$5);
+  $20 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16_1 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23 = $17_1 + Math_imul($18_1, $21) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21 = $19 + Math_imul($20, $16_1) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17_1 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17_1 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $22 = $21 + Math_imul($17_1, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45 = $29 + (var$2 >>> 16 | 0) | 0;
+  $23 = $22 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
+  i64toi32_i32$4 = $23 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18_1 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18_1 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18_1;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_ctz_i32(var$0) {
@@ -582,14 +557,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
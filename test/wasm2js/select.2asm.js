@@ -35,14 +35,14 @@ function asmFunc(global, env, buffer) {
   rhs = rhs | 0;
   rhs$hi = rhs$hi | 0;
   cond = cond | 0;
-  var i64toi32_i32$0 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
-  i64toi32_i32$0 = lhs$hi;
-  i64toi32_i32$0 = rhs$hi;
-  i64toi32_i32$0 = lhs$hi;
-  i64toi32_i32$0 = rhs$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return (wasm2js_i32$0 = lhs, wasm2js_i32$1 = rhs, wasm2js_i32$2 = cond, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1) | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0;
+  i64toi32_i32$2 = lhs$hi;
+  i64toi32_i32$3 = rhs$hi;
+  i64toi32_i32$4 = cond;
+  i64toi32_i32$2 = (wasm2js_i32$0 = i64toi32_i32$2, wasm2js_i32$1 = i64toi32_i32$3, wasm2js_i32$2 = i64toi32_i32$4, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$3 = (wasm2js_i32$0 = lhs, wasm2js_i32$1 = rhs, wasm2js_i32$2 = i64toi32_i32$4, wasm2js_i32$2 ? wasm2js_i32$0 : wasm2js_i32$1);
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+  return i64toi32_i32$3 | 0;
  }
  
  function $2(lhs, rhs, cond) {
@@ -63,13 +63,13 @@ function asmFunc(global, env, buffer) {
  
  function $4(cond) {
   cond = cond | 0;
-  var $1_1 = 0, $2_1 = 0;
+  var $1_1 = 0;
   return abort() | 0;
  }
  
  function $5(cond) {
   cond = cond | 0;
-  var $1_1 = 0, $2_1 = 0;
+  var $1_1 = 0;
   return abort() | 0;
  }
  
@@ -74,29 +74,23 @@ function asmFunc(global, env, buffer) {
   $2_1 = +$2_1;
   $3_1 = $3_1 | 0;
   $4_1 = $4_1 | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0.0, $14 = 0, $15 = 0, $6$hi = 0, $10 = 0.0, $21 = 0.0, $7$hi = 0, $7_1 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$3 = 0.0, $12 = 0, $13 = 0, $6$hi = 0, $14 = 0.0, $15 = 0.0, $7$hi = 0, $7_1 = 0;
   i64toi32_i32$0 = 0;
   $6$hi = i64toi32_i32$0;
   i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = $0_1;
-  $10 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
+  $14 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
   i64toi32_i32$0 = $6$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = 6;
-  $21 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
+  $15 = +(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0);
   i64toi32_i32$0 = $7$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = $7_1;
-  i64toi32_i32$3 = $10 + (+Math_fround(-.30000001192092896) + ($2_1 + (+(40 >>> 0) + (+(4294967289 | 0) + (+Math_fround(5.5) + ($21 + (+(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0) + 8.0)))))));
+  i64toi32_i32$3 = $14 + (+Math_fround(-.30000001192092896) + ($2_1 + (+(40 >>> 0) + (+(4294967289 | 0) + (+Math_fround(5.5) + ($15 + (+(i64toi32_i32$1 >>> 0) + 4294967296.0 * +(i64toi32_i32$0 >>> 0) + 8.0)))))));
   if (Math_abs(i64toi32_i32$3) >= 1.0) {
-   if (i64toi32_i32$3 > 0.0) $14 = ~~Math_min(Math_floor(i64toi32_i32$3 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $14 = ~~Math_ceil((i64toi32_i32$3 - +(~~i64toi32_i32$3 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
-   $15 = $14;
-  } else $15 = 0;
-  i64toi32_i32$0 = $15;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+   if (i64toi32_i32$3 > 0.0) $12 = ~~Math_min(Math_floor(i64toi32_i32$3 / 4294967296.0), 4294967296.0 - 1.0) >>> 0; else $12 = ~~Math_ceil((i64toi32_i32$3 - +(~~i64toi32_i32$3 >>> 0 >>> 0)) / 4294967296.0) >>> 0;
+   $13 = $12;
+  } else $13 = 0;
+  i64toi32_i32$0 = $13;
   i64toi32_i32$1 = ~~i64toi32_i32$3 >>> 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -24,9 +24,8 @@ function asmFunc(global, env, buffer) {
  function $0(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, var$1 = 0, var$1$hi = 0, i64toi32_i32$2 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -34,30 +33,24 @@ function asmFunc(global, env, buffer) {
   var$2$hi = i64toi32_i32$0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = var$1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break label$1; else label$5 : {
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = var$2$hi;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$0 = var$2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$2 | 0, var$2 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     var$2 = i64toi32_i32$0;
-     var$2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = var$1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break label$1; else label$5 : {
+     i64toi32_i32$0 = var$1$hi;
+     i64toi32_i32$1 = var$2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$0 | 0, var$2 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     var$2 = i64toi32_i32$1;
+     var$2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = var$1$hi;
+     i64toi32_i32$0 = var$1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     var$1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      var$1$hi = i64toi32_i32$5;
     };
     continue label$2;
@@ -65,20 +58,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = var$2;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $1(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, var$1 = 0, var$1$hi = 0, i64toi32_i32$2 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -86,30 +75,24 @@ function asmFunc(global, env, buffer) {
   var$2$hi = i64toi32_i32$0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = var$1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break label$1; else block : {
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = var$2$hi;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$0 = var$2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$2 | 0, var$2 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     var$2 = i64toi32_i32$0;
-     var$2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = var$1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break label$1; else block : {
+     i64toi32_i32$0 = var$1$hi;
+     i64toi32_i32$1 = var$2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$0 | 0, var$2 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     var$2 = i64toi32_i32$1;
+     var$2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = var$1$hi;
+     i64toi32_i32$0 = var$1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     var$1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      var$1$hi = i64toi32_i32$5;
     };
     continue label$2;
@@ -117,20 +100,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = var$2;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $2(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, var$1 = 0, var$1$hi = 0, i64toi32_i32$2 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -138,30 +117,24 @@ function asmFunc(global, env, buffer) {
   var$2$hi = i64toi32_i32$0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = var$1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break label$1; else block : {
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = var$2$hi;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$0 = var$2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$2 | 0, var$2 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     var$2 = i64toi32_i32$0;
-     var$2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = var$1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break label$1; else block : {
+     i64toi32_i32$0 = var$1$hi;
+     i64toi32_i32$1 = var$2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$0 | 0, var$2 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     var$2 = i64toi32_i32$1;
+     var$2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = var$1$hi;
+     i64toi32_i32$0 = var$1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     var$1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      var$1$hi = i64toi32_i32$5;
     };
     continue label$2;
@@ -169,20 +142,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = var$2;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $3(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, var$1 = 0, var$1$hi = 0, i64toi32_i32$2 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -190,30 +159,24 @@ function asmFunc(global, env, buffer) {
   var$2$hi = i64toi32_i32$0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = var$1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break label$1; else block : {
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = var$2$hi;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$0 = var$2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$2 | 0, var$2 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     var$2 = i64toi32_i32$0;
-     var$2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = var$1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break label$1; else block : {
+     i64toi32_i32$0 = var$1$hi;
+     i64toi32_i32$1 = var$2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$0 | 0, var$2 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     var$2 = i64toi32_i32$1;
+     var$2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = var$1$hi;
+     i64toi32_i32$0 = var$1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     var$1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      var$1$hi = i64toi32_i32$5;
     };
     continue label$2;
@@ -221,20 +184,16 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = var$2;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function $4(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, var$1$hi = 0, var$1 = 0, var$2$hi = 0, i64toi32_i32$1 = 0, var$2 = 0;
+  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$5 = 0, var$1 = 0, var$1$hi = 0, i64toi32_i32$2 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$3 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   var$1 = var$0;
   var$1$hi = i64toi32_i32$0;
   i64toi32_i32$0 = 0;
@@ -242,30 +201,24 @@ function asmFunc(global, env, buffer) {
   var$2$hi = i64toi32_i32$0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$2 = var$1;
-    i64toi32_i32$1 = 0;
+    i64toi32_i32$1 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$2 = 0;
     i64toi32_i32$3 = 0;
-    if ((i64toi32_i32$2 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0) break label$1; else block : {
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = var$2$hi;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$0 = var$2$hi;
-     i64toi32_i32$0 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$2 | 0, var$2 | 0, i64toi32_i32$0 | 0) | 0;
-     i64toi32_i32$2 = i64toi32_i32$HIGH_BITS;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     var$2 = i64toi32_i32$0;
-     var$2$hi = i64toi32_i32$2;
-     i64toi32_i32$2 = var$1$hi;
-     i64toi32_i32$2 = i64toi32_i32$2;
-     i64toi32_i32$3 = var$1;
-     i64toi32_i32$0 = 0;
-     i64toi32_i32$1 = 1;
-     i64toi32_i32$5 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$1 >>> 0) + i64toi32_i32$0 | 0;
-     i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-     i64toi32_i32$5 = i64toi32_i32$5;
-     var$1 = i64toi32_i32$3 - i64toi32_i32$1 | 0;
+    if ((i64toi32_i32$0 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0) break label$1; else block : {
+     i64toi32_i32$0 = var$1$hi;
+     i64toi32_i32$1 = var$2$hi;
+     i64toi32_i32$1 = __wasm_i64_mul(var$1 | 0, i64toi32_i32$0 | 0, var$2 | 0, i64toi32_i32$1 | 0) | 0;
+     i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
+     var$2 = i64toi32_i32$1;
+     var$2$hi = i64toi32_i32$0;
+     i64toi32_i32$1 = var$1$hi;
+     i64toi32_i32$0 = var$1;
+     i64toi32_i32$3 = 0;
+     i64toi32_i32$2 = 1;
+     i64toi32_i32$5 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$2 >>> 0) + i64toi32_i32$3 | 0;
+     i64toi32_i32$5 = i64toi32_i32$1 - i64toi32_i32$5 | 0;
+     var$1 = i64toi32_i32$0 - i64toi32_i32$2 | 0;
      var$1$hi = i64toi32_i32$5;
     };
     continue label$2;
@@ -273,12 +226,9 @@ function asmFunc(global, env, buffer) {
    } while (1);
   };
   i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$3 = var$2;
+  i64toi32_i32$0 = var$2;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$3 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0, var$0$hi, var$1, var$1$hi) {
@@ -286,78 +236,68 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, var$2 = 0, i64toi32_i32$3 = 0, var$3 = 0, var$4 = 0, var$5 = 0, $21 = 0, $22 = 0, var$6 = 0, $24 = 0, $17 = 0, $18 = 0, $23 = 0, $29 = 0, $45 = 0, $56$hi = 0, $62$hi = 0;
-  i64toi32_i32$0 = var$1$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  var var$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, var$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$4 = 0, var$5 = 0, $16 = 0, $17 = 0, var$6 = 0, $18 = 0, $19 = 0, $20 = 0, $21 = 0, $22 = 0, $23 = 0;
+  i64toi32_i32$2 = var$1$hi;
   var$2 = var$1;
   var$4 = var$2 >>> 16 | 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  i64toi32_i32$2 = var$0$hi;
   var$3 = var$0;
   var$5 = var$3 >>> 16 | 0;
-  $17 = Math_imul(var$4, var$5);
-  $18 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
+  $19 = Math_imul(var$4, var$5);
+  $20 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2;
   i64toi32_i32$2 = var$3;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = 0;
-   $21 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = 0;
+   $16 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$4 = i64toi32_i32$3 >>> i64toi32_i32$6 | 0;
+   $16 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  $23 = $17 + Math_imul($18, $21) | 0;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$0 = var$1;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = 0;
-   $22 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+  $21 = $19 + Math_imul($20, $16) | 0;
+  i64toi32_i32$2 = var$1$hi;
+  i64toi32_i32$4 = var$1;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$5 = 32;
+  i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+   i64toi32_i32$3 = 0;
+   $17 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-   $22 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$6 | 0;
+   $17 = (((1 << i64toi32_i32$6 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$6 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$6 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  $29 = $23 + Math_imul($22, var$3) | 0;
+  $22 = $21 + Math_imul($17, var$3) | 0;
   var$2 = var$2 & 65535 | 0;
   var$3 = var$3 & 65535 | 0;
   var$6 = Math_imul(var$2, var$3);
   var$2 = (var$6 >>> 16 | 0) + Math_imul(var$2, var$5) | 0;
-  $45 = $29 + (var$2 >>> 16 | 0) | 0;
+  $23 = $22 + (var$2 >>> 16 | 0) | 0;
   var$2 = (var$2 & 65535 | 0) + Math_imul(var$4, var$3) | 0;
-  i64toi32_i32$2 = 0;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$1 = $45 + (var$2 >>> 16 | 0) | 0;
-  i64toi32_i32$0 = 0;
-  i64toi32_i32$3 = 32;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$0 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
-   $24 = 0;
+  i64toi32_i32$4 = $23 + (var$2 >>> 16 | 0) | 0;
+  i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = i64toi32_i32$4;
+  i64toi32_i32$4 = 0;
+  i64toi32_i32$2 = 32;
+  i64toi32_i32$5 = i64toi32_i32$2 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+   i64toi32_i32$4 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
+   $18 = 0;
   } else {
-   i64toi32_i32$0 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$4 | 0) | 0;
-   $24 = i64toi32_i32$1 << i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = ((1 << i64toi32_i32$5 | 0) - 1 | 0) & (i64toi32_i32$1 >>> (32 - i64toi32_i32$5 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$5 | 0) | 0;
+   $18 = i64toi32_i32$1 << i64toi32_i32$5 | 0;
   }
-  $56$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = 0;
-  $62$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = $56$hi;
-  i64toi32_i32$2 = $24;
-  i64toi32_i32$1 = $62$hi;
+  i64toi32_i32$0 = $18;
   i64toi32_i32$3 = var$2 << 16 | 0 | (var$6 & 65535 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$0 | i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$2 = i64toi32_i32$2 | i64toi32_i32$3 | 0;
+  i64toi32_i32$1 = 0;
+  i64toi32_i32$3 = i64toi32_i32$3;
+  i64toi32_i32$1 = i64toi32_i32$4 | i64toi32_i32$1 | 0;
+  i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$3 | 0;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$0 | 0;
  }
  
  function __wasm_i64_mul(var$0, var$0$hi, var$1, var$1$hi) {
@@ -365,14 +305,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int3mul3Mul3mul17h070e9a1c69faec5bE(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
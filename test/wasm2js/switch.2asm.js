@@ -79,9 +79,10 @@ function asmFunc(global, env, buffer) {
  function $1(i, i$hi) {
   i = i | 0;
   i$hi = i$hi | 0;
-  var i64toi32_i32$5 = 0, i64toi32_i32$2 = 0, $7_1 = 0, $7$hi = 0, j = 0, j$hi = 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, $7_1 = 0, j = 0, j$hi = 0;
+  i64toi32_i32$0 = 0;
   j = 100;
-  j$hi = 0;
+  j$hi = i64toi32_i32$0;
   switch_ : {
    $7 : {
     default_ : {
@@ -92,6 +93,7 @@ function asmFunc(global, env, buffer) {
          $2_1 : {
           $1_1 : {
            $0_1 : {
+            i64toi32_i32$0 = i$hi;
             switch (i | 0) {
             case 0:
              break $0_1;
@@ -113,54 +115,54 @@ function asmFunc(global, env, buffer) {
              break default_;
             };
            };
-           i64toi32_i32$HIGH_BITS = i$hi;
-           return i | 0;
+           i64toi32_i32$0 = i$hi;
+           i64toi32_i32$1 = i;
+           i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
+           return i64toi32_i32$1 | 0;
           };
          };
         };
-        i64toi32_i32$2 = 0;
-        i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i >>> 0) + i$hi | 0;
-        i64toi32_i32$5 = 0 - i64toi32_i32$5 | 0;
-        i64toi32_i32$5 = i64toi32_i32$5;
-        $7_1 = i64toi32_i32$2 - i | 0;
-        $7$hi = i64toi32_i32$5;
+        i64toi32_i32$0 = 0;
+        i64toi32_i32$1 = 0;
+        i64toi32_i32$5 = (i64toi32_i32$1 >>> 0 < i >>> 0) + i$hi | 0;
+        i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+        $7_1 = i64toi32_i32$1 - i | 0;
         break switch_;
        };
-       i64toi32_i32$5 = 0;
+       i64toi32_i32$1 = 0;
        j = 101;
-       j$hi = i64toi32_i32$5;
+       j$hi = i64toi32_i32$1;
       };
      };
     };
-    i64toi32_i32$5 = j$hi;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    $7_1 = j;
-    $7$hi = i64toi32_i32$5;
+    i64toi32_i32$1 = j$hi;
+    i64toi32_i32$0 = j;
+    i64toi32_i32$5 = i64toi32_i32$1;
+    $7_1 = i64toi32_i32$0;
     break switch_;
    };
-   i64toi32_i32$5 = 4294967295;
-   $7_1 = 4294967291;
-   $7$hi = i64toi32_i32$5;
+   i64toi32_i32$1 = 4294967295;
+   i64toi32_i32$0 = 4294967291;
+   i64toi32_i32$5 = i64toi32_i32$1;
+   $7_1 = i64toi32_i32$0;
   };
-  i64toi32_i32$5 = $7$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = $7_1;
+  i64toi32_i32$1 = $7_1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-  return i64toi32_i32$2 | 0;
+  return i64toi32_i32$1 | 0;
  }
  
  function $2(i) {
   i = i | 0;
-  var $5_1 = 0, $6_1 = 0, $7_1 = 0, $8 = 0, $9 = 0;
+  var $1_2 = 0, $2_2 = 0, $3_2 = 0, $4_1 = 0, $5_1 = 0;
   $2_1 : {
    $1_1 : {
     $0_1 : {
      default_ : {
-      $5_1 = Math_imul(2, i);
-      $6_1 = $5_1;
-      $7_1 = $5_1;
-      $8 = $5_1;
-      $9 = $5_1;
+      $1_2 = Math_imul(2, i);
+      $2_2 = $1_2;
+      $3_2 = $1_2;
+      $4_1 = $1_2;
+      $5_1 = $1_2;
       switch (3 & i | 0 | 0) {
       case 0:
        break $0_1;
@@ -172,13 +174,13 @@ function asmFunc(global, env, buffer) {
        break default_;
       };
      };
-     $6_1 = 1e3 + $9 | 0;
+     $2_2 = 1e3 + $5_1 | 0;
     };
-    $7_1 = 100 + $6_1 | 0;
+    $3_2 = 100 + $2_2 | 0;
    };
-   $8 = 10 + $7_1 | 0;
+   $4_1 = 10 + $3_2 | 0;
   };
-  return $8 | 0;
+  return $4_1 | 0;
  }
  
  function $3() {
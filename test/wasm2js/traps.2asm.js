@@ -38,14 +38,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_sdiv(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -56,14 +53,11 @@ function asmFunc(global, env, buffer) {
   x$hi = x$hi | 0;
   y = y | 0;
   y$hi = y$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = x$hi;
-  i64toi32_i32$0 = y$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = x$hi;
   i64toi32_i32$1 = y$hi;
   i64toi32_i32$1 = __wasm_i64_udiv(x | 0, i64toi32_i32$0 | 0, y | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -74,124 +68,93 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$3 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$2$hi = 0, i64toi32_i32$6 = 0, $21 = 0, $22 = 0, $23 = 0, $7$hi = 0, $9 = 0, $9$hi = 0, $14$hi = 0, $16$hi = 0, $17 = 0, $17$hi = 0, $23$hi = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = var$0;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$0 >> 31 | 0;
-   $21 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
+  var i64toi32_i32$5 = 0, i64toi32_i32$8 = 0, i64toi32_i32$6 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$7 = 0, i64toi32_i32$9 = 0, var$2 = 0, i64toi32_i32$0 = 0, $15 = 0, $16 = 0, i64toi32_i32$1 = 0, $17 = 0, $18 = 0, $19 = 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$6 = 0;
+  i64toi32_i32$7 = 63;
+  i64toi32_i32$8 = i64toi32_i32$7 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$7 & 63 | 0) >>> 0) {
+   i64toi32_i32$6 = i64toi32_i32$5 >> 31 | 0;
+   $15 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$0 >> i64toi32_i32$4 | 0;
-   $21 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+   i64toi32_i32$6 = i64toi32_i32$5 >> i64toi32_i32$8 | 0;
+   $15 = (((1 << i64toi32_i32$8 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$8 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$8 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $21;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$0 = var$2;
-  i64toi32_i32$2 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $7$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $7$hi;
-  i64toi32_i32$1 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$0 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$5 = i64toi32_i32$6 + i64toi32_i32$0 | 0;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
-  $9 = i64toi32_i32$4;
-  $9$hi = i64toi32_i32$5;
-  i64toi32_i32$5 = var$1$hi;
-  i64toi32_i32$5 = i64toi32_i32$5;
-  i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$0 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$1 = i64toi32_i32$5 >> 31 | 0;
-   $22 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
+  var$2 = $15;
+  i64toi32_i32$4 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$4;
+  i64toi32_i32$4 = var$0$hi;
+  i64toi32_i32$5 = var$0;
+  i64toi32_i32$4 = i64toi32_i32$6 ^ i64toi32_i32$4 | 0;
+  i64toi32_i32$2 = i64toi32_i32$3 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$3 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$6 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 >>> 0 < i64toi32_i32$6 >>> 0;
+  i64toi32_i32$7 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+  i64toi32_i32$7 = i64toi32_i32$4 - i64toi32_i32$7 | 0;
+  $18 = i64toi32_i32$5;
+  $19 = i64toi32_i32$7;
+  i64toi32_i32$3 = var$1$hi;
+  i64toi32_i32$6 = var$1;
+  i64toi32_i32$5 = 0;
+  i64toi32_i32$8 = 63;
+  i64toi32_i32$9 = i64toi32_i32$8 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$8 & 63 | 0) >>> 0) {
+   i64toi32_i32$5 = i64toi32_i32$3 >> 31 | 0;
+   $16 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
   } else {
-   i64toi32_i32$1 = i64toi32_i32$5 >> i64toi32_i32$0 | 0;
-   $22 = (((1 << i64toi32_i32$0 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$0 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$0 | 0) | 0;
+   i64toi32_i32$5 = i64toi32_i32$3 >> i64toi32_i32$9 | 0;
+   $16 = (((1 << i64toi32_i32$9 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$9 | 0) | 0 | (i64toi32_i32$6 >>> i64toi32_i32$9 | 0) | 0;
   }
-  i64toi32_i32$1 = i64toi32_i32$1;
-  var$2 = $22;
-  var$2$hi = i64toi32_i32$1;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$1 = var$1$hi;
-  i64toi32_i32$1 = var$2$hi;
-  i64toi32_i32$5 = var$2;
-  i64toi32_i32$2 = var$1$hi;
+  var$2 = $16;
+  i64toi32_i32$6 = var$2;
+  i64toi32_i32$4 = i64toi32_i32$6;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$3 = var$1;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$2 | 0;
-  $14$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$1;
-  i64toi32_i32$2 = $14$hi;
-  i64toi32_i32$1 = i64toi32_i32$5 ^ i64toi32_i32$3 | 0;
-  i64toi32_i32$5 = var$2$hi;
-  i64toi32_i32$3 = var$2;
-  i64toi32_i32$0 = i64toi32_i32$1 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$5 | 0;
-  i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$4 | 0;
-  $16$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = $9$hi;
-  i64toi32_i32$1 = $16$hi;
-  i64toi32_i32$1 = __wasm_i64_udiv($9 | 0, i64toi32_i32$4 | 0, i64toi32_i32$0 | 0, i64toi32_i32$1 | 0) | 0;
-  i64toi32_i32$4 = i64toi32_i32$HIGH_BITS;
-  $17 = i64toi32_i32$1;
-  $17$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$1$hi;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = var$1$hi;
+  i64toi32_i32$6 = i64toi32_i32$5 ^ i64toi32_i32$6 | 0;
+  i64toi32_i32$2 = i64toi32_i32$4 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$4 = i64toi32_i32$5;
+  i64toi32_i32$5 = var$2;
+  i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$9 = i64toi32_i32$2 >>> 0 < i64toi32_i32$5 >>> 0;
+  i64toi32_i32$8 = i64toi32_i32$9 + i64toi32_i32$4 | 0;
+  i64toi32_i32$8 = i64toi32_i32$6 - i64toi32_i32$8 | 0;
+  i64toi32_i32$8 = __wasm_i64_udiv($18 | 0, $19 | 0, i64toi32_i32$3 | 0, i64toi32_i32$8 | 0) | 0;
+  i64toi32_i32$7 = i64toi32_i32$HIGH_BITS;
+  i64toi32_i32$1 = i64toi32_i32$8;
+  i64toi32_i32$6 = var$1$hi;
   i64toi32_i32$2 = var$1;
-  i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$1 = i64toi32_i32$4 ^ i64toi32_i32$1 | 0;
-  i64toi32_i32$1 = i64toi32_i32$1;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$4 = var$0;
+  i64toi32_i32$5 = i64toi32_i32$6 ^ i64toi32_i32$5 | 0;
+  i64toi32_i32$8 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
   i64toi32_i32$2 = 0;
-  i64toi32_i32$3 = 63;
-  i64toi32_i32$5 = i64toi32_i32$3 & 31 | 0;
-  if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-   i64toi32_i32$2 = i64toi32_i32$1 >> 31 | 0;
-   $23 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = 63;
+  i64toi32_i32$4 = i64toi32_i32$6 & 31 | 0;
+  if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
+   i64toi32_i32$2 = i64toi32_i32$5 >> 31 | 0;
+   $17 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
   } else {
-   i64toi32_i32$2 = i64toi32_i32$1 >> i64toi32_i32$5 | 0;
-   $23 = (((1 << i64toi32_i32$5 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$5 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$5 | 0) | 0;
+   i64toi32_i32$2 = i64toi32_i32$5 >> i64toi32_i32$4 | 0;
+   $17 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$8 >>> i64toi32_i32$4 | 0) | 0;
   }
-  i64toi32_i32$2 = i64toi32_i32$2;
-  var$0 = $23;
+  var$0 = $17;
+  i64toi32_i32$8 = var$0;
   var$0$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = i64toi32_i32$2;
-  i64toi32_i32$2 = $17$hi;
-  i64toi32_i32$1 = $17;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$3 = var$0;
-  i64toi32_i32$4 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
-  $23$hi = i64toi32_i32$4;
-  i64toi32_i32$4 = var$0$hi;
-  i64toi32_i32$4 = $23$hi;
-  i64toi32_i32$2 = i64toi32_i32$1 ^ i64toi32_i32$3 | 0;
+  i64toi32_i32$8 = i64toi32_i32$8;
+  i64toi32_i32$2 = i64toi32_i32$7 ^ i64toi32_i32$2 | 0;
+  i64toi32_i32$0 = i64toi32_i32$1 ^ i64toi32_i32$8 | 0;
   i64toi32_i32$1 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-  i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0;
-  i64toi32_i32$0 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-  i64toi32_i32$0 = i64toi32_i32$4 - i64toi32_i32$0 | 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$2 = i64toi32_i32$5;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
-  return i64toi32_i32$2 | 0;
+  i64toi32_i32$7 = i64toi32_i32$8;
+  i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+  i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$7 >>> 0;
+  i64toi32_i32$5 = i64toi32_i32$6 + var$0$hi | 0;
+  i64toi32_i32$5 = i64toi32_i32$2 - i64toi32_i32$5 | 0;
+  i64toi32_i32$0 = i64toi32_i32$8;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$8 | 0;
  }
  
  function _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0, var$0$hi, var$1, var$1$hi) {
@@ -199,7 +162,7 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, var$2 = 0, var$3 = 0, var$4 = 0, var$5 = 0, var$5$hi = 0, var$6 = 0, var$6$hi = 0, i64toi32_i32$6 = 0, $38 = 0, $39 = 0, $40 = 0, $41 = 0, $42 = 0, $43 = 0, $44 = 0, $45 = 0, var$8$hi = 0, $46 = 0, $47 = 0, $48 = 0, $49 = 0, var$7$hi = 0, $50 = 0, $63$hi = 0, $65 = 0, $65$hi = 0, $66 = 0, $120$hi = 0, $129$hi = 0, $134$hi = 0, var$8 = 0, $140 = 0, $140$hi = 0, $142$hi = 0, $144 = 0, $144$hi = 0, $151 = 0, $151$hi = 0, $154$hi = 0, var$7 = 0, $165$hi = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$2 = 0, i64toi32_i32$5 = 0, i64toi32_i32$4 = 0, i64toi32_i32$1 = 0, i64toi32_i32$0 = 0, var$2 = 0, var$3 = 0, i64toi32_i32$9 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, var$4 = 0, var$5 = 0, var$6 = 0, var$5$hi = 0, var$6$hi = 0, $24 = 0, $25 = 0, $26 = 0, $27 = 0, $28 = 0, $29 = 0, $30 = 0, $31 = 0, $32 = 0, $33 = 0, $34 = 0, $35 = 0, $36 = 0, $37 = 0, $38 = 0, var$8 = 0, var$8$hi = 0, var$7$hi = 0, var$7 = 0, wasm2js_i32$0 = 0, wasm2js_i32$1 = 0, wasm2js_i32$2 = 0, wasm2js_i32$3 = 0;
   label$1 : {
    label$2 : {
     label$3 : {
@@ -211,135 +174,117 @@ function asmFunc(global, env, buffer) {
           label$9 : {
            label$10 : {
             label$11 : {
-             i64toi32_i32$0 = var$0$hi;
-             i64toi32_i32$0 = i64toi32_i32$0;
-             i64toi32_i32$2 = var$0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$0$hi;
+             i64toi32_i32$0 = var$0;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$3 = 32;
              i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
              if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-              i64toi32_i32$1 = 0;
-              $38 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+              i64toi32_i32$2 = 0;
+              $24 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
              } else {
-              i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
-              $38 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+              i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+              $24 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
              }
-             i64toi32_i32$1 = i64toi32_i32$1;
-             var$2 = $38;
+             var$2 = $24;
              if (var$2) block : {
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
+              i64toi32_i32$2 = var$1$hi;
               var$3 = var$1;
               if ((var$3 | 0) == (0 | 0)) break label$11;
-              i64toi32_i32$1 = var$1$hi;
-              i64toi32_i32$1 = i64toi32_i32$1;
-              i64toi32_i32$0 = var$1;
-              i64toi32_i32$2 = 0;
+              i64toi32_i32$0 = var$1$hi;
+              i64toi32_i32$2 = var$1;
+              i64toi32_i32$1 = 0;
               i64toi32_i32$3 = 32;
               i64toi32_i32$4 = i64toi32_i32$3 & 31 | 0;
               if (32 >>> 0 <= (i64toi32_i32$3 & 63 | 0) >>> 0) {
-               i64toi32_i32$2 = 0;
-               $39 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
+               i64toi32_i32$1 = 0;
+               $25 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
               } else {
-               i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$4 | 0;
-               $39 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$0 >>> i64toi32_i32$4 | 0) | 0;
+               i64toi32_i32$1 = i64toi32_i32$0 >>> i64toi32_i32$4 | 0;
+               $25 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$0 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
               }
-              i64toi32_i32$2 = i64toi32_i32$2;
-              var$4 = $39;
+              var$4 = $25;
               if ((var$4 | 0) == (0 | 0)) break label$9;
               var$2 = Math_clz32(var$4) - Math_clz32(var$2) | 0;
               if (var$2 >>> 0 <= 31 >>> 0) break label$8;
               break label$2;
-             };
+             }
              i64toi32_i32$2 = var$1$hi;
-             i64toi32_i32$2 = i64toi32_i32$2;
              i64toi32_i32$1 = var$1;
              i64toi32_i32$0 = 1;
              i64toi32_i32$3 = 0;
              if (i64toi32_i32$2 >>> 0 > i64toi32_i32$0 >>> 0 | ((i64toi32_i32$2 | 0) == (i64toi32_i32$0 | 0) & i64toi32_i32$1 >>> 0 >= i64toi32_i32$3 >>> 0 | 0) | 0) break label$2;
-             i64toi32_i32$1 = var$0$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$1 = 1024;
+             i64toi32_i32$2 = var$0$hi;
              var$2 = var$0;
-             i64toi32_i32$1 = var$1$hi;
-             i64toi32_i32$1 = i64toi32_i32$1;
+             i64toi32_i32$2 = var$1$hi;
              var$3 = var$1;
              var$2 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-             i64toi32_i32$1 = 0;
-             i64toi32_i32$2 = 1024;
-             i64toi32_i32$1 = i64toi32_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$3 = var$0 - Math_imul(var$2, var$3) | 0;
+             i64toi32_i32$2 = 0;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$3;
              HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-             wasm2js_i32$0 = i64toi32_i32$2;
-             wasm2js_i32$1 = i64toi32_i32$1;
+             wasm2js_i32$0 = i64toi32_i32$1;
+             wasm2js_i32$1 = i64toi32_i32$2;
              (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-             i64toi32_i32$1 = 0;
+             i64toi32_i32$1 = var$2;
+             i64toi32_i32$2 = 0;
              i64toi32_i32$1 = i64toi32_i32$1;
-             i64toi32_i32$2 = var$2;
-             i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-             return i64toi32_i32$2 | 0;
+             i64toi32_i32$HIGH_BITS = i64toi32_i32$2;
+             return i64toi32_i32$1 | 0;
             };
             i64toi32_i32$2 = var$1$hi;
-            i64toi32_i32$2 = i64toi32_i32$2;
-            i64toi32_i32$3 = var$1;
-            i64toi32_i32$1 = 0;
+            i64toi32_i32$1 = var$1;
+            i64toi32_i32$3 = 0;
             i64toi32_i32$0 = 32;
             i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
             if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$1 = 0;
-             $40 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             i64toi32_i32$3 = 0;
+             $26 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
             } else {
-             i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-             $40 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+             i64toi32_i32$3 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+             $26 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$1 >>> i64toi32_i32$4 | 0) | 0;
             }
-            i64toi32_i32$1 = i64toi32_i32$1;
-            var$3 = $40;
-            i64toi32_i32$1 = var$0$hi;
-            i64toi32_i32$1 = i64toi32_i32$1;
+            var$3 = $26;
+            i64toi32_i32$3 = var$0$hi;
             if ((var$0 | 0) == (0 | 0)) break label$7;
             if ((var$3 | 0) == (0 | 0)) break label$6;
             var$4 = var$3 + 4294967295 | 0;
             if (var$4 & var$3 | 0) break label$6;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            i64toi32_i32$2 = var$4 & var$2 | 0;
-            i64toi32_i32$3 = 0;
-            i64toi32_i32$0 = 32;
-            i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-            if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-             i64toi32_i32$3 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-             $41 = 0;
+            i64toi32_i32$3 = 1024;
+            $37 = i64toi32_i32$3;
+            i64toi32_i32$4 = var$4 & var$2 | 0;
+            i64toi32_i32$0 = 0;
+            i64toi32_i32$2 = i64toi32_i32$4;
+            i64toi32_i32$4 = 0;
+            i64toi32_i32$5 = 32;
+            i64toi32_i32$6 = i64toi32_i32$5 & 31 | 0;
+            if (32 >>> 0 <= (i64toi32_i32$5 & 63 | 0) >>> 0) {
+             i64toi32_i32$4 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
+             $27 = 0;
             } else {
-             i64toi32_i32$3 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-             $41 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+             i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$0 << i64toi32_i32$6 | 0) | 0;
+             $27 = i64toi32_i32$2 << i64toi32_i32$6 | 0;
             }
-            $63$hi = i64toi32_i32$3;
-            i64toi32_i32$3 = var$0$hi;
-            i64toi32_i32$3 = i64toi32_i32$3;
-            i64toi32_i32$1 = var$0;
-            i64toi32_i32$2 = 0;
-            i64toi32_i32$0 = 4294967295;
-            i64toi32_i32$2 = i64toi32_i32$3 & i64toi32_i32$2 | 0;
-            $65 = i64toi32_i32$1 & i64toi32_i32$0 | 0;
-            $65$hi = i64toi32_i32$2;
-            i64toi32_i32$2 = $63$hi;
-            i64toi32_i32$3 = $41;
-            i64toi32_i32$1 = $65$hi;
-            i64toi32_i32$0 = $65;
-            i64toi32_i32$1 = i64toi32_i32$2 | i64toi32_i32$1 | 0;
-            $66 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-            i64toi32_i32$3 = 1024;
-            i64toi32_i32$1 = i64toi32_i32$1;
-            wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = $66;
+            i64toi32_i32$1 = $27;
+            i64toi32_i32$0 = var$0$hi;
+            i64toi32_i32$2 = var$0;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$6 = 4294967295;
+            i64toi32_i32$5 = i64toi32_i32$0 & i64toi32_i32$5 | 0;
+            i64toi32_i32$2 = i64toi32_i32$2 & i64toi32_i32$6 | 0;
+            i64toi32_i32$5 = i64toi32_i32$4 | i64toi32_i32$5 | 0;
+            wasm2js_i32$0 = $37;
+            wasm2js_i32$1 = i64toi32_i32$1 | i64toi32_i32$2 | 0;
             HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
             wasm2js_i32$0 = i64toi32_i32$3;
-            wasm2js_i32$1 = i64toi32_i32$1;
+            wasm2js_i32$1 = i64toi32_i32$5;
             (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-            i64toi32_i32$1 = 0;
-            i64toi32_i32$1 = i64toi32_i32$1;
             i64toi32_i32$3 = var$2 >>> ((__wasm_ctz_i32(var$3 | 0) | 0) & 31 | 0) | 0;
-            i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+            i64toi32_i32$5 = 0;
+            i64toi32_i32$3 = i64toi32_i32$3;
+            i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
             return i64toi32_i32$3 | 0;
            };
           };
@@ -353,305 +298,258 @@ function asmFunc(global, env, buffer) {
          var$2 = var$2 + 1 | 0;
          break label$3;
         };
+        i64toi32_i32$3 = 1024;
+        $38 = i64toi32_i32$3;
         var$4 = (var$2 >>> 0) / (var$3 >>> 0) | 0;
-        i64toi32_i32$3 = 0;
-        i64toi32_i32$3 = i64toi32_i32$3;
-        i64toi32_i32$2 = var$2 - Math_imul(var$4, var$3) | 0;
+        i64toi32_i32$4 = var$2 - Math_imul(var$4, var$3) | 0;
         i64toi32_i32$1 = 0;
-        i64toi32_i32$0 = 32;
-        i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-        if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-         i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
-         $42 = 0;
+        i64toi32_i32$5 = i64toi32_i32$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$2 = 32;
+        i64toi32_i32$0 = i64toi32_i32$2 & 31 | 0;
+        if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+         i64toi32_i32$4 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
+         $28 = 0;
         } else {
-         i64toi32_i32$1 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-         $42 = i64toi32_i32$2 << i64toi32_i32$4 | 0;
+         i64toi32_i32$4 = ((1 << i64toi32_i32$0 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$0 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$0 | 0) | 0;
+         $28 = i64toi32_i32$5 << i64toi32_i32$0 | 0;
         }
-        i64toi32_i32$2 = 1024;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = $42;
+        wasm2js_i32$0 = $38;
+        wasm2js_i32$1 = $28;
         HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-        wasm2js_i32$0 = i64toi32_i32$2;
-        wasm2js_i32$1 = i64toi32_i32$1;
+        wasm2js_i32$0 = i64toi32_i32$3;
+        wasm2js_i32$1 = i64toi32_i32$4;
         (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-        i64toi32_i32$1 = 0;
-        i64toi32_i32$1 = i64toi32_i32$1;
-        i64toi32_i32$2 = var$4;
-        i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-        return i64toi32_i32$2 | 0;
+        i64toi32_i32$3 = var$4;
+        i64toi32_i32$4 = 0;
+        i64toi32_i32$3 = i64toi32_i32$3;
+        i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
+        return i64toi32_i32$3 | 0;
        };
        var$2 = Math_clz32(var$3) - Math_clz32(var$2) | 0;
        if (var$2 >>> 0 < 31 >>> 0) break label$4;
        break label$2;
       };
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$2 = 0;
-      i64toi32_i32$1 = 1024;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = var$4 & var$0 | 0;
+      i64toi32_i32$3 = 1024;
+      i64toi32_i32$4 = var$0$hi;
+      i64toi32_i32$5 = var$4 & var$0 | 0;
+      i64toi32_i32$4 = 0;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$5;
       HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-      wasm2js_i32$0 = i64toi32_i32$1;
-      wasm2js_i32$1 = i64toi32_i32$2;
+      wasm2js_i32$0 = i64toi32_i32$3;
+      wasm2js_i32$1 = i64toi32_i32$4;
       (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
       if ((var$3 | 0) == (1 | 0)) break label$1;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$2 = 0;
-      $120$hi = i64toi32_i32$2;
-      i64toi32_i32$2 = var$0$hi;
-      i64toi32_i32$3 = var$0;
-      i64toi32_i32$1 = $120$hi;
-      i64toi32_i32$0 = __wasm_ctz_i32(var$3 | 0) | 0;
-      i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-      if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-       i64toi32_i32$1 = 0;
-       $43 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
+      i64toi32_i32$3 = var$0$hi;
+      i64toi32_i32$4 = var$0;
+      i64toi32_i32$1 = __wasm_ctz_i32(var$3 | 0) | 0;
+      i64toi32_i32$5 = 0;
+      i64toi32_i32$1 = i64toi32_i32$1;
+      i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+      if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+       i64toi32_i32$5 = 0;
+       $29 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
       } else {
-       i64toi32_i32$1 = i64toi32_i32$2 >>> i64toi32_i32$4 | 0;
-       $43 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$2 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$4 | 0) | 0;
+       i64toi32_i32$5 = i64toi32_i32$3 >>> i64toi32_i32$2 | 0;
+       $29 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
       }
-      i64toi32_i32$1 = i64toi32_i32$1;
-      i64toi32_i32$3 = $43;
-      i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
-      return i64toi32_i32$3 | 0;
+      i64toi32_i32$4 = $29;
+      i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+      return i64toi32_i32$4 | 0;
      };
      var$3 = 63 - var$2 | 0;
      var$2 = var$2 + 1 | 0;
     };
-    i64toi32_i32$3 = var$0$hi;
+    i64toi32_i32$5 = var$0$hi;
+    i64toi32_i32$4 = var$0;
+    i64toi32_i32$1 = var$2 & 63 | 0;
     i64toi32_i32$3 = 0;
-    $129$hi = i64toi32_i32$3;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = $129$hi;
-    i64toi32_i32$0 = var$2 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$1 = 0;
-     $44 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$3 = 0;
+     $30 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
     } else {
-     i64toi32_i32$1 = i64toi32_i32$3 >>> i64toi32_i32$4 | 0;
-     $44 = (((1 << i64toi32_i32$4 | 0) - 1 | 0) & i64toi32_i32$3 | 0) << (32 - i64toi32_i32$4 | 0) | 0 | (i64toi32_i32$2 >>> i64toi32_i32$4 | 0) | 0;
+     i64toi32_i32$3 = i64toi32_i32$5 >>> i64toi32_i32$2 | 0;
+     $30 = (((1 << i64toi32_i32$2 | 0) - 1 | 0) & i64toi32_i32$5 | 0) << (32 - i64toi32_i32$2 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$2 | 0) | 0;
     }
-    i64toi32_i32$1 = i64toi32_i32$1;
-    var$5 = $44;
-    var$5$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
-    i64toi32_i32$1 = 0;
-    $134$hi = i64toi32_i32$1;
-    i64toi32_i32$1 = var$0$hi;
+    var$5 = $30;
+    var$5$hi = i64toi32_i32$3;
+    i64toi32_i32$4 = var$0$hi;
     i64toi32_i32$3 = var$0;
-    i64toi32_i32$2 = $134$hi;
-    i64toi32_i32$0 = var$3 & 63 | 0;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
-     $45 = 0;
+    i64toi32_i32$1 = var$3 & 63 | 0;
+    i64toi32_i32$5 = 0;
+    i64toi32_i32$1 = i64toi32_i32$1;
+    i64toi32_i32$2 = i64toi32_i32$1 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+     i64toi32_i32$5 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
+     $31 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$4 | 0) | 0;
-     $45 = i64toi32_i32$3 << i64toi32_i32$4 | 0;
+     i64toi32_i32$5 = ((1 << i64toi32_i32$2 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$2 | 0) | 0) | 0 | (i64toi32_i32$4 << i64toi32_i32$2 | 0) | 0;
+     $31 = i64toi32_i32$3 << i64toi32_i32$2 | 0;
     }
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = $45;
-    var$0$hi = i64toi32_i32$2;
+    var$0 = $31;
+    var$0$hi = i64toi32_i32$5;
     label$13 : {
      if (var$2) block3 : {
-      i64toi32_i32$2 = var$1$hi;
-      i64toi32_i32$2 = i64toi32_i32$2;
-      i64toi32_i32$1 = var$1;
-      i64toi32_i32$3 = 4294967295;
-      i64toi32_i32$0 = 4294967295;
-      i64toi32_i32$4 = i64toi32_i32$1 + i64toi32_i32$0 | 0;
-      i64toi32_i32$5 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-      if (i64toi32_i32$4 >>> 0 < i64toi32_i32$0 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-      i64toi32_i32$5 = i64toi32_i32$5;
-      var$8 = i64toi32_i32$4;
-      var$8$hi = i64toi32_i32$5;
+      i64toi32_i32$3 = var$1$hi;
+      i64toi32_i32$5 = var$1;
+      i64toi32_i32$4 = 4294967295;
+      i64toi32_i32$1 = 4294967295;
+      i64toi32_i32$2 = i64toi32_i32$5 + i64toi32_i32$1 | 0;
+      i64toi32_i32$0 = i64toi32_i32$3 + i64toi32_i32$4 | 0;
+      if (i64toi32_i32$2 >>> 0 < i64toi32_i32$1 >>> 0) i64toi32_i32$0 = i64toi32_i32$0 + 1 | 0;
+      var$8 = i64toi32_i32$2;
+      var$8$hi = i64toi32_i32$0;
       label$15 : do {
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$5;
-       i64toi32_i32$1 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$1 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
-        $46 = 0;
+       i64toi32_i32$1 = var$5$hi;
+       i64toi32_i32$3 = var$5;
+       i64toi32_i32$4 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$6 = i64toi32_i32$2 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$2 & 63 | 0) >>> 0) {
+        i64toi32_i32$4 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
+        $32 = 0;
        } else {
-        i64toi32_i32$1 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$2 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$5 << i64toi32_i32$3 | 0) | 0;
-        $46 = i64toi32_i32$2 << i64toi32_i32$3 | 0;
+        i64toi32_i32$4 = ((1 << i64toi32_i32$6 | 0) - 1 | 0) & (i64toi32_i32$3 >>> (32 - i64toi32_i32$6 | 0) | 0) | 0 | (i64toi32_i32$1 << i64toi32_i32$6 | 0) | 0;
+        $32 = i64toi32_i32$3 << i64toi32_i32$6 | 0;
        }
-       $140 = $46;
-       $140$hi = i64toi32_i32$1;
+       i64toi32_i32$5 = $32;
        i64toi32_i32$1 = var$0$hi;
-       i64toi32_i32$1 = i64toi32_i32$1;
-       i64toi32_i32$5 = var$0;
+       i64toi32_i32$3 = var$0;
        i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$3 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
+       i64toi32_i32$6 = 63;
+       i64toi32_i32$7 = i64toi32_i32$6 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$6 & 63 | 0) >>> 0) {
         i64toi32_i32$2 = 0;
-        $47 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
+        $33 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$3 | 0;
-        $47 = (((1 << i64toi32_i32$3 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$3 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$3 | 0) | 0;
+        i64toi32_i32$2 = i64toi32_i32$1 >>> i64toi32_i32$7 | 0;
+        $33 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$1 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$3 >>> i64toi32_i32$7 | 0) | 0;
        }
-       $142$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = $140$hi;
-       i64toi32_i32$1 = $140;
-       i64toi32_i32$5 = $142$hi;
-       i64toi32_i32$0 = $47;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$5 = i64toi32_i32$1 | i64toi32_i32$0 | 0;
-       var$5$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       $144 = var$5;
-       $144$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$5 = var$5$hi;
-       i64toi32_i32$5 = var$8$hi;
-       i64toi32_i32$2 = var$8;
-       i64toi32_i32$1 = var$5$hi;
-       i64toi32_i32$0 = var$5;
-       i64toi32_i32$3 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$1 | 0;
-       i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-       i64toi32_i32$4 = i64toi32_i32$4;
-       i64toi32_i32$5 = i64toi32_i32$3;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 63;
-       i64toi32_i32$1 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$4 >> 31 | 0;
-        $48 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
+       i64toi32_i32$3 = $33;
+       i64toi32_i32$2 = i64toi32_i32$4 | i64toi32_i32$2 | 0;
+       var$5 = i64toi32_i32$5 | i64toi32_i32$3 | 0;
+       i64toi32_i32$5 = var$5;
+       var$5$hi = i64toi32_i32$2;
+       i64toi32_i32$0 = i64toi32_i32$5;
+       i64toi32_i32$1 = var$8$hi;
+       i64toi32_i32$3 = var$8;
+       i64toi32_i32$6 = i64toi32_i32$2;
+       i64toi32_i32$7 = i64toi32_i32$5;
+       i64toi32_i32$9 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$5 >>> 0) + i64toi32_i32$2 | 0;
+       i64toi32_i32$9 = i64toi32_i32$1 - i64toi32_i32$9 | 0;
+       i64toi32_i32$4 = i64toi32_i32$3 - i64toi32_i32$5 | 0;
+       i64toi32_i32$3 = 0;
+       i64toi32_i32$1 = 63;
+       i64toi32_i32$7 = i64toi32_i32$1 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$1 & 63 | 0) >>> 0) {
+        i64toi32_i32$3 = i64toi32_i32$9 >> 31 | 0;
+        $34 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
        } else {
-        i64toi32_i32$2 = i64toi32_i32$4 >> i64toi32_i32$1 | 0;
-        $48 = (((1 << i64toi32_i32$1 | 0) - 1 | 0) & i64toi32_i32$4 | 0) << (32 - i64toi32_i32$1 | 0) | 0 | (i64toi32_i32$5 >>> i64toi32_i32$1 | 0) | 0;
+        i64toi32_i32$3 = i64toi32_i32$9 >> i64toi32_i32$7 | 0;
+        $34 = (((1 << i64toi32_i32$7 | 0) - 1 | 0) & i64toi32_i32$9 | 0) << (32 - i64toi32_i32$7 | 0) | 0 | (i64toi32_i32$4 >>> i64toi32_i32$7 | 0) | 0;
        }
-       i64toi32_i32$2 = i64toi32_i32$2;
-       var$6 = $48;
-       var$6$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = i64toi32_i32$2;
-       i64toi32_i32$2 = var$1$hi;
-       i64toi32_i32$2 = var$6$hi;
+       var$6 = $34;
        i64toi32_i32$4 = var$6;
-       i64toi32_i32$5 = var$1$hi;
-       i64toi32_i32$0 = var$1;
-       i64toi32_i32$5 = i64toi32_i32$2 & i64toi32_i32$5 | 0;
-       $151 = i64toi32_i32$4 & i64toi32_i32$0 | 0;
-       $151$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = $144$hi;
-       i64toi32_i32$2 = $144;
-       i64toi32_i32$4 = $151$hi;
-       i64toi32_i32$0 = $151;
-       i64toi32_i32$1 = i64toi32_i32$2 - i64toi32_i32$0 | 0;
-       i64toi32_i32$6 = i64toi32_i32$2 >>> 0 < i64toi32_i32$0 >>> 0;
-       i64toi32_i32$3 = i64toi32_i32$6 + i64toi32_i32$4 | 0;
-       i64toi32_i32$3 = i64toi32_i32$5 - i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$5 = i64toi32_i32$1;
-       var$5$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = var$0$hi;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$5 = var$0;
-       i64toi32_i32$2 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-       if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-        i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-        $49 = 0;
+       var$6$hi = i64toi32_i32$3;
+       i64toi32_i32$5 = i64toi32_i32$4;
+       i64toi32_i32$4 = var$1$hi;
+       i64toi32_i32$9 = var$1;
+       i64toi32_i32$4 = i64toi32_i32$3 & i64toi32_i32$4 | 0;
+       i64toi32_i32$5 = i64toi32_i32$5 & i64toi32_i32$9 | 0;
+       i64toi32_i32$3 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
+       i64toi32_i32$1 = i64toi32_i32$0 >>> 0 < i64toi32_i32$5 >>> 0;
+       i64toi32_i32$9 = i64toi32_i32$1 + i64toi32_i32$4 | 0;
+       i64toi32_i32$9 = i64toi32_i32$2 - i64toi32_i32$9 | 0;
+       var$5 = i64toi32_i32$3;
+       var$5$hi = i64toi32_i32$9;
+       i64toi32_i32$2 = var$0$hi;
+       i64toi32_i32$0 = var$0;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$4 = 1;
+       i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+       if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+        i64toi32_i32$5 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
+        $35 = 0;
        } else {
-        i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-        $49 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+        i64toi32_i32$5 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$0 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$2 << i64toi32_i32$3 | 0) | 0;
+        $35 = i64toi32_i32$0 << i64toi32_i32$3 | 0;
        }
-       $154$hi = i64toi32_i32$2;
-       i64toi32_i32$2 = var$7$hi;
-       i64toi32_i32$2 = $154$hi;
-       i64toi32_i32$3 = $49;
-       i64toi32_i32$5 = var$7$hi;
-       i64toi32_i32$0 = var$7;
-       i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       var$0 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
-       var$0$hi = i64toi32_i32$5;
-       i64toi32_i32$5 = var$6$hi;
-       i64toi32_i32$5 = i64toi32_i32$5;
-       i64toi32_i32$2 = var$6;
-       i64toi32_i32$3 = 0;
-       i64toi32_i32$0 = 1;
-       i64toi32_i32$3 = i64toi32_i32$5 & i64toi32_i32$3 | 0;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$6 = i64toi32_i32$2 & i64toi32_i32$0 | 0;
-       var$6$hi = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       i64toi32_i32$3 = i64toi32_i32$3;
-       var$7 = var$6;
-       var$7$hi = i64toi32_i32$3;
+       i64toi32_i32$9 = $35;
+       i64toi32_i32$0 = var$7$hi;
+       i64toi32_i32$2 = var$7;
+       i64toi32_i32$0 = i64toi32_i32$5 | i64toi32_i32$0 | 0;
+       var$0 = i64toi32_i32$9 | i64toi32_i32$2 | 0;
+       var$0$hi = i64toi32_i32$0;
+       i64toi32_i32$9 = var$6$hi;
+       i64toi32_i32$0 = var$6;
+       i64toi32_i32$5 = 0;
+       i64toi32_i32$2 = 1;
+       i64toi32_i32$5 = i64toi32_i32$9 & i64toi32_i32$5 | 0;
+       var$6 = i64toi32_i32$0 & i64toi32_i32$2 | 0;
+       i64toi32_i32$0 = var$6;
+       var$6$hi = i64toi32_i32$5;
+       var$7 = i64toi32_i32$0;
+       var$7$hi = i64toi32_i32$5;
        var$2 = var$2 + 4294967295 | 0;
        if (var$2) continue label$15;
        break label$15;
       } while (1);
       break label$13;
-     };
+     }
     };
-    i64toi32_i32$3 = var$5$hi;
-    i64toi32_i32$2 = 1024;
-    i64toi32_i32$3 = i64toi32_i32$3;
-    wasm2js_i32$0 = i64toi32_i32$2;
+    i64toi32_i32$5 = 1024;
+    i64toi32_i32$0 = var$5$hi;
+    wasm2js_i32$0 = i64toi32_i32$5;
     wasm2js_i32$1 = var$5;
     HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-    wasm2js_i32$0 = i64toi32_i32$2;
-    wasm2js_i32$1 = i64toi32_i32$3;
+    wasm2js_i32$0 = i64toi32_i32$5;
+    wasm2js_i32$1 = i64toi32_i32$0;
     (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-    i64toi32_i32$3 = var$0$hi;
-    i64toi32_i32$3 = i64toi32_i32$3;
+    i64toi32_i32$9 = var$0$hi;
     i64toi32_i32$5 = var$0;
     i64toi32_i32$2 = 0;
-    i64toi32_i32$0 = 1;
-    i64toi32_i32$4 = i64toi32_i32$0 & 31 | 0;
-    if (32 >>> 0 <= (i64toi32_i32$0 & 63 | 0) >>> 0) {
-     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
-     $50 = 0;
+    i64toi32_i32$4 = 1;
+    i64toi32_i32$3 = i64toi32_i32$4 & 31 | 0;
+    if (32 >>> 0 <= (i64toi32_i32$4 & 63 | 0) >>> 0) {
+     i64toi32_i32$2 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
+     $36 = 0;
     } else {
-     i64toi32_i32$2 = ((1 << i64toi32_i32$4 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$4 | 0) | 0) | 0 | (i64toi32_i32$3 << i64toi32_i32$4 | 0) | 0;
-     $50 = i64toi32_i32$5 << i64toi32_i32$4 | 0;
+     i64toi32_i32$2 = ((1 << i64toi32_i32$3 | 0) - 1 | 0) & (i64toi32_i32$5 >>> (32 - i64toi32_i32$3 | 0) | 0) | 0 | (i64toi32_i32$9 << i64toi32_i32$3 | 0) | 0;
+     $36 = i64toi32_i32$5 << i64toi32_i32$3 | 0;
     }
-    $165$hi = i64toi32_i32$2;
-    i64toi32_i32$2 = var$6$hi;
-    i64toi32_i32$2 = $165$hi;
-    i64toi32_i32$3 = $50;
+    i64toi32_i32$0 = $36;
     i64toi32_i32$5 = var$6$hi;
-    i64toi32_i32$0 = var$6;
+    i64toi32_i32$9 = var$6;
     i64toi32_i32$5 = i64toi32_i32$2 | i64toi32_i32$5 | 0;
-    i64toi32_i32$5 = i64toi32_i32$5;
-    i64toi32_i32$3 = i64toi32_i32$3 | i64toi32_i32$0 | 0;
+    i64toi32_i32$0 = i64toi32_i32$0 | i64toi32_i32$9 | 0;
     i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
-    return i64toi32_i32$3 | 0;
+    return i64toi32_i32$0 | 0;
    };
-   i64toi32_i32$3 = var$0$hi;
-   i64toi32_i32$5 = 1024;
-   i64toi32_i32$3 = i64toi32_i32$3;
-   wasm2js_i32$0 = i64toi32_i32$5;
+   i64toi32_i32$0 = 1024;
+   i64toi32_i32$5 = var$0$hi;
+   wasm2js_i32$0 = i64toi32_i32$0;
    wasm2js_i32$1 = var$0;
    HEAP32[wasm2js_i32$0 >> 2] = wasm2js_i32$1;
-   wasm2js_i32$0 = i64toi32_i32$5;
-   wasm2js_i32$1 = i64toi32_i32$3;
+   wasm2js_i32$0 = i64toi32_i32$0;
+   wasm2js_i32$1 = i64toi32_i32$5;
    (wasm2js_i32$2 = wasm2js_i32$0, wasm2js_i32$3 = wasm2js_i32$1), ((HEAP8[(wasm2js_i32$2 + 4 | 0) >> 0] = wasm2js_i32$3 & 255 | 0, HEAP8[(wasm2js_i32$2 + 5 | 0) >> 0] = (wasm2js_i32$3 >>> 8 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 6 | 0) >> 0] = (wasm2js_i32$3 >>> 16 | 0) & 255 | 0), HEAP8[(wasm2js_i32$2 + 7 | 0) >> 0] = (wasm2js_i32$3 >>> 24 | 0) & 255 | 0;
-   i64toi32_i32$3 = 0;
+   i64toi32_i32$5 = 0;
    var$0 = 0;
-   var$0$hi = i64toi32_i32$3;
+   var$0$hi = i64toi32_i32$5;
   };
-  i64toi32_i32$3 = var$0$hi;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$3 = i64toi32_i32$3;
-  i64toi32_i32$5 = var$0;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$3;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$5 = var$0$hi;
+  i64toi32_i32$0 = var$0;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$5;
+  return i64toi32_i32$0 | 0;
+ }
+ 
+ function __wasm_ctz_i32(var$0) {
+  var$0 = var$0 | 0;
+  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
+  return 32 | 0;
  }
  
  function __wasm_i64_sdiv(var$0, var$0$hi, var$1, var$1$hi) {
@@ -659,14 +557,11 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4sdiv3Div3div17he78fc483e41d7ec7E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
@@ -677,25 +572,16 @@ function asmFunc(global, env, buffer) {
   var$0$hi = var$0$hi | 0;
   var$1 = var$1 | 0;
   var$1$hi = var$1$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0;
-  i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = var$1$hi;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
   i64toi32_i32$0 = var$0$hi;
   i64toi32_i32$1 = var$1$hi;
   i64toi32_i32$1 = _ZN17compiler_builtins3int4udiv10divmod_u6417h6026910b5ed08e40E(var$0 | 0, i64toi32_i32$0 | 0, var$1 | 0, i64toi32_i32$1 | 0) | 0;
   i64toi32_i32$0 = i64toi32_i32$HIGH_BITS;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$1 = i64toi32_i32$1;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$1 | 0;
  }
  
- function __wasm_ctz_i32(var$0) {
-  var$0 = var$0 | 0;
-  if (var$0) return 31 - Math_clz32((var$0 + 4294967295 | 0) ^ var$0 | 0) | 0 | 0;
-  return 32 | 0;
- }
- 
  return {
   no_dce_i32_div_s: $0, 
   no_dce_i32_div_u: $1, 
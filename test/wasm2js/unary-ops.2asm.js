@@ -35,52 +35,39 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $3$hi = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = __wasm_popcnt_i64($0 | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $3$hi = i64toi32_i32$1;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$1 = __wasm_popcnt_i64($0 | 0, i64toi32_i32$1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = r$hi;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$2 = i64toi32_i32$0;
-  i64toi32_i32$0 = r$hi;
-  return (i64toi32_i32$2 | 0) == (r | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$0 | 0) | 0 | 0;
+  return (i64toi32_i32$0 | 0) == (r | 0) & (i64toi32_i32$HIGH_BITS | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
  }
  
  function $3($0, r, r$hi) {
   $0 = $0 | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, $3$hi = 0;
-  i64toi32_i32$0 = 0;
-  $3$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = r$hi;
-  i64toi32_i32$0 = $3$hi;
-  return ($0 | 0) == (r | 0) & (i64toi32_i32$0 | 0) == (r$hi | 0) | 0 | 0;
+  var i64toi32_i32$2 = 0;
+  i64toi32_i32$2 = $0;
+  i64toi32_i32$2 = r$hi;
+  return ($0 | 0) == (r | 0) & (0 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  function $4($0, r, r$hi) {
   $0 = $0 | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $3$hi = 0;
-  i64toi32_i32$1 = $0;
-  i64toi32_i32$0 = i64toi32_i32$1 >> 31 | 0;
-  $3$hi = i64toi32_i32$0;
-  i64toi32_i32$0 = r$hi;
-  i64toi32_i32$0 = $3$hi;
-  i64toi32_i32$1 = r$hi;
-  return ($0 | 0) == (r | 0) & (i64toi32_i32$0 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
+  var i64toi32_i32$2 = 0, i64toi32_i32$1 = 0;
+  i64toi32_i32$2 = $0;
+  i64toi32_i32$1 = i64toi32_i32$2 >> 31 | 0;
+  i64toi32_i32$2 = r$hi;
+  return ($0 | 0) == (r | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$2 | 0) | 0 | 0;
  }
  
  function $5($0, $0$hi) {
   $0 = $0 | 0;
   $0$hi = $0$hi | 0;
-  var i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  return ($0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0;
+  return ($0 | $0$hi | 0 | 0) == (0 | 0) | 0;
  }
  
  function $6($0) {
@@ -98,20 +85,15 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, $9_1 = 0, $3$hi = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$1 = $0;
-  i64toi32_i32$3 = Math_clz32(i64toi32_i32$0);
-  i64toi32_i32$2 = 0;
-  if ((i64toi32_i32$3 | 0) == (32 | 0)) $9_1 = Math_clz32(i64toi32_i32$1) + 32 | 0; else $9_1 = i64toi32_i32$3;
-  $3$hi = i64toi32_i32$2;
-  i64toi32_i32$2 = r$hi;
-  i64toi32_i32$2 = $3$hi;
-  i64toi32_i32$1 = $9_1;
-  i64toi32_i32$0 = r$hi;
-  i64toi32_i32$3 = r;
-  return (i64toi32_i32$1 | 0) == (i64toi32_i32$3 | 0) & (i64toi32_i32$2 | 0) == (i64toi32_i32$0 | 0) | 0 | 0;
+  var i64toi32_i32$1 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, $8_1 = 0, i64toi32_i32$3 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$2 = $0;
+  i64toi32_i32$4 = Math_clz32(i64toi32_i32$1);
+  i64toi32_i32$3 = 0;
+  if ((i64toi32_i32$4 | 0) == (32 | 0)) $8_1 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $8_1 = i64toi32_i32$4;
+  i64toi32_i32$1 = r$hi;
+  i64toi32_i32$2 = r;
+  return ($8_1 | 0) == (i64toi32_i32$2 | 0) & (i64toi32_i32$3 | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
  }
  
  function $9($0, $0$hi, r, r$hi) {
@@ -119,17 +101,12 @@ function asmFunc(global, env, buffer) {
   $0$hi = $0$hi | 0;
   r = r | 0;
   r$hi = r$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$1 = 0, $3$hi = 0, i64toi32_i32$2 = 0;
-  i64toi32_i32$0 = $0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = __wasm_ctz_i64($0 | 0, i64toi32_i32$0 | 0) | 0;
-  i64toi32_i32$1 = i64toi32_i32$HIGH_BITS;
-  $3$hi = i64toi32_i32$1;
+  var i64toi32_i32$1 = 0, i64toi32_i32$0 = 0;
+  i64toi32_i32$1 = $0$hi;
+  i64toi32_i32$1 = __wasm_ctz_i64($0 | 0, i64toi32_i32$1 | 0) | 0;
+  i64toi32_i32$0 = i64toi32_i32$1;
   i64toi32_i32$1 = r$hi;
-  i64toi32_i32$1 = $3$hi;
-  i64toi32_i32$2 = i64toi32_i32$0;
-  i64toi32_i32$0 = r$hi;
-  return (i64toi32_i32$2 | 0) == (r | 0) & (i64toi32_i32$1 | 0) == (i64toi32_i32$0 | 0) | 0 | 0;
+  return (i64toi32_i32$0 | 0) == (r | 0) & (i64toi32_i32$HIGH_BITS | 0) == (i64toi32_i32$1 | 0) | 0 | 0;
  }
  
  function __wasm_ctz_i32(var$0) {
@@ -141,46 +118,35 @@ function asmFunc(global, env, buffer) {
  function __wasm_ctz_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$4 = 0, i64toi32_i32$2 = 0, i64toi32_i32$1 = 0, $10 = 0, $5$hi = 0, $8$hi = 0;
+  var i64toi32_i32$4 = 0, i64toi32_i32$0 = 0, i64toi32_i32$3 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$6 = 0, i64toi32_i32$7 = 0, $10 = 0, i64toi32_i32$1 = 0;
   i64toi32_i32$0 = var$0$hi;
-  i64toi32_i32$0 = i64toi32_i32$0;
   if (((var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0) | 0) == (0 | 0)) {
-   i64toi32_i32$0 = var$0$hi;
-   i64toi32_i32$0 = i64toi32_i32$0;
-   i64toi32_i32$2 = var$0;
-   i64toi32_i32$1 = 4294967295;
-   i64toi32_i32$3 = 4294967295;
-   i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$3 | 0;
-   i64toi32_i32$5 = i64toi32_i32$0 + i64toi32_i32$1 | 0;
-   if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$5 = i64toi32_i32$5 + 1 | 0;
-   $5$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = var$0$hi;
-   i64toi32_i32$5 = $5$hi;
-   i64toi32_i32$0 = i64toi32_i32$4;
-   i64toi32_i32$2 = var$0$hi;
-   i64toi32_i32$3 = var$0;
-   i64toi32_i32$2 = i64toi32_i32$5 ^ i64toi32_i32$2 | 0;
-   i64toi32_i32$2 = i64toi32_i32$2;
-   i64toi32_i32$0 = i64toi32_i32$0 ^ i64toi32_i32$3 | 0;
-   i64toi32_i32$3 = Math_clz32(i64toi32_i32$2);
-   i64toi32_i32$5 = 0;
-   if ((i64toi32_i32$3 | 0) == (32 | 0)) $10 = Math_clz32(i64toi32_i32$0) + 32 | 0; else $10 = i64toi32_i32$3;
-   $8$hi = i64toi32_i32$5;
-   i64toi32_i32$5 = 0;
+   i64toi32_i32$1 = 0;
    i64toi32_i32$0 = 63;
-   i64toi32_i32$2 = $8$hi;
+   i64toi32_i32$4 = var$0$hi;
+   i64toi32_i32$3 = var$0;
+   i64toi32_i32$6 = 4294967295;
+   i64toi32_i32$7 = i64toi32_i32$3 + i64toi32_i32$6 | 0;
+   i64toi32_i32$8 = i64toi32_i32$4 + 4294967295 | 0;
+   if (i64toi32_i32$7 >>> 0 < i64toi32_i32$6 >>> 0) i64toi32_i32$8 = i64toi32_i32$8 + 1 | 0;
+   i64toi32_i32$2 = i64toi32_i32$7;
+   i64toi32_i32$3 = var$0$hi;
+   i64toi32_i32$4 = var$0;
+   i64toi32_i32$3 = i64toi32_i32$8 ^ i64toi32_i32$3 | 0;
+   i64toi32_i32$2 = i64toi32_i32$2 ^ i64toi32_i32$4 | 0;
+   i64toi32_i32$4 = Math_clz32(i64toi32_i32$3);
+   i64toi32_i32$8 = 0;
+   if ((i64toi32_i32$4 | 0) == (32 | 0)) $10 = Math_clz32(i64toi32_i32$2) + 32 | 0; else $10 = i64toi32_i32$4;
    i64toi32_i32$3 = $10;
-   i64toi32_i32$1 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
-   i64toi32_i32$4 = (i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$2 | 0;
-   i64toi32_i32$4 = i64toi32_i32$5 - i64toi32_i32$4 | 0;
-   i64toi32_i32$4 = i64toi32_i32$4;
-   i64toi32_i32$0 = i64toi32_i32$1;
+   i64toi32_i32$2 = i64toi32_i32$0 - i64toi32_i32$3 | 0;
+   i64toi32_i32$6 = i64toi32_i32$0 >>> 0 < i64toi32_i32$3 >>> 0;
+   i64toi32_i32$4 = i64toi32_i32$6 + i64toi32_i32$8 | 0;
+   i64toi32_i32$4 = i64toi32_i32$1 - i64toi32_i32$4 | 0;
+   i64toi32_i32$0 = i64toi32_i32$2;
    i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
    return i64toi32_i32$0 | 0;
   }
   i64toi32_i32$0 = 0;
-  i64toi32_i32$0 = i64toi32_i32$0;
-  i64toi32_i32$0 = i64toi32_i32$0;
   i64toi32_i32$4 = 64;
   i64toi32_i32$HIGH_BITS = i64toi32_i32$0;
   return i64toi32_i32$4 | 0;
@@ -188,10 +154,10 @@ function asmFunc(global, env, buffer) {
  
  function __wasm_popcnt_i32(var$0) {
   var$0 = var$0 | 0;
-  var var$1 = 0, $5_1 = 0;
+  var var$1 = 0, $2_1 = 0;
   label$1 : {
    label$2 : do {
-    $5_1 = var$1;
+    $2_1 = var$1;
     if ((var$0 | 0) == (0 | 0)) break label$1;
     var$0 = var$0 & (var$0 - 1 | 0) | 0;
     var$1 = var$1 + 1 | 0;
@@ -199,63 +165,48 @@ function asmFunc(global, env, buffer) {
     break label$2;
    } while (1);
   };
-  return $5_1 | 0;
+  return $2_1 | 0;
  }
  
  function __wasm_popcnt_i64(var$0, var$0$hi) {
   var$0 = var$0 | 0;
   var$0$hi = var$0$hi | 0;
-  var i64toi32_i32$0 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, i64toi32_i32$5 = 0, i64toi32_i32$3 = 0, i64toi32_i32$1 = 0, var$1$hi = 0, var$1 = 0, $5_1 = 0, $5$hi = 0, $4_1 = 0, $9$hi = 0;
+  var i64toi32_i32$3 = 0, i64toi32_i32$6 = 0, i64toi32_i32$0 = 0, i64toi32_i32$8 = 0, i64toi32_i32$2 = 0, i64toi32_i32$4 = 0, var$1$hi = 0, var$1 = 0, $11 = 0, i64toi32_i32$1 = 0;
   label$1 : {
    label$2 : do {
-    i64toi32_i32$0 = var$1$hi;
-    i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    $4_1 = (var$0 | i64toi32_i32$0 | 0 | 0) == (0 | 0);
-    i64toi32_i32$0 = var$1$hi;
-    $5_1 = var$1;
-    $5$hi = i64toi32_i32$0;
-    if ($4_1) break label$1;
-    i64toi32_i32$0 = $5$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
+    i64toi32_i32$2 = var$1$hi;
+    i64toi32_i32$0 = var$1;
+    i64toi32_i32$1 = i64toi32_i32$2;
+    i64toi32_i32$3 = var$0$hi;
+    $11 = i64toi32_i32$0;
+    if ((var$0 | i64toi32_i32$3 | 0 | 0) == (0 | 0)) break label$1;
     i64toi32_i32$0 = var$0$hi;
-    i64toi32_i32$0 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$0;
     i64toi32_i32$2 = var$0;
-    i64toi32_i32$1 = 0;
-    i64toi32_i32$3 = 1;
-    i64toi32_i32$4 = i64toi32_i32$2 - i64toi32_i32$3 | 0;
-    i64toi32_i32$5 = (i64toi32_i32$2 >>> 0 < i64toi32_i32$3 >>> 0) + i64toi32_i32$1 | 0;
-    i64toi32_i32$5 = i64toi32_i32$0 - i64toi32_i32$5 | 0;
-    $9$hi = i64toi32_i32$5;
-    i64toi32_i32$5 = i64toi32_i32$0;
-    i64toi32_i32$0 = i64toi32_i32$2;
-    i64toi32_i32$2 = $9$hi;
-    i64toi32_i32$3 = i64toi32_i32$4;
-    i64toi32_i32$2 = i64toi32_i32$5 & i64toi32_i32$2 | 0;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    var$0 = i64toi32_i32$0 & i64toi32_i32$4 | 0;
-    var$0$hi = i64toi32_i32$2;
+    i64toi32_i32$4 = i64toi32_i32$0;
+    i64toi32_i32$3 = i64toi32_i32$2;
+    i64toi32_i32$6 = 1;
+    i64toi32_i32$8 = (i64toi32_i32$3 >>> 0 < i64toi32_i32$6 >>> 0) + 0 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 - i64toi32_i32$8 | 0;
+    i64toi32_i32$3 = i64toi32_i32$3 - i64toi32_i32$6 | 0;
+    i64toi32_i32$8 = i64toi32_i32$0 & i64toi32_i32$8 | 0;
+    var$0 = i64toi32_i32$2 & i64toi32_i32$3 | 0;
+    var$0$hi = i64toi32_i32$8;
     i64toi32_i32$2 = var$1$hi;
-    i64toi32_i32$2 = i64toi32_i32$2;
-    i64toi32_i32$5 = var$1;
+    i64toi32_i32$8 = var$1;
     i64toi32_i32$0 = 0;
     i64toi32_i32$3 = 1;
-    i64toi32_i32$1 = i64toi32_i32$5 + i64toi32_i32$3 | 0;
-    i64toi32_i32$4 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
-    if (i64toi32_i32$1 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$4 = i64toi32_i32$4 + 1 | 0;
-    i64toi32_i32$4 = i64toi32_i32$4;
-    var$1 = i64toi32_i32$1;
-    var$1$hi = i64toi32_i32$4;
+    i64toi32_i32$4 = i64toi32_i32$8 + i64toi32_i32$3 | 0;
+    i64toi32_i32$6 = i64toi32_i32$2 + i64toi32_i32$0 | 0;
+    if (i64toi32_i32$4 >>> 0 < i64toi32_i32$3 >>> 0) i64toi32_i32$6 = i64toi32_i32$6 + 1 | 0;
+    var$1 = i64toi32_i32$4;
+    var$1$hi = i64toi32_i32$6;
     continue label$2;
     break label$2;
    } while (1);
   };
-  i64toi32_i32$4 = $5$hi;
-  i64toi32_i32$4 = i64toi32_i32$4;
-  i64toi32_i32$5 = $5_1;
-  i64toi32_i32$HIGH_BITS = i64toi32_i32$4;
-  return i64toi32_i32$5 | 0;
+  i64toi32_i32$6 = $11;
+  i64toi32_i32$HIGH_BITS = i64toi32_i32$1;
+  return i64toi32_i32$6 | 0;
  }
  
  return {